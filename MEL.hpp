@@ -26,15 +26,24 @@ SOFTWARE.
 #include <mpi.h>
 
 #include <cstdio>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <cstring>
 #include <string>
 #include <vector>
+#include <list>
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <complex>
 #include <iostream>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <atomic>
+#include <future>
 
 /**
 * \file MEL.hpp
@@ -65,7 +74,6 @@ namespace MEL {
      * ## Todo
      * 
      * - Add Distributed Graph Topology functions.
-     * - Add overloads for p2p/collective communications for transmitting `std::array`/`std::vector` by start/end iterators.
      * - Improve error handler implementation. A rough version is currently in place.
      * - Implement ranged-mutexes. 
      *
@@ -78,6 +86,9 @@ namespace MEL {
      * \defgroup Mem Memory Allocation
      * Dynamic Memory Allocation using the underlying MPI_Alloc allocator
      *
+     * \defgroup Info Info Hints
+     * Info Object Creation / Deletion and Hint Presets
+     *
      * \defgroup Comm Communicators & Groups
      * Communicator & Group Creation / Deletion
      *
@@ -110,10 +121,37 @@ namespace MEL {
      *
      * \defgroup Shared Shared Arrays
      * A simple shared array implementation using Mutex locks and RMA one-sided communication
+     *
+     * \defgroup HashMap Distributed Hash Map
+     * A partitioned key / value store built on RMA atomics and one-sided communication
+     *
+     * \defgroup Aggregate Message Aggregation
+     * Buffering of many small point-2-point messages into few large ones, dispatched to registered handlers on the receiver
+     *
+     * \defgroup Checkpoint Checkpointing
+     * Asynchronous double buffered snapshots of registered arrays to a shared file using collective File-IO
+     *
+     * \defgroup Progress Progress Engine
+     * Background progress of non-blocking requests with completion callbacks
+     *
+     * \defgroup Future Futures
+     * Values of non-blocking operations with continuations, progressed by testing every pending request together
+     *
+     * \defgroup Profile Profiling
+     * Call counts, bytes, times and message size histograms of every wrapped MPI call, enabled by defining MEL_PROFILE
+     *
+     * \defgroup Trace Tracing
+     * Timelines of every wrapped MPI call, RMA epoch and mutex wait merged into Chrome trace JSON, enabled by defining MEL_TRACE
+     *
+     * \defgroup CommMatrix Communication Matrix
+     * Bytes and messages between every pair of ranks, and compute versus wait time per rank, enabled by defining MEL_COMM_MATRIX
      */
 
 #if (MPI_VERSION == 3)
 #define MEL_3
+#if (MPI_SUBVERSION >= 1)
+#define MEL_3_1
+#endif
 #endif
 
     typedef MPI_Aint   Aint;
@@ -123,11 +161,370 @@ namespace MEL {
     typedef MPI_Count  Count;
 #endif
 
+#if defined(MEL_PROFILE) || defined(MEL_TRACE) || defined(MEL_COMM_MATRIX)
+#ifndef MEL_PROFILE_FILE
+#define MEL_PROFILE_FILE "MEL_profile.csv"
+#endif
+
+#ifndef MEL_TRACE_FILE
+#define MEL_TRACE_FILE "MEL_trace.json"
+#endif
+
+#ifndef MEL_TRACE_EVENTS
+#define MEL_TRACE_EVENTS 65536
+#endif
+
+#ifndef MEL_COMM_MATRIX_FILE
+#define MEL_COMM_MATRIX_FILE "MEL_comm_matrix.csv"
+#endif
+
+#ifndef MEL_COMM_MESSAGES_FILE
+#define MEL_COMM_MESSAGES_FILE "MEL_comm_messages.csv"
+#endif
+
+#ifndef MEL_COMM_IMBALANCE_FILE
+#define MEL_COMM_IMBALANCE_FILE "MEL_comm_imbalance.csv"
+#endif
+
+    /// \cond HIDE
+    /// Bytes for the next wrapped call on this thread, set by MEL_PROFILE_BYTES just before MEL_THROW. Negative if unknown
+    inline long long& Profile_pendingBytes() {
+        static thread_local long long bytes = -1;
+        return bytes;
+    };
+
+    /// MPI_Wtime cannot be called before MPI_Init, which is itself profiled
+    inline double Profile_now() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    };
+
+    inline void Profile_setBytes(const long long num, const MPI_Datatype datatype) {
+        int size = 0;
+        if (datatype == MPI_DATATYPE_NULL || MPI_Type_size(datatype, &size) != MPI_SUCCESS) size = 0;
+        Profile_pendingBytes() = num * size;
+    };
+    /// \endcond
+
+#ifdef MEL_PROFILE
+    /// \cond HIDE
+    /// Message sizes are binned by power of two, bin 0 holds empty messages and bin k holds [2^(k-1), 2^k) bytes
+    static constexpr int PROFILE_BINS = 32;
+
+    struct Profile_entry {
+        long long calls, bytes;
+        double time;
+        long long hist[PROFILE_BINS];
+
+        Profile_entry() : calls(0), bytes(0), time(0.0) {
+            for (int i = 0; i < PROFILE_BINS; ++i) hist[i] = 0;
+        };
+    };
+
+    struct Profile_state {
+        std::mutex mutex;
+        std::map<const char*, Profile_entry> entries;
+        bool enabled;
+
+        Profile_state() : enabled(true) {};
+    };
+
+    inline Profile_state& Profile_getState() {
+        static Profile_state state;
+        return state;
+    };
+
+    inline int Profile_bin(const long long bytes) {
+        int bin = 0;
+        for (long long b = bytes; b > 0 && bin < PROFILE_BINS - 1; b >>= 1) ++bin;
+        return bin;
+    };
+
+    inline void Profile_record(const char *name, const long long bytes, const double time) {
+        Profile_state &state = Profile_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.enabled) return;
+
+        Profile_entry &entry = state.entries[name];
+        ++entry.calls;
+        entry.time += time;
+        if (bytes >= 0) {
+            entry.bytes += bytes;
+            ++entry.hist[Profile_bin(bytes)];
+        }
+    };
+    /// \endcond
+#endif
+
+#ifdef MEL_TRACE
+    /// \cond HIDE
+    struct Trace_event {
+        const char *name;
+        double start, end;
+        long long bytes;
+        int tid;
+    };
+
+    /// Events are kept in a fixed size ring, once full the oldest are overwritten
+    struct Trace_state {
+        std::mutex mutex;
+        std::vector<Trace_event> ring;
+        size_t head;
+        long long recorded;
+        int threads;
+        bool enabled;
+        /// Start times of open epochs keyed by window and target, or by window and a negative tag
+        std::map<std::pair<MPI_Win, int>, double> epochs;
+
+        Trace_state() : head(0), recorded(0), threads(0), enabled(true) {};
+    };
+
+    inline Trace_state& Trace_getState() {
+        static Trace_state state;
+        return state;
+    };
+
+    inline int Trace_tid() {
+        static thread_local int tid = -1;
+        if (tid < 0) {
+            Trace_state &state = Trace_getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            tid = state.threads++;
+        }
+        return tid;
+    };
+
+    inline void Trace_record(const char *name, const long long bytes, const double start, const double end) {
+        const int tid = Trace_tid();
+        Trace_state &state = Trace_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.enabled) return;
+
+        const Trace_event e = { name, start, end, bytes, tid };
+        if (state.ring.size() < (size_t) MEL_TRACE_EVENTS) state.ring.push_back(e);
+        else                                                state.ring[state.head] = e;
+        state.head = (state.head + 1) % MEL_TRACE_EVENTS;
+        ++state.recorded;
+    };
+
+    inline void Trace_epochBegin(const MPI_Win win, const int key) {
+        Trace_state &state = Trace_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.epochs[std::make_pair(win, key)] = Profile_now();
+    };
+
+    inline void Trace_epochEnd(const MPI_Win win, const int key, const char *name) {
+        double start;
+        {
+            Trace_state &state = Trace_getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            auto it = state.epochs.find(std::make_pair(win, key));
+            if (it == state.epochs.end()) return;
+            start = it->second;
+            state.epochs.erase(it);
+        }
+        Trace_record(name, -1, start, Profile_now());
+    };
+    /// \endcond
+
+    /// Macros to record the span between the calls opening and closing an RMA epoch or a held lock
+#define MEL_TRACE_EPOCH_BEGIN(win, key) MEL::Trace_epochBegin((MPI_Win) (win), (key))
+#define MEL_TRACE_EPOCH_END(win, key, name) MEL::Trace_epochEnd((MPI_Win) (win), (key), (name))
+#else
+#define MEL_TRACE_EPOCH_BEGIN(win, key)
+#define MEL_TRACE_EPOCH_END(win, key, name)
+#endif
+
+#ifdef MEL_COMM_MATRIX
+    /// \cond HIDE
+    struct Matrix_cell {
+        long long bytes, messages;
+    };
+
+    struct Matrix_state {
+        std::mutex mutex;
+        /// Traffic keyed by MPI_COMM_WORLD rank of the source and destination
+        std::map<std::pair<int, int>, Matrix_cell> cells;
+        /// MPI_COMM_WORLD ranks of the destination group of each comm world and window seen so far
+        std::map<MPI_Comm, std::vector<int>> commRanks;
+        std::map<MPI_Win,  std::vector<int>> winRanks;
+        std::thread::id main;
+        double start, wait;
+        bool enabled;
+
+        Matrix_state() : main(std::this_thread::get_id()), start(Profile_now()), wait(0.0), enabled(true) {};
+    };
+
+    inline Matrix_state& Matrix_getState() {
+        static Matrix_state state;
+        return state;
+    };
+
+    /// Nesting depth of wrapped calls on this thread, so calls made inside MEL functions are not counted twice
+    inline int& Matrix_depth() {
+        static thread_local int depth = 0;
+        return depth;
+    };
+
+    /// Called at the end of Init, so the clock starts once MPI is up and main is the thread that initialized it
+    inline void Matrix_start() {
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.main  = std::this_thread::get_id();
+        state.start = Profile_now();
+        state.wait  = 0.0;
+    };
+
+    /// Only time spent by the thread that initialized MPI counts as waiting
+    inline void Matrix_wait(const double time) {
+        Matrix_state &state = Matrix_getState();
+        if (std::this_thread::get_id() != state.main) return;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.wait += time;
+    };
+
+    inline std::vector<int> Matrix_translate(const MPI_Group group) {
+        MPI_Group world;
+        int size;
+        MPI_Comm_group(MPI_COMM_WORLD, &world);
+        MPI_Group_size(group, &size);
+
+        std::vector<int> ranks(size), worldRanks(size);
+        for (int i = 0; i < size; ++i) ranks[i] = i;
+        if (size > 0) MPI_Group_translate_ranks(group, size, &ranks[0], world, &worldRanks[0]);
+        MPI_Group_free(&world);
+        return worldRanks;
+    };
+
+    inline void Matrix_record(const std::vector<int> &ranks, const int rank, const long long num, const MPI_Datatype datatype, const bool get) {
+        if (rank < 0 || rank >= (int) ranks.size() || ranks[rank] == MPI_UNDEFINED) return;
+
+        int size = 0, self = 0;
+        if (datatype == MPI_DATATYPE_NULL || MPI_Type_size(datatype, &size) != MPI_SUCCESS) size = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &self);
+
+        Matrix_state &state = Matrix_getState();
+        if (!state.enabled) return;
+        Matrix_cell &cell = state.cells[get ? std::make_pair(ranks[rank], self) : std::make_pair(self, ranks[rank])];
+        cell.bytes += num * size;
+        ++cell.messages;
+    };
+
+    inline void Matrix_p2p(const int dst, const long long num, const MPI_Datatype datatype, const MPI_Comm comm) {
+        if (dst < 0) return;
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        auto it = state.commRanks.find(comm);
+        if (it == state.commRanks.end()) {
+            /// Destinations on an intercommunicator are ranks of the remote group
+            int inter = 0;
+            MPI_Group group;
+            MPI_Comm_test_inter(comm, &inter);
+            if (inter) MPI_Comm_remote_group(comm, &group);
+            else       MPI_Comm_group(comm, &group);
+            it = state.commRanks.insert(std::make_pair(comm, Matrix_translate(group))).first;
+            MPI_Group_free(&group);
+        }
+        Matrix_record(it->second, dst, num, datatype, false);
+    };
+
+    inline void Matrix_rma(const int target, const long long num, const MPI_Datatype datatype, const MPI_Win win, const bool get) {
+        if (target < 0) return;
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        auto it = state.winRanks.find(win);
+        if (it == state.winRanks.end()) {
+            MPI_Group group;
+            MPI_Win_get_group(win, &group);
+            it = state.winRanks.insert(std::make_pair(win, Matrix_translate(group))).first;
+            MPI_Group_free(&group);
+        }
+        Matrix_record(it->second, target, num, datatype, get);
+    };
+
+    /// Handles may be reused once freed, so forget their rank tables
+    inline void Matrix_forgetComm(const MPI_Comm comm) {
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.commRanks.erase(comm);
+    };
+
+    inline void Matrix_forgetWin(const MPI_Win win) {
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.winRanks.erase(win);
+    };
+    /// \endcond
+
+    /// Macros to record the destination of point to point and RMA traffic
+#define MEL_COMM_MATRIX_P2P(dst, num, datatype, comm) MEL::Matrix_p2p((dst), (num), (MPI_Datatype) (datatype), (MPI_Comm) (comm))
+#define MEL_COMM_MATRIX_RMA(target, num, datatype, win) MEL::Matrix_rma((target), (num), (MPI_Datatype) (datatype), (MPI_Win) (win), false)
+#define MEL_COMM_MATRIX_GET(target, num, datatype, win) MEL::Matrix_rma((target), (num), (MPI_Datatype) (datatype), (MPI_Win) (win), true)
+#define MEL_COMM_MATRIX_FORGET_COMM(comm) MEL::Matrix_forgetComm((MPI_Comm) (comm))
+#define MEL_COMM_MATRIX_FORGET_WIN(win) MEL::Matrix_forgetWin((MPI_Win) (win))
+#else
+#define MEL_COMM_MATRIX_P2P(dst, num, datatype, comm)
+#define MEL_COMM_MATRIX_RMA(target, num, datatype, win)
+#define MEL_COMM_MATRIX_GET(target, num, datatype, win)
+#define MEL_COMM_MATRIX_FORGET_COMM(comm)
+#define MEL_COMM_MATRIX_FORGET_WIN(win)
+#endif
+
+    /// \cond HIDE
+    struct Profile_scope {
+        const char *name;
+        long long bytes;
+        double start;
+
+        explicit Profile_scope(const char *_name) : name(_name), bytes(Profile_pendingBytes()), start(Profile_now()) {
+            Profile_pendingBytes() = -1;
+#ifdef MEL_COMM_MATRIX
+            ++Matrix_depth();
+#endif
+        };
+        Profile_scope(const char *_name, const long long _bytes) : name(_name), bytes(_bytes), start(Profile_now()) {
+#ifdef MEL_COMM_MATRIX
+            ++Matrix_depth();
+#endif
+        };
+        ~Profile_scope() {
+            const double end = Profile_now();
+#ifdef MEL_COMM_MATRIX
+            if (--Matrix_depth() == 0) Matrix_wait(end - start);
+#endif
+#ifdef MEL_PROFILE
+            Profile_record(name, bytes, end - start);
+#endif
+#ifdef MEL_TRACE
+            Trace_record(name, bytes, start, end);
+#endif
+        };
+    };
+    /// \endcond
+
+    /// Macros to time a block, and to record the size of the next call made through MEL_THROW
+#define MEL_PROFILE_SCOPE(name, bytes) MEL::Profile_scope melProfileScope((name), (bytes))
+#define MEL_PROFILE_BYTES(num, datatype) MEL::Profile_setBytes((num), (MPI_Datatype) (datatype))
+#define MEL_PROFILE_CALL(message) MEL::Profile_scope melProfileScope(message)
+#else
+#define MEL_PROFILE_SCOPE(name, bytes)
+#define MEL_PROFILE_BYTES(num, datatype)
+#define MEL_PROFILE_CALL(message)
+#define MEL_TRACE_EPOCH_BEGIN(win, key)
+#define MEL_TRACE_EPOCH_END(win, key, name)
+#define MEL_COMM_MATRIX_P2P(dst, num, datatype, comm)
+#define MEL_COMM_MATRIX_RMA(target, num, datatype, win)
+#define MEL_COMM_MATRIX_GET(target, num, datatype, win)
+#define MEL_COMM_MATRIX_FORGET_COMM(comm)
+#define MEL_COMM_MATRIX_FORGET_WIN(win)
+#endif
+
     /// Macro to help with return error codes
 #ifndef MEL_NO_CHECK_ERROR_CODES
-#define MEL_THROW(v, message) { int ierr = (v); if ((ierr) != MPI_SUCCESS) MEL::Abort((ierr), std::string(message)); }
+#define MEL_THROW(v, message) { MEL_PROFILE_CALL(message); int ierr = (v); if ((ierr) != MPI_SUCCESS) MEL::Abort((ierr), std::string(message)); }
 #else
-#define MEL_THROW(v, message) { (v); }
+#define MEL_THROW(v, message) { MEL_PROFILE_CALL(message); (v); }
 #endif
 
     /**
@@ -202,16 +599,99 @@ namespace MEL {
         }
         /// Allows MEL::Abort to be called properly
         MEL_THROW( MPI_Comm_set_errhandler(MPI_COMM_WORLD, MPI_ERRORS_RETURN), "Initialize::SetErrorHandler" );
+#ifdef MEL_COMM_MATRIX
+        Matrix_start();
+#endif
+    };
+
+    /**
+     * \ingroup Utils 
+     * The level of thread support requested from or provided by MPI
+     */
+    enum class ThreadLevel {
+        SINGLE     = MPI_THREAD_SINGLE,
+        FUNNELED   = MPI_THREAD_FUNNELED,
+        SERIALIZED = MPI_THREAD_SERIALIZED,
+        MULTIPLE   = MPI_THREAD_MULTIPLE
+    };
+
+    /**
+     * \ingroup Utils 
+     * Call MPI_Init_thread and setup default error handling
+     *
+     * \see MPI_Init_thread, MPI_Comm_set_errhandler
+     *
+     * \param[in] argc		Forwarded from program main
+     * \param[in] argv		Forwarded from program main
+     * \param[in] required	The level of thread support required
+     * \return				Returns the level of thread support provided, which may be lower than required
+     */
+    inline ThreadLevel InitThread(int &argc, char **&argv, const ThreadLevel required) {
+        int provided = MPI_THREAD_SINGLE;
+        if (!IsInitialized()) {
+            MEL_THROW( MPI_Init_thread(&argc, &argv, (int) required, &provided), "InitThread" );
+        }
+        else {
+            MEL_THROW( MPI_Query_thread(&provided), "InitThread::QueryThread" );
+        }
+        /// Allows MEL::Abort to be called properly
+        MEL_THROW( MPI_Comm_set_errhandler(MPI_COMM_WORLD, MPI_ERRORS_RETURN), "Initialize::SetErrorHandler" );
+#ifdef MEL_COMM_MATRIX
+        Matrix_start();
+#endif
+        return (ThreadLevel) provided;
+    };
+
+    /**
+     * \ingroup Utils 
+     * Get the level of thread support provided by MPI
+     *
+     * \see MPI_Query_thread
+     *
+     * \return				Returns the level of thread support provided
+     */
+    inline ThreadLevel QueryThread() {
+        int provided;
+        MEL_THROW( MPI_Query_thread(&provided), "QueryThread" );
+        return (ThreadLevel) provided;
     };
 
+#ifdef MEL_PROFILE
+    /// \cond HIDE
+    inline void Profile_finalize();
+    /// \endcond
+#endif
+
+#ifdef MEL_TRACE
+    /// \cond HIDE
+    inline void Trace_finalize();
+    /// \endcond
+#endif
+
+#ifdef MEL_COMM_MATRIX
+    /// \cond HIDE
+    inline void Matrix_finalize();
+    /// \endcond
+#endif
+
     /**
      * \ingroup Utils 
-     * Call MPI_Finalize
+     * Call MPI_Finalize. When MEL_PROFILE is defined the profile report is gathered first, when MEL_TRACE is 
+     * defined the trace is merged and written, and when MEL_COMM_MATRIX is defined the communication matrix is reduced
      *
      * \see MPI_Finalize
      */
     inline void Finalize() {
         if (!IsFinalized()) {
+#ifdef MEL_PROFILE
+            Profile_finalize();
+#endif
+#ifdef MEL_TRACE
+            Trace_finalize();
+#endif
+#ifdef MEL_COMM_MATRIX
+            Matrix_finalize();
+#endif
             MEL_THROW( MPI_Finalize(), "Finalize");
         }
     };
@@ -444,9 +924,275 @@ namespace MEL {
         ErrorHandlerFree(d1, args...);
     };
 
+#ifdef MEL_MEM_POOL
+#ifndef MEL_MEM_POOL_SLAB
+#define MEL_MEM_POOL_SLAB (1 << 20)
+#endif
+
+    /// \cond HIDE
+    /// Small allocations are served from size classes of 32 bytes to 32 KB, each block carrying a 16 byte header that 
+    /// records its class. Classes are carved from slabs taken from MPI_Alloc_mem, and freed blocks go back to a free list 
+    /// owned by the freeing thread. Larger allocations go straight to MPI_Alloc_mem behind the same header
+    static constexpr int MEM_POOL_CLASSES = 11;
+    static constexpr int MEM_POOL_HEADER  = 16;
+    static constexpr int MEM_POOL_BATCH   = 32;
+    static constexpr int MEM_POOL_LARGE   = -1;
+    static constexpr int MEM_POOL_MAGIC   = 0x4D454C50;
+
+    struct MemPool_block {
+        MemPool_block *next;
+    };
+
+    struct MemPool_header {
+        int32_t cls, magic;
+        int64_t bytes;
+    };
+
+    struct MemPool_global {
+        std::mutex mutex;
+        std::vector<void*> slabs;
+        MemPool_block *free[MEM_POOL_CLASSES];
+        char *cursor[MEM_POOL_CLASSES], *end[MEM_POOL_CLASSES];
+        std::atomic<long> generation, hits, misses, large;
+        std::atomic<long long> pinned;
+
+        MemPool_global() : generation(0), hits(0), misses(0), large(0), pinned(0) {
+            for (int c = 0; c < MEM_POOL_CLASSES; ++c) {
+                free[c]   = nullptr;
+                cursor[c] = end[c] = nullptr;
+            }
+        };
+    };
+
+    inline MemPool_global& MemPool_globalState() {
+        static MemPool_global global;
+        return global;
+    };
+
+    struct MemPool_cache {
+        long generation, hits, misses;
+        MemPool_block *free[MEM_POOL_CLASSES];
+        int count[MEM_POOL_CLASSES];
+
+        MemPool_cache() : hits(0), misses(0) {
+            generation = MemPool_globalState().generation;
+            for (int c = 0; c < MEM_POOL_CLASSES; ++c) {
+                free[c]  = nullptr;
+                count[c] = 0;
+            }
+        };
+
+        /// Counters are published to the global stats whenever the thread takes the lock
+        inline void flush(MemPool_global &global) {
+            global.hits   += hits;
+            global.misses += misses;
+            hits = misses = 0;
+        };
+
+        /// Blocks from before a MemPoolRelease belong to freed slabs and are forgotten
+        inline void validate(MemPool_global &global) {
+            if (generation == global.generation) return;
+            generation = global.generation;
+            for (int c = 0; c < MEM_POOL_CLASSES; ++c) {
+                free[c]  = nullptr;
+                count[c] = 0;
+            }
+        };
+
+        ~MemPool_cache() {
+            MemPool_global &global = MemPool_globalState();
+            std::lock_guard<std::mutex> lock(global.mutex);
+            flush(global);
+            validate(global);
+            for (int c = 0; c < MEM_POOL_CLASSES; ++c) {
+                while (free[c] != nullptr) {
+                    MemPool_block *b = free[c];
+                    free[c]        = b->next;
+                    b->next        = global.free[c];
+                    global.free[c] = b;
+                }
+            }
+        };
+    };
+
+    inline MemPool_cache& MemPool_threadCache() {
+        static thread_local MemPool_cache cache;
+        return cache;
+    };
+
+    inline int MemPool_class(const Aint bytes) {
+        Aint size = 32;
+        for (int c = 0; c < MEM_POOL_CLASSES; ++c, size <<= 1) {
+            if (bytes + MEM_POOL_HEADER <= size) return c;
+        }
+        return MEM_POOL_LARGE;
+    };
+
+    inline void* MemPool_large(const Aint bytes, const MPI_Info info) {
+        char *blk;
+        MEL_THROW( MPI_Alloc_mem(bytes + MEM_POOL_HEADER, info, &blk), "Mem::Alloc" );
+        MemPool_header *hdr = (MemPool_header*) blk;
+        hdr->cls   = MEM_POOL_LARGE;
+        hdr->magic = MEM_POOL_MAGIC;
+        hdr->bytes = bytes + MEM_POOL_HEADER;
+
+        MemPool_global &global = MemPool_globalState();
+        ++global.large;
+        global.pinned += hdr->bytes;
+        return blk + MEM_POOL_HEADER;
+    };
+
+    /// Move a batch of blocks of class c into the thread cache, reusing freed blocks before carving new ones
+    inline void MemPool_refill(MemPool_cache &cache, const int c) {
+        MemPool_global &global = MemPool_globalState();
+        std::lock_guard<std::mutex> lock(global.mutex);
+        cache.flush(global);
+
+        const Aint size = ((Aint) 32) << c;
+        for (int n = 0; n < MEM_POOL_BATCH; ++n) {
+            MemPool_block *b = global.free[c];
+            if (b != nullptr) {
+                global.free[c] = b->next;
+            }
+            else {
+                if (global.cursor[c] == nullptr || global.cursor[c] + size > global.end[c]) {
+                    char *slab;
+                    MEL_THROW( MPI_Alloc_mem(MEL_MEM_POOL_SLAB, MPI_INFO_NULL, &slab), "Mem::Alloc(Pool)" );
+                    global.slabs.push_back(slab);
+                    global.pinned   += MEL_MEM_POOL_SLAB;
+                    global.cursor[c] = slab;
+                    global.end[c]    = slab + MEL_MEM_POOL_SLAB;
+                }
+                b = (MemPool_block*) global.cursor[c];
+                global.cursor[c] += size;
+            }
+            b->next        = cache.free[c];
+            cache.free[c]  = b;
+            ++cache.count[c];
+        }
+    };
+
+    inline void* MemPool_alloc(const Aint bytes) {
+        const int c = MemPool_class(bytes);
+        if (c == MEM_POOL_LARGE) return MemPool_large(bytes, MPI_INFO_NULL);
+
+        MemPool_cache &cache = MemPool_threadCache();
+        cache.validate(MemPool_globalState());
+        if (cache.free[c] == nullptr) {
+            ++cache.misses;
+            MemPool_refill(cache, c);
+        }
+        else {
+            ++cache.hits;
+        }
+
+        MemPool_block *b = cache.free[c];
+        cache.free[c] = b->next;
+        --cache.count[c];
+
+        MemPool_header *hdr = (MemPool_header*) b;
+        hdr->cls   = c;
+        hdr->magic = MEM_POOL_MAGIC;
+        hdr->bytes = bytes + MEM_POOL_HEADER;
+        return ((char*) b) + MEM_POOL_HEADER;
+    };
+
+    inline void MemPool_free(void *ptr) {
+        char *blk = ((char*) ptr) - MEM_POOL_HEADER;
+        MemPool_header *hdr = (MemPool_header*) blk;
+        if (hdr->magic != MEM_POOL_MAGIC) MEL::Abort(-1, "MEL::MemFree Pointer was not allocated by MemAlloc, or was already freed!");
+
+        MemPool_global &global = MemPool_globalState();
+        const int c = hdr->cls;
+        if (c == MEM_POOL_LARGE) {
+            global.pinned -= hdr->bytes;
+            hdr->magic = 0;
+            MEL_THROW( MPI_Free_mem(blk), "Mem::Free" );
+            return;
+        }
+
+        /// The free list link overwrites the header, so a second free of the same block is caught above
+        MemPool_cache &cache = MemPool_threadCache();
+        cache.validate(global);
+        MemPool_block *b = (MemPool_block*) blk;
+        b->next       = cache.free[c];
+        cache.free[c] = b;
+        ++cache.count[c];
+
+        /// Hand surplus blocks back so memory freed by one thread can be reused by others
+        if (cache.count[c] > 2 * MEM_POOL_BATCH) {
+            std::lock_guard<std::mutex> lock(global.mutex);
+            cache.flush(global);
+            for (int n = 0; n < MEM_POOL_BATCH; ++n) {
+                MemPool_block *s = cache.free[c];
+                cache.free[c]  = s->next;
+                s->next        = global.free[c];
+                global.free[c] = s;
+            }
+            cache.count[c] -= MEM_POOL_BATCH;
+        }
+    };
+    /// \endcond
+
+    /// Statistics for the memory pool, enabled by defining MEL_MEM_POOL
+    struct MemPoolStats {
+        long long pinned;
+        long slabs, hits, misses, large;
+
+        /// The fraction of small allocations served without taking the pool lock
+        inline double hitRate() const {
+            return (hits + misses) > 0 ? ((double) hits / (double) (hits + misses)) : 0.0;
+        };
+    };
+
+    /**
+     * \ingroup  Mem
+     * Get statistics for the memory pool. Counters of other threads are included up to the last time they refilled 
+     * or returned blocks
+     *
+     * \return			Returns the bytes currently allocated through MPI_Alloc_mem, the number of slabs, small allocations 
+     *					served from a thread cache (hits) or after taking the pool lock (misses), and large allocations
+     */
+    inline MemPoolStats MemPoolGetStats() {
+        MemPool_global &global = MemPool_globalState();
+        MemPool_cache  &cache  = MemPool_threadCache();
+        std::lock_guard<std::mutex> lock(global.mutex);
+        cache.flush(global);
+
+        MemPoolStats stats;
+        stats.pinned = global.pinned;
+        stats.slabs  = global.slabs.size();
+        stats.hits   = global.hits;
+        stats.misses = global.misses;
+        stats.large  = global.large;
+        return stats;
+    };
+
+    /**
+     * \ingroup  Mem
+     * Return every pool slab to MPI_Free_mem. Only call this when no small allocation made through MemAlloc is still live, 
+     * for example before Finalize
+     */
+    inline void MemPoolRelease() {
+        MemPool_global &global = MemPool_globalState();
+        std::lock_guard<std::mutex> lock(global.mutex);
+        for (auto slab : global.slabs) {
+            MEL_THROW( MPI_Free_mem(slab), "Mem::Free(Pool)" );
+            global.pinned -= MEL_MEM_POOL_SLAB;
+        }
+        global.slabs.clear();
+        for (int c = 0; c < MEM_POOL_CLASSES; ++c) {
+            global.free[c]   = nullptr;
+            global.cursor[c] = global.end[c] = nullptr;
+        }
+        ++global.generation;
+    };
+#endif
+
     /**
      * \ingroup  Mem
-     * Allocate a block of memory for 'size' number of type T
+     * Allocate a block of memory for 'size' number of type T. When MEL_MEM_POOL is defined small blocks are served from 
+     * pooled slabs of MPI_Alloc_mem memory, and must only be released with MemFree or MemDestruct
      *
      * \see MPI_Alloc_mem
      * 
@@ -455,9 +1201,13 @@ namespace MEL {
      */
     template<typename T>
     inline T* MemAlloc(const Aint size) {
+#ifdef MEL_MEM_POOL
+        return (T*) MemPool_alloc(size * sizeof(T));
+#else
         T *ptr;
         MEL_THROW( MPI_Alloc_mem(size * sizeof(T), MPI_INFO_NULL, &ptr), "Mem::Alloc" );
         return ptr;
+#endif
     };
 
     /**
@@ -500,7 +1250,11 @@ namespace MEL {
     template<typename T>
     inline void MemFree(T *&ptr) {
         if (ptr != nullptr) {
+#ifdef MEL_MEM_POOL
+            MemPool_free((void*) ptr);
+#else
             MEL_THROW( MPI_Free_mem(ptr), "Mem::Free" );
+#endif
             ptr = nullptr;
         }
     };
@@ -535,6 +1289,47 @@ namespace MEL {
         MemFree(ptr);
     };
 
+    /**
+     * \ingroup  Mem
+     * An STL allocator drawing from MemAlloc, so that containers such as std::vector and std::basic_string hold memory 
+     * from MPI_Alloc_mem. When MEL_MEM_POOL is defined small containers are served from the memory pool
+     */
+    template<typename T>
+    struct Allocator {
+        typedef T				value_type;
+        typedef T*				pointer;
+        typedef const T*		const_pointer;
+        typedef T&				reference;
+        typedef const T&		const_reference;
+        typedef std::size_t		size_type;
+        typedef std::ptrdiff_t	difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef Allocator<U> other;
+        };
+
+        Allocator() {};
+        template<typename U>
+        Allocator(const Allocator<U> &) {};
+
+        inline T* allocate(const size_type num) {
+            return MemAlloc<T>(num);
+        };
+        inline void deallocate(T *ptr, const size_type) {
+            MemFree(ptr);
+        };
+
+        template<typename U>
+        inline bool operator==(const Allocator<U> &) const {
+            return true;
+        };
+        template<typename U>
+        inline bool operator!=(const Allocator<U> &) const {
+            return false;
+        };
+    };
+
     enum {
         PROC_NULL  = MPI_PROC_NULL,
         ANY_SOURCE = MPI_ANY_SOURCE,
@@ -589,6 +1384,24 @@ namespace MEL {
         };
     };
 
+#ifdef MEL_3
+    struct Message {
+        static const Message MESSAGE_NULL, MESSAGE_NO_PROC;
+
+        MPI_Message message;
+
+        Message() : message(MPI_MESSAGE_NULL) {};
+        explicit Message(const MPI_Message &_e) : message(_e) {};
+        inline Message& operator=(const MPI_Message &_e) {
+            message = _e;
+            return *this;
+        };
+        explicit operator MPI_Message() const {
+            return message;
+        };
+    };
+#endif
+
 #ifdef MEL_IMPLEMENTATION
     const Comm Comm::WORLD              = Comm(MPI_COMM_WORLD);
     const Comm Comm::SELF               = Comm(MPI_COMM_SELF);
@@ -597,25 +1410,253 @@ namespace MEL {
     const Group Group::GROUP_NULL       = Group(MPI_GROUP_NULL);
 
     const Request Request::REQUEST_NULL = Request(MPI_REQUEST_NULL);
+
+#ifdef MEL_3
+    const Message Message::MESSAGE_NULL    = Message(MPI_MESSAGE_NULL);
+    const Message Message::MESSAGE_NO_PROC = Message(MPI_MESSAGE_NO_PROC);
+#endif
 #endif
 
 
     typedef MPI_Status  Status;
-    typedef MPI_Info    Info;
+
+    struct Info {
+        static const Info INFO_NULL;
+
+        MPI_Info info;
+
+        Info() : info(MPI_INFO_NULL) {};
+        explicit Info(const MPI_Info &_e) : info(_e) {};
+        inline Info& operator=(const MPI_Info &_e) {
+            info = _e;
+            return *this;
+        };
+        explicit operator MPI_Info() const {
+            return info;
+        };
+
+        inline bool operator==(const Info &rhs) const {
+            return info == rhs.info;
+        };
+        inline bool operator!=(const Info &rhs) const {
+            return info != rhs.info;
+        };
+    };
+
+#ifdef MEL_IMPLEMENTATION
+    const Info Info::INFO_NULL = Info(MPI_INFO_NULL);
+#endif
 
     /**
-     * \ingroup  Comm
-     * Create a Comm error handler by directly passing the function to use
+     * \ingroup  Info
+     * Create an empty info object
      *
-     * \see MPI_Comm_create_errhandler
-     * 
-     * \param[in] func		The function to use as an error handler
-     * \return			Returns an object that MPI can use to reference the error handler
+     * \see MPI_Info_create
+     *
+     * \return			Returns a handle to the new info object
      */
-    inline ErrorHandler CommCreateErrorHandler(ErrorHandlerFunc func) {
-        MPI_Errhandler errHndl;
-        MEL_THROW( MPI_Comm_create_errhandler((MPI_Comm_errhandler_function*) func, &errHndl), "Comm::CreateErrorHandler" );
-        return ErrorHandler(errHndl);
+    inline Info InfoCreate() {
+        MPI_Info info;
+        MEL_THROW( MPI_Info_create(&info), "Info::Create" );
+        return Info(info);
+    };
+
+    /**
+     * \ingroup  Info
+     * Set a hint on an info object
+     *
+     * \see MPI_Info_set
+     *
+     * \param[in] info		The info object to modify
+     * \param[in] key		The name of the hint
+     * \param[in] value		The value of the hint
+     */
+    inline void InfoSet(const Info &info, const std::string &key, const std::string &value) {
+        MEL_THROW( MPI_Info_set((MPI_Info) info, key.c_str(), value.c_str()), "Info::Set" );
+    };
+
+    /**
+     * \ingroup  Info
+     * Set an integer hint on an info object
+     *
+     * \param[in] info		The info object to modify
+     * \param[in] key		The name of the hint
+     * \param[in] value		The value of the hint
+     */
+    inline void InfoSet(const Info &info, const std::string &key, const long long value) {
+        InfoSet(info, key, std::to_string(value));
+    };
+
+    /**
+     * \ingroup  Info
+     * Create an info object and set each of the given hints on it
+     *
+     * \param[in] hints		A std::vector of key / value pairs
+     * \return				Returns a handle to the new info object
+     */
+    inline Info InfoCreate(const std::vector<std::pair<std::string, std::string>> &hints) {
+        Info info = InfoCreate();
+        for (const auto &h : hints) InfoSet(info, h.first, h.second);
+        return info;
+    };
+
+    /**
+     * \ingroup  Info
+     * Get the value of a hint from an info object
+     *
+     * \see MPI_Info_get_valuelen, MPI_Info_get
+     *
+     * \param[in] info		The info object to query
+     * \param[in] key		The name of the hint
+     * \return				Returns a std::pair of a bool representing if the hint was set and its value
+     */
+    inline std::pair<bool, std::string> InfoGet(const Info &info, const std::string &key) {
+        int len, flag;
+        MEL_THROW( MPI_Info_get_valuelen((MPI_Info) info, key.c_str(), &len, &flag), "Info::Get(GetValueLen)" );
+        if (!flag) return std::make_pair(false, std::string());
+
+        std::vector<char> value(len + 1);
+        MEL_THROW( MPI_Info_get((MPI_Info) info, key.c_str(), len, &value[0], &flag), "Info::Get" );
+        return std::make_pair(flag != 0, std::string(&value[0], len));
+    };
+
+    /**
+     * \ingroup  Info
+     * Remove a hint from an info object
+     *
+     * \see MPI_Info_delete
+     *
+     * \param[in] info		The info object to modify
+     * \param[in] key		The name of the hint
+     */
+    inline void InfoDelete(const Info &info, const std::string &key) {
+        MEL_THROW( MPI_Info_delete((MPI_Info) info, key.c_str()), "Info::Delete" );
+    };
+
+    /**
+     * \ingroup  Info
+     * Duplicate an info object
+     *
+     * \see MPI_Info_dup
+     *
+     * \param[in] info		The info object to duplicate
+     * \return				Returns a handle to the new info object
+     */
+    inline Info InfoDuplicate(const Info &info) {
+        MPI_Info out;
+        MEL_THROW( MPI_Info_dup((MPI_Info) info, &out), "Info::Duplicate" );
+        return Info(out);
+    };
+
+    /**
+     * \ingroup  Info
+     * Free an info object
+     *
+     * \see MPI_Info_free
+     *
+     * \param[in] info		The info object to free
+     */
+    inline void InfoFree(Info &info) {
+        if (info != MEL::Info::INFO_NULL)
+            MEL_THROW( MPI_Info_free((MPI_Info*) &info), "Info::Free" );
+    };
+
+    /**
+     * \ingroup  Info
+     * Free a std::vector of info objects
+     *
+     * \param[in] infos		A std::vector of info objects to free
+     */
+    inline void InfoFree(std::vector<Info> &infos) {
+        for (auto &i : infos) InfoFree(i);
+    };
+
+    /**
+     * \ingroup  Info
+     * Free a varadic set of info objects
+     *
+     * \param[in] d0		The first info object to free
+     * \param[in] d1		The second info object to free
+     * \param[in] args		The remaining info objects to free
+     */
+    template<typename T0, typename T1, typename ...Args>
+    inline void InfoFree(T0 &d0, T1 &d1, Args &&...args) {
+        InfoFree(d0);
+        InfoFree(d1, args...);
+    };
+
+    /**
+     * \ingroup  Info
+     * Create an info object holding ROMIO hints suited to large collective checkpoint writes. Collective buffering is forced on 
+     * for writes and data sieving is disabled, as aggregators already issue large contiguous requests
+     *
+     * \param[in] cbNodes			The number of I/O aggregators. Zero leaves the choice to the implementation
+     * \param[in] cbBufferSize		The size in bytes of the buffer on each aggregator
+     * \param[in] stripingFactor	The number of storage targets to stripe newly created files over. Zero leaves the file system default
+     * \param[in] stripingUnit		The stripe size in bytes for newly created files. Zero leaves the file system default
+     * \return						Returns a handle to the new info object
+     */
+    inline Info InfoCreateWriteHeavy(const int cbNodes = 0, const int cbBufferSize = 1 << 24, const int stripingFactor = 0, const int stripingUnit = 0) {
+        Info info = InfoCreate({ { "romio_cb_write", "enable" }, 
+                                 { "romio_ds_write", "disable" },
+                                 { "access_style",   "write_mostly" } });
+        InfoSet(info, "cb_buffer_size", cbBufferSize);
+        if (cbNodes        > 0) InfoSet(info, "cb_nodes",        cbNodes);
+        if (stripingFactor > 0) InfoSet(info, "striping_factor", stripingFactor);
+        if (stripingUnit   > 0) InfoSet(info, "striping_unit",   stripingUnit);
+        return info;
+    };
+
+    /**
+     * \ingroup  Info
+     * Create an info object holding ROMIO hints suited to files that are mostly read, often in small or strided pieces. 
+     * Data sieving is enabled for reads and collective buffering is left to the implementation
+     *
+     * \param[in] dsBufferSize		The size in bytes of the data sieving read buffer
+     * \return						Returns a handle to the new info object
+     */
+    inline Info InfoCreateReadMostly(const int dsBufferSize = 1 << 22) {
+        Info info = InfoCreate({ { "romio_ds_read",  "enable" },
+                                 { "romio_cb_read",  "automatic" },
+                                 { "access_style",   "read_mostly" } });
+        InfoSet(info, "ind_rd_buffer_size", dsBufferSize);
+        return info;
+    };
+
+    /**
+     * \ingroup  Mem
+     * Allocate a block of memory for 'size' number of type T, passing hints to the allocator
+     *
+     * \see MPI_Alloc_mem
+     * 
+     * \param[in] size		The number of elements of type T to allocate
+     * \param[in] info		Hints for the allocator
+     * \return			Returns the pointer to the allocated memory
+     */
+    template<typename T>
+    inline T* MemAlloc(const Aint size, const Info &info) {
+#ifdef MEL_MEM_POOL
+        return (T*) MemPool_large(size * sizeof(T), (MPI_Info) info);
+#else
+        T *ptr;
+        MEL_THROW( MPI_Alloc_mem(size * sizeof(T), (MPI_Info) info, &ptr), "Mem::Alloc" );
+        return ptr;
+#endif
+    };
+
+    /**
+     * \ingroup  Comm
+     * Create a Comm error handler by directly passing the function to use
+     *
+     * \see MPI_Comm_create_errhandler
+     * 
+     * \param[in] func		The function to use as an error handler
+     * \return			Returns an object that MPI can use to reference the error handler
+     */
+    inline ErrorHandler CommCreateErrorHandler(ErrorHandlerFunc func) {
+        MPI_Errhandler errHndl;
+        MEL_THROW( MPI_Comm_create_errhandler((MPI_Comm_errhandler_function*) func, &errHndl), "Comm::CreateErrorHandler" );
+        return ErrorHandler(errHndl);
     };
     
     /**
@@ -825,6 +1866,7 @@ namespace MEL {
      * \param[in] comm		The comm world to free
      */
     inline void CommFree(Comm &comm) {
+        MEL_COMM_MATRIX_FORGET_COMM(comm);
         MEL_THROW( MPI_Comm_disconnect((MPI_Comm*) &comm), "Comm::Free" );
         comm = Comm::COMM_NULL;
     };
@@ -941,7 +1983,21 @@ namespace MEL {
      * \param[in] num		The length of the array
      */
     inline void Waitall(Request *ptr, int num) {
-        MEL_THROW( MPI_Waitall(num, (MPI_Request*) ptr, MPI_STATUS_IGNORE), "Comm::Waitall" );
+        MEL_THROW( MPI_Waitall(num, (MPI_Request*) ptr, MPI_STATUSES_IGNORE), "Comm::Waitall" );
+    };
+
+    /**
+     * \ingroup Sync 
+     * Blocking operation to wait until all request objects in an array have completed
+     *
+     * \see MPI_Waitall
+     *
+     * \param[in] ptr		Pointer to the array of request objects
+     * \param[in] num		The length of the array
+     * \param[out] statuses	Caller owned array of num status objects, one for each request
+     */
+    inline void Waitall(Request *ptr, int num, Status *statuses) {
+        MEL_THROW( MPI_Waitall(num, (MPI_Request*) ptr, statuses), "Comm::Waitall" );
     };
     
     /**
@@ -965,7 +2021,24 @@ namespace MEL {
      */
     inline bool Testall(Request *ptr, int num) {
         int f;
-        MEL_THROW( MPI_Testall(num, (MPI_Request*) ptr, &f, MPI_STATUS_IGNORE), "Comm::Testall" );
+        MEL_THROW( MPI_Testall(num, (MPI_Request*) ptr, &f, MPI_STATUSES_IGNORE), "Comm::Testall" );
+        return f != 0;
+    };
+
+    /**
+     * \ingroup Sync 
+     * Non-Blocking operation to test if all request objects in an array have completed
+     *
+     * \see MPI_Testall
+     *
+     * \param[in] ptr		Pointer to the array of request objects
+     * \param[in] num		The length of the array
+     * \param[out] statuses	Caller owned array of num status objects, filled in only if all requests have completed
+     * \return			Returns true if all requests have completed
+     */
+    inline bool Testall(Request *ptr, int num, Status *statuses) {
+        int f;
+        MEL_THROW( MPI_Testall(num, (MPI_Request*) ptr, &f, statuses), "Comm::Testall" );
         return f != 0;
     };
 
@@ -1035,6 +2108,44 @@ namespace MEL {
         return Testany(&rqs[0], rqs.size());
     };
 
+    /**
+     * \ingroup Sync 
+     * Blocking operation to wait until some of the request objects in an array have completed, writing into caller owned 
+     * arrays so that repeated calls do not allocate
+     *
+     * \see MPI_Waitsome
+     *
+     * \param[in] ptr		Pointer to the array of request objects
+     * \param[in] num		The length of the array
+     * \param[out] indices	Caller owned array of at least num ints, receiving the indices of the completed requests
+     * \param[out] statuses	Optional caller owned array of at least num status objects, one for each completed request
+     * \return			Returns the number of completed requests. Zero if every request was already REQUEST_NULL
+     */
+    inline int Waitsome(Request *ptr, int num, int *indices, Status *statuses = nullptr) {
+        int onum;
+        MEL_THROW( MPI_Waitsome(num, (MPI_Request*) ptr, &onum, indices, (statuses != nullptr) ? statuses : MPI_STATUSES_IGNORE), "Comm::Waitsome" );
+        return (onum == MPI_UNDEFINED) ? 0 : onum;
+    };
+
+    /**
+     * \ingroup Sync 
+     * Non-Blocking operation to test if some of the request objects in an array have completed, writing into caller owned 
+     * arrays so that repeated calls do not allocate
+     *
+     * \see MPI_Testsome
+     *
+     * \param[in] ptr		Pointer to the array of request objects
+     * \param[in] num		The length of the array
+     * \param[out] indices	Caller owned array of at least num ints, receiving the indices of the completed requests
+     * \param[out] statuses	Optional caller owned array of at least num status objects, one for each completed request
+     * \return			Returns the number of completed requests
+     */
+    inline int Testsome(Request *ptr, int num, int *indices, Status *statuses = nullptr) {
+        int onum;
+        MEL_THROW( MPI_Testsome(num, (MPI_Request*) ptr, &onum, indices, (statuses != nullptr) ? statuses : MPI_STATUSES_IGNORE), "Comm::Testsome" );
+        return (onum == MPI_UNDEFINED) ? 0 : onum;
+    };
+
     /**
      * \ingroup Sync 
      * Blocking operation to wait until some of the request objects in an array have completed
@@ -1046,9 +2157,8 @@ namespace MEL {
      * \return			Returns a std::vector of indices of the completed requests
      */
     inline std::vector<int> Waitsome(Request *ptr, int num) {
-        std::vector<int> idx(num); int onum;
-        MEL_THROW( MPI_Waitsome(num, (MPI_Request*) ptr, &onum, &idx[0], MPI_STATUS_IGNORE), "Comm::Waitsome" );
-        idx.resize(onum);
+        std::vector<int> idx(num);
+        idx.resize(Waitsome(ptr, num, &idx[0]));
         return idx;
     };
     
@@ -1074,9 +2184,8 @@ namespace MEL {
      * \return			Returns a std::vector of indices of the completed requests
      */
     inline std::vector<int> Testsome(Request *ptr, int num) {
-        std::vector<int> idx(num); int onum;
-        MEL_THROW( MPI_Testsome(num, (MPI_Request*) ptr, &onum, &idx[0], MPI_STATUS_IGNORE), "Comm::Testsome" );
-        idx.resize(onum);
+        std::vector<int> idx(num);
+        idx.resize(Testsome(ptr, num, &idx[0]));
         return idx;
     };
 
@@ -1091,6 +2200,149 @@ namespace MEL {
         return Testsome(&rqs[0], rqs.size());
     };
 
+    /**
+     * \ingroup Sync 
+     * A set of in-flight requests for polling loops. Completed requests are compacted away, so each poll costs time 
+     * proportional to the requests still active, and its buffers are reused so steady state polling does not allocate
+     */
+    struct RequestSet {
+        /// Members
+        std::vector<Request> requests;
+        std::vector<int> ids, indices, completed;
+        std::vector<Status> statuses, completedStatuses;
+    };
+
+    /**
+     * \ingroup Sync 
+     * Add a request to a set. The set takes ownership of the request and rq is set to REQUEST_NULL. A persistent 
+     * request leaves the set once it completes but is not freed, so keep a copy of its handle to restart or free it
+     *
+     * \param[in] set		The set to add to
+     * \param[in,out] rq	The request to add
+     * \param[in] id		A caller chosen id reported when the request completes
+     */
+    inline void RequestSetAdd(RequestSet &set, Request &rq, const int id) {
+        set.requests.push_back(rq);
+        set.ids.push_back(id);
+        rq = MPI_REQUEST_NULL;
+    };
+
+    /**
+     * \ingroup Sync 
+     * Get the number of requests in a set that have not completed
+     *
+     * \param[in] set		The set to query
+     * \return				Returns the number of active requests
+     */
+    inline int RequestSetSize(const RequestSet &set) {
+        return set.requests.size();
+    };
+
+    /// \cond HIDE
+    inline int RequestSet_compact(RequestSet &set, const int onum) {
+        set.completed.resize(onum);
+        set.completedStatuses.resize(onum);
+        for (int i = 0; i < onum; ++i) {
+            set.completed[i]         = set.ids[set.indices[i]];
+            set.completedStatuses[i] = set.statuses[i];
+        }
+
+        if (onum > 0) {
+            /// A persistent request stays allocated when it completes, so drop completed entries by index
+            for (int i = 0; i < onum; ++i) set.requests[set.indices[i]] = MPI_REQUEST_NULL;
+
+            int n = 0;
+            for (int i = 0; i < (int) set.requests.size(); ++i) {
+                if ((MPI_Request) set.requests[i] == MPI_REQUEST_NULL) continue;
+                set.requests[n] = set.requests[i];
+                set.ids[n]      = set.ids[i];
+                ++n;
+            }
+            set.requests.resize(n);
+            set.ids.resize(n);
+        }
+        return onum;
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Sync 
+     * Non-Blocking operation to test the requests in a set. The ids and statuses of those that completed are left in 
+     * set.completed and set.completedStatuses until the next call
+     *
+     * \see MPI_Testsome
+     *
+     * \param[in] set		The set to test
+     * \return				Returns the number of requests that completed
+     */
+    inline int RequestSetTestsome(RequestSet &set) {
+        const int num = set.requests.size();
+        set.indices.resize(num);
+        set.statuses.resize(num);
+        const int onum = (num > 0) ? Testsome(&set.requests[0], num, &set.indices[0], &set.statuses[0]) : 0;
+        return RequestSet_compact(set, onum);
+    };
+
+    /**
+     * \ingroup Sync 
+     * Blocking operation to wait until at least one request in a set completes, unless the set is empty. The ids and 
+     * statuses of those that completed are left in set.completed and set.completedStatuses until the next call
+     *
+     * \see MPI_Waitsome
+     *
+     * \param[in] set		The set to wait on
+     * \return				Returns the number of requests that completed
+     */
+    inline int RequestSetWaitsome(RequestSet &set) {
+        const int num = set.requests.size();
+        set.indices.resize(num);
+        set.statuses.resize(num);
+        const int onum = (num > 0) ? Waitsome(&set.requests[0], num, &set.indices[0], &set.statuses[0]) : 0;
+        return RequestSet_compact(set, onum);
+    };
+
+    /**
+     * \ingroup Sync 
+     * Blocking operation to wait until every request in a set has completed, emptying the set
+     *
+     * \see MPI_Waitall
+     *
+     * \param[in] set		The set to wait on
+     */
+    inline void RequestSetWaitall(RequestSet &set) {
+        if (!set.requests.empty()) Waitall(&set.requests[0], set.requests.size());
+        set.requests.clear();
+        set.ids.clear();
+    };
+
+    /// \cond HIDE
+    /// Per request data for the users of a RequestSet, stored in slots whose index is the id the request was added with. 
+    /// Slots are reused once their request completes, so the ids stay valid while the set compacts
+    template<typename T>
+    struct RequestSet_payload {
+        std::vector<T> slots;
+        std::vector<int> unused;
+
+        inline int add(T &&value) {
+            if (unused.empty()) {
+                slots.push_back(std::move(value));
+                return slots.size() - 1;
+            }
+            const int id = unused.back();
+            unused.pop_back();
+            slots[id] = std::move(value);
+            return id;
+        };
+
+        inline T take(const int id) {
+            T value = std::move(slots[id]);
+            slots[id] = T();
+            unused.push_back(id);
+            return value;
+        };
+    };
+    /// \endcond
+
     /**
      * \ingroup Comm 
      * Perform a set union of two comm groups
@@ -1518,6 +2770,152 @@ namespace MEL {
         return TypeCreateStruct(num, &datatypes[0], &blockLengths[0], &offsets[0]);
     };
 
+    /**
+     * \ingroup Datatype 
+     * Create a derived type with a new lower bound and extent, so that consecutive elements are placed at the given stride
+     *
+     * \see MPI_Type_create_resized, MPI_Type_commit
+     *
+     * \param[in] datatype		The type to resize
+     * \param[in] lb			The new lower bound in bytes
+     * \param[in] extent		The new extent in bytes
+     * \return				Returns a new type
+     */
+    inline Datatype TypeCreateResized(const Datatype &datatype, const Aint lb, const Aint extent) {
+        Datatype dt;
+        MEL_THROW( MPI_Type_create_resized((MPI_Datatype) datatype, lb, extent, (MPI_Datatype*) &dt), "Datatype::TypeResized" );
+        MEL_THROW( MPI_Type_commit((MPI_Datatype*) &dt), "Datatype::TypeCommit(TypeResized)" );
+        return dt;
+    };
+
+    /// \cond HIDE
+    /// Maps a C++ type to the Datatype used by the typed template overloads. Types without an entry are moved as raw bytes
+    template<typename T>
+    struct Datatype_registry {
+        static constexpr bool REGISTERED = false;
+        static inline Datatype get() { return Datatype::DATATYPE_NULL; };
+    };
+
+#define MEL_DATATYPE_REGISTRY(T, D)    template<> struct Datatype_registry<T> {                                                    \
+        static constexpr bool REGISTERED = true;                                                                                \
+        static inline Datatype get() { return Datatype(D); };                                                                    \
+    };
+
+    MEL_DATATYPE_REGISTRY(char,                            MPI_CHAR);
+    MEL_DATATYPE_REGISTRY(wchar_t,                        MPI_WCHAR);
+
+    MEL_DATATYPE_REGISTRY(float,                        MPI_FLOAT);
+    MEL_DATATYPE_REGISTRY(double,                        MPI_DOUBLE);
+    MEL_DATATYPE_REGISTRY(long double,                    MPI_LONG_DOUBLE);
+
+    MEL_DATATYPE_REGISTRY(int8_t,                        MPI_INT8_T);
+    MEL_DATATYPE_REGISTRY(int16_t,                        MPI_INT16_T);
+    MEL_DATATYPE_REGISTRY(int32_t,                        MPI_INT32_T);
+    MEL_DATATYPE_REGISTRY(int64_t,                        MPI_INT64_T);
+
+    MEL_DATATYPE_REGISTRY(uint8_t,                        MPI_UINT8_T);
+    MEL_DATATYPE_REGISTRY(uint16_t,                        MPI_UINT16_T);
+    MEL_DATATYPE_REGISTRY(uint32_t,                        MPI_UINT32_T);
+    MEL_DATATYPE_REGISTRY(uint64_t,                        MPI_UINT64_T);
+
+#ifdef MEL_3
+    MEL_DATATYPE_REGISTRY(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
+    MEL_DATATYPE_REGISTRY(std::complex<double>,            MPI_CXX_DOUBLE_COMPLEX);
+    MEL_DATATYPE_REGISTRY(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_DATATYPE_REGISTRY(bool,                            MPI_CXX_BOOL);
+#endif
+
+#undef MEL_DATATYPE_REGISTRY
+
+    /// The element count and type used to move num elements of T, either as the registered type or as bytes
+    template<typename T>
+    inline int Datatype_count(const int num) {
+        return Datatype_registry<T>::REGISTERED ? num : (int) (num * sizeof(T));
+    };
+
+    template<typename T>
+    inline Datatype Datatype_select(const Datatype &bytes) {
+        return Datatype_registry<T>::REGISTERED ? Datatype_registry<T>::get() : bytes;
+    };
+
+    /// A struct member, arrays of any rank become a block of their element type
+    template<typename C, typename U>
+    inline TypeStruct_Block Datatype_member(U C::*, const Aint offset) {
+        typedef typename std::remove_all_extents<U>::type E;
+        if (Datatype_registry<E>::REGISTERED) return TypeStruct_Block(Datatype_registry<E>::get(), sizeof(U) / sizeof(E), offset);
+        return TypeStruct_Block(MEL::Datatype::UNSIGNED_CHAR, sizeof(U), offset);
+    };
+
+    inline void TypeFree(Datatype &datatype);
+
+    inline Datatype Datatype_build(const Aint extent, const std::vector<TypeStruct_Block> &blocks) {
+        Datatype packed  = TypeCreateStruct(blocks);
+        Datatype resized = TypeCreateResized(packed, 0, extent);
+        MEL::TypeFree(packed);
+        return resized;
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Datatype 
+     * Get the Datatype registered for T, either an elementary type or one declared with MEL_DATATYPE
+     *
+     * \return				Returns the registered type. It is owned by MEL and must not be freed
+     */
+    template<typename T>
+    inline Datatype TypeGet() {
+        static_assert(Datatype_registry<T>::REGISTERED, "MEL::TypeGet No Datatype is registered for this type. Declare one with MEL_DATATYPE.");
+        return Datatype_registry<T>::get();
+    };
+
+    /// \cond HIDE
+#define MEL_DATATYPE_EXPAND(x) x
+#define MEL_DATATYPE_CAT_(a, b) a##b
+#define MEL_DATATYPE_CAT(a, b) MEL_DATATYPE_CAT_(a, b)
+#define MEL_DATATYPE_NARGS_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
+#define MEL_DATATYPE_NARGS(...) MEL_DATATYPE_EXPAND(MEL_DATATYPE_NARGS_(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define MEL_DATATYPE_M1(T, m) MEL::Datatype_member(&T::m, offsetof(T, m))
+#define MEL_DATATYPE_M2(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M1(T, __VA_ARGS__))
+#define MEL_DATATYPE_M3(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M2(T, __VA_ARGS__))
+#define MEL_DATATYPE_M4(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M3(T, __VA_ARGS__))
+#define MEL_DATATYPE_M5(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M4(T, __VA_ARGS__))
+#define MEL_DATATYPE_M6(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M5(T, __VA_ARGS__))
+#define MEL_DATATYPE_M7(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M6(T, __VA_ARGS__))
+#define MEL_DATATYPE_M8(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M7(T, __VA_ARGS__))
+#define MEL_DATATYPE_M9(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M8(T, __VA_ARGS__))
+#define MEL_DATATYPE_M10(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M9(T, __VA_ARGS__))
+#define MEL_DATATYPE_M11(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M10(T, __VA_ARGS__))
+#define MEL_DATATYPE_M12(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M11(T, __VA_ARGS__))
+#define MEL_DATATYPE_M13(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M12(T, __VA_ARGS__))
+#define MEL_DATATYPE_M14(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M13(T, __VA_ARGS__))
+#define MEL_DATATYPE_M15(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M14(T, __VA_ARGS__))
+#define MEL_DATATYPE_M16(T, m, ...) MEL_DATATYPE_M1(T, m), MEL_DATATYPE_EXPAND(MEL_DATATYPE_M15(T, __VA_ARGS__))
+    /// \endcond
+
+    /**
+     * \ingroup Datatype 
+     * Declares the Datatype for an aggregate struct from a list of its members, for example MEL_DATATYPE(Vec, x, y, z). 
+     * Offsets are taken with offsetof, and the type is resized to sizeof(TYPE) so arrays of the struct keep their padding.
+     * Members may be elementary types, fixed size arrays, or other types declared with MEL_DATATYPE; any other member is moved 
+     * as bytes. Once declared the typed template Send / Recv / Bcast / File overloads use the struct type rather than copying 
+     * bytes, so padding is never transmitted and heterogeneous systems convert each member. Must be used at global scope, 
+     * after MEL.hpp is included and before the first use of the type with MEL, naming the type as ::TYPE if it clashes with a 
+     * name in MEL. Up to 16 members are supported.
+     * The type is created on first use and is owned by MEL
+     */
+#define MEL_DATATYPE(TYPE, ...)                                                                                                    \
+    namespace MEL {                                                                                                                \
+        template<> struct Datatype_registry<TYPE> {                                                                                \
+            static constexpr bool REGISTERED = true;                                                                            \
+            static inline Datatype get() {                                                                                        \
+                static const Datatype dt = Datatype_build(sizeof(TYPE), {                                                        \
+                    MEL_DATATYPE_EXPAND(MEL_DATATYPE_CAT(MEL_DATATYPE_M, MEL_DATATYPE_NARGS(__VA_ARGS__))(TYPE, __VA_ARGS__))    \
+                });                                                                                                                \
+                return dt;                                                                                                        \
+            };                                                                                                                    \
+        };                                                                                                                        \
+    }
+
     /**
      * \ingroup Datatype 
      * Create a derived type representing a sub array
@@ -1566,7 +2964,7 @@ namespace MEL {
             subSizes[i] = dims[i].size;
             sizes[i]    = dims[i].extent;
         }
-        return TypeCreateSubArray(datatype, numdims, &sizes[0], &subSizes[0], &starts[0]);
+        return TypeCreateSubArray(datatype, numdims, &starts[0], &subSizes[0], &sizes[0]);
     };
 
     /**
@@ -1983,4391 +3381,8530 @@ namespace MEL {
         TypeFree(d1, args...);
     };
 
+    /// \cond HIDE
+    struct TypeCache {
+        typedef std::vector<int64_t> Key;
+
+        struct Entry {
+            Key key;
+            Datatype datatype;
+        };
+
+        /// Members
+        int capacity;
+        long hits, misses;
+        std::list<Entry> entries;
+        std::map<Key, std::list<Entry>::iterator> index;
+
+        TypeCache() : capacity(0), hits(0), misses(0) {};
+
+        /// The index holds iterators into entries, so a copy would index the original and free its types twice
+        TypeCache(const TypeCache &)            = delete;
+        TypeCache& operator=(const TypeCache &) = delete;
+
+        /// Moving a std::list keeps its iterators valid, so the index moves with it
+        TypeCache(TypeCache &&rhs) : capacity(rhs.capacity), hits(rhs.hits), misses(rhs.misses), 
+                                     entries(std::move(rhs.entries)), index(std::move(rhs.index)) {
+            rhs.entries.clear();
+            rhs.index.clear();
+        };
+        TypeCache& operator=(TypeCache &&rhs) {
+            if (this == &rhs) return *this;
+            for (auto &e : entries) TypeFree(e.datatype);
+            capacity = rhs.capacity;
+            hits     = rhs.hits;
+            misses   = rhs.misses;
+            entries  = std::move(rhs.entries);
+            index    = std::move(rhs.index);
+            rhs.entries.clear();
+            rhs.index.clear();
+            return *this;
+        };
+    };
+    /// \endcond
+
     /**
-     * \ingroup Topo 
-     * Compute the 'ideal' dimensions for a topolgy over n-processes
+     * \ingroup Datatype 
+     * Create a cache of committed derived types keyed by their construction parameters. Code that rebuilds identical 
+     * types in a loop can request them through the cache and pay for MPI_Type_commit once. Types returned by the cache 
+     * are owned by it and must not be freed with TypeFree. They remain valid until evicted, which happens only after 
+     * capacity other distinct types have been requested since they were last used, or until the cache is cleared
      *
-     * \see MPI_Dims_create
-     * 
-     * \param[in] numProcs	The number of processes in the topology
-     * \param[in] numdims	The number of dimensions in the topology
-     * \param[out] dims		Pointer to an (already allocated) array of length numdims
+     * \param[in] capacity		The maximum number of types held before the least recently used is freed
+     * \return				Returns the cache
      */
-    inline void TopoCartesianMakeDims(const int numProcs, const int numdims, int *dims) {
-        MEL_THROW( MPI_Dims_create(numProcs, numdims, dims), "Topo::Cartesian::MakeDims" );
+    inline TypeCache TypeCacheCreate(const int capacity = 64) {
+        if (capacity < 1) MEL::Abort(-1, "TypeCacheCreate Capacity must be at least one!");
+        TypeCache cache;
+        cache.capacity = capacity;
+        return cache;
     };
 
     /**
-     * \ingroup Topo 
-     * Compute the 'ideal' dimensions for a topolgy over n-processes
-     * 
-     * \param[in] comm		The comm object the topology should represent
-     * \param[in] numdims	The number of dimensions in the topology
-     * \param[out] dims		Pointer to an (already allocated) array of length numdims
+     * \ingroup Datatype 
+     * Free every type held by a cache. The cache remains usable
+     *
+     * \param[in] cache		The cache to clear
      */
-    inline void TopoCartesianMakeDims(const Comm &comm, const int numdims, int *dims) {
-        TopoCartesianMakeDims(CommSize(comm), numdims, dims);
+    inline void TypeCacheClear(TypeCache &cache) {
+        for (auto &e : cache.entries) TypeFree(e.datatype);
+        cache.entries.clear();
+        cache.index.clear();
     };
 
     /**
-     * \ingroup Topo 
-     * Compute the 'ideal' dimensions for a topolgy over n-processes
-     * 
-     * \param[in] numProcs	The number of processes in the topology
-     * \param[in] numdims	The number of dimensions in the topology
-     * \return			Returns a std::vector of dimension sizes
+     * \ingroup Datatype 
+     * Free every type held by a cache and reset its statistics
+     *
+     * \param[in] cache		The cache to free
      */
-    inline std::vector<int> TopoCartesianMakeDims(const int numProcs, const int numdims) {
-        std::vector<int> dims(numdims);
-        TopoCartesianMakeDims(numProcs, numdims, &dims[0]);
-        return dims;
+    inline void TypeCacheFree(TypeCache &cache) {
+        TypeCacheClear(cache);
+        cache.hits = cache.misses = 0;
     };
 
     /**
-     * \ingroup Topo 
-     * Compute the 'ideal' dimensions for a topolgy over n-processes
-     * 
-     * \param[in] comm		The comm object the topology should represent
-     * \param[in] numdims	The number of dimensions in the topology
-     * \return			Returns a std::vector of dimension sizes
+     * \ingroup Datatype 
+     * Get the number of requests a cache answered without creating a type
+     *
+     * \param[in] cache		The cache to query
+     * \return				Returns the hit count
      */
-    inline std::vector<int> TopoCartesianMakeDims(const Comm &comm, const int numdims) {
-        return TopoCartesianMakeDims(CommSize(comm), numdims);
+    inline long TypeCacheHits(const TypeCache &cache) {
+        return cache.hits;
     };
 
     /**
-     * \ingroup Topo 
-     * Create a cartesian topology over a comm world
+     * \ingroup Datatype 
+     * Get the number of requests that created and committed a new type
      *
-     * \see MPI_Cart_create
-     * 
-     * \param[in] comm		The comm object the topology should represent
-     * \param[in] numdims	The number of dimensions in the topology
-     * \param[in] dims		Pointer to an array of sizes of each dimension
-     * \param[in] periods	Pointer to an array of logicals representing if each dimension is periodic or not
-     * \return			Returns a Comm world with an attached topology
+     * \param[in] cache		The cache to query
+     * \return				Returns the miss count
      */
-    inline Comm TopoCartesianCreate(const Comm &comm, int numdims, const int *dims, const int *periods) {
-        MPI_Comm out_comm;
-        MEL_THROW( MPI_Cart_create((MPI_Comm) comm, numdims, dims, periods, 0, &out_comm), "Topo::Cartesian::Create");
-        return Comm(out_comm);
+    inline long TypeCacheMisses(const TypeCache &cache) {
+        return cache.misses;
     };
 
-    struct TopoCartesian_Dim {
-        int size, periodic;
+    /// \cond HIDE
+    /// Keys begin with the constructor and the Fortran handle of the base type, which is portable across implementations 
+    /// whether MPI_Datatype is an int or a pointer. Base types should be predefined or outlive the cache
+    inline TypeCache::Key TypeCache_key(const int kind, const Datatype &datatype, const int num) {
+        TypeCache::Key key;
+        key.reserve(num + 2);
+        key.push_back(kind);
+        key.push_back(MPI_Type_c2f((MPI_Datatype) datatype));
+        return key;
+    };
+
+    template<typename CREATE>
+    inline Datatype TypeCache_get(TypeCache &cache, const TypeCache::Key &key, CREATE create) {
+        auto it = cache.index.find(key);
+        if (it != cache.index.end()) {
+            /// Move to the front of the recency list
+            cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            ++cache.hits;
+            return it->second->datatype;
+        }
 
-        TopoCartesian_Dim() {};
-        TopoCartesian_Dim(const int _size, const bool _p) : size(_size), periodic(_p ? 1 : 0) {};
-        TopoCartesian_Dim(const int _size, const int _p) : size(_size), periodic(_p) {};
+        ++cache.misses;
+        if ((int) cache.entries.size() >= cache.capacity) {
+            TypeFree(cache.entries.back().datatype);
+            cache.index.erase(cache.entries.back().key);
+            cache.entries.pop_back();
+        }
+
+        TypeCache::Entry e;
+        e.key      = key;
+        e.datatype = create();
+        cache.entries.push_front(e);
+        cache.index[key] = cache.entries.begin();
+        return e.datatype;
     };
+    /// \endcond
 
     /**
-     * \ingroup Topo 
-     * Create a cartesian topology over a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a contiguous block of an elementary type
      *
-     * \param[in] comm		The comm object the topology should represent
-     * \param[in] dims		A std::vector of pairs representing dimension sizes and whether dimensions are periodic
-     * \return			Returns a Comm world with an attached topology
+     * \see MPI_Type_contiguous, MPI_Type_commit
+     *
+     * \param[in] cache		The cache that owns the returned type
+     * \param[in] datatype	The base type to use
+     * \param[in] length	The number of elements in the new type
+     * \return			Returns a type owned by the cache
      */
-    inline Comm TopoCartesianCreate(const Comm &comm, const std::vector<TopoCartesian_Dim> &dims) {
-        const int numdims = dims.size();
-        std::vector<int>    sizes(numdims);
-        std::vector<int>    periods(numdims);
+    inline Datatype TypeCreateContiguous(TypeCache &cache, const Datatype &datatype, const int length) {
+        auto key = TypeCache_key(0, datatype, 1);
+        key.push_back(length);
+        return TypeCache_get(cache, key, [&]() { return TypeCreateContiguous(datatype, length); });
+    };
 
-        for (int i = 0; i < numdims; ++i) {
-            sizes[i]    = dims[i].size;
-            periods[i]  = dims[i].periodic;
+    /**
+     * \ingroup Datatype 
+     * Get a cached derived type representing a sub array
+     *
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the parent array
+     * \param[in] dims			A std::vector of triples representing the start, sub size, and parent size of each dimension of the data
+     * \return				Returns a type owned by the cache
+     */
+    inline Datatype TypeCreateSubArray(TypeCache &cache, const Datatype &datatype, const std::vector<TypeSubArray_Dim> &dims) {
+        auto key = TypeCache_key(1, datatype, dims.size() * 3);
+        for (const auto &d : dims) {
+            key.push_back(d.start);
+            key.push_back(d.size);
+            key.push_back(d.extent);
         }
-        return TopoCartesianCreate(comm, numdims, &sizes[0], &periods[0]);
+        return TypeCache_get(cache, key, [&]() { return TypeCreateSubArray(datatype, dims); });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the number of dimensions in an attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a 1D sub array
      *
-     * \see MPI_Cartdim_get
+     * \see MPI_Type_create_subarray, MPI_Type_commit
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \return			Returns the number of dimensions in the attached cartesian topology
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the parent array
+     * \param[in] x				The start index in the x dimension
+     * \param[in] sx			The sub size in the x dimension	
+     * \param[in] dx			The parent size in the x dimension
+     * \return				Returns a type owned by the cache
      */
-    inline int TopoCartesianNumDims(const Comm &comm) {
-        int dim;
-        MEL_THROW( MPI_Cartdim_get((MPI_Comm) comm, &dim), "Topo::Cartesian::NumDims");
-        return dim;
+    inline Datatype TypeCreateSubArray1D(TypeCache &cache, const Datatype &datatype, const int x, const int sx, const int dx) {
+        return TypeCreateSubArray(cache, datatype, { TypeSubArray_Dim(x, sx, dx) });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the rank within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a 2D sub array
      *
-     * \see MPI_Cart_rank
+     * \see MPI_Type_create_subarray, MPI_Type_commit
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] coords	Pointer to an array representing the n-dim coordinates in the topology
-     * \return			Returns the rank in the attached cartesian topology
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the parent array
+     * \param[in] x				The start index in the x dimension
+     * \param[in] y				The start index in the y dimension
+     * \param[in] sx			The sub size in the x dimension	
+     * \param[in] sy			The sub size in the y dimension
+     * \param[in] dx			The parent size in the x dimension
+     * \param[in] dy			The parent size in the y dimension
+     * \return				Returns a type owned by the cache
      */
-    inline int TopoCartesianRank(const Comm &comm, const int *coords) {
-        int rank;
-        MEL_THROW( MPI_Cart_rank((MPI_Comm) comm, coords, &rank), "Topo::Cartesian::Rank");
-        return rank;
+    inline Datatype TypeCreateSubArray2D(TypeCache &cache, const Datatype &datatype,
+                                         const int x,    const int y, 
+                                         const int sx,   const int sy,
+                                         const int dx,   const int dy) {
+        return TypeCreateSubArray(cache, datatype, { TypeSubArray_Dim(y, sy, dy), TypeSubArray_Dim(x, sx, dx) });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the rank within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a 3D sub array
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] coords	A std::vector representing the n-dim coordinates in the topology
-     * \return			Returns the rank in the attached cartesian topology
+     * \see MPI_Type_create_subarray, MPI_Type_commit
+     *
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the parent array
+     * \param[in] x				The start index in the x dimension
+     * \param[in] y				The start index in the y dimension
+     * \param[in] z				The start index in the z dimension
+     * \param[in] sx			The sub size in the x dimension	
+     * \param[in] sy			The sub size in the y dimension
+     * \param[in] sz			The sub size in the z dimension
+     * \param[in] dx			The parent size in the x dimension
+     * \param[in] dy			The parent size in the y dimension
+     * \param[in] dz			The parent size in the z dimension
+     * \return				Returns a type owned by the cache
      */
-    inline int TopoCartesianRank(const Comm &comm, const std::vector<int> coords) {
-        return TopoCartesianRank(comm, &coords[0]);
+    inline Datatype TypeCreateSubArray3D(TypeCache &cache, const Datatype &datatype,
+                                         const int x,    const int y,    const int z, 
+                                         const int sx, const int sy, const int sz,
+                                         const int dx, const int dy, const int dz) {
+        return TypeCreateSubArray(cache, datatype, { TypeSubArray_Dim(z, sz, dz), TypeSubArray_Dim(y, sy, dy), TypeSubArray_Dim(x, sx, dx) });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the n-dim coordinates within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a 4D sub array
      *
-     * \see MPI_Cart_coords
+     * \see MPI_Type_create_subarray, MPI_Type_commit
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] rank		The rank within comm
-     * \param[in] numdims	The number of dimensions in the topology
-     * \param[out] coords	Pointer to an array of numdims ints representing the coordinates
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the parent array
+     * \param[in] x				The start index in the x dimension
+     * \param[in] y				The start index in the y dimension
+     * \param[in] z				The start index in the z dimension
+     * \param[in] w				The start index in the w dimension
+     * \param[in] sx			The sub size in the x dimension	
+     * \param[in] sy			The sub size in the y dimension
+     * \param[in] sz			The sub size in the z dimension
+     * \param[in] sw			The sub size in the w dimension
+     * \param[in] dx			The parent size in the x dimension
+     * \param[in] dy			The parent size in the y dimension
+     * \param[in] dz			The parent size in the z dimension
+     * \param[in] dw			The parent size in the w dimension
+     * \return				Returns a type owned by the cache
      */
-    inline void TopoCartesianCoords(const Comm &comm, const int rank, int numdims, int *coords) {
-        MEL_THROW( MPI_Cart_coords((MPI_Comm) comm, rank, numdims, coords), "Topo::Cartesian::Coords");
+    inline Datatype TypeCreateSubArray4D(TypeCache &cache, const Datatype &datatype,
+                                         const int x,  const int y,  const int z,  const int w,
+                                         const int sx, const int sy, const int sz, const int sw,
+                                         const int dx, const int dy, const int dz, const int dw) {
+        return TypeCreateSubArray(cache, datatype, { TypeSubArray_Dim(w, sw, dw), TypeSubArray_Dim(z, sz, dz), 
+                                                     TypeSubArray_Dim(y, sy, dy), TypeSubArray_Dim(x, sx, dx) });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the n-dim coordinates within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a set of contiguous blocks of the same length at different offsets
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] rank		The rank within comm
-     * \param[in] numdims	The number of dimensions in the topology
-     * \return			Returns a std::vector representing the n-dim coordinates
+     * \see MPI_Type_create_indexed_block, MPI_Type_commit
+     *
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] length		The common block length
+     * \param[in] displs		A std::vector representing the displacement of the blocks
+     * \return				Returns a type owned by the cache
      */
-    inline std::vector<int> TopoCartesianCoords(const Comm &comm, const int rank, int numdims) {
-        std::vector<int> coords(numdims);
-        TopoCartesianCoords(comm, rank, numdims, &coords[0]);
-        return coords;
+    inline Datatype TypeCreateIndexedBlock(TypeCache &cache, const Datatype &datatype, const int length, const std::vector<int> &displs) {
+        auto key = TypeCache_key(2, datatype, displs.size() + 1);
+        key.push_back(length);
+        key.insert(key.end(), displs.begin(), displs.end());
+        return TypeCache_get(cache, key, [&]() { return TypeCreateIndexedBlock(datatype, length, displs); });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the n-dim coordinates within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a strided sub array of a parent array
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] rank		The rank within comm
-     * \return			Returns a std::vector representing the n-dim coordinates
+     * \see MPI_Type_vector, MPI_Type_commit
+     *
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] num			The number of strided regions
+     * \param[in] length		The common block length of the strided regions
+     * \param[in] stride		The number of elements between each region
+     * \return				Returns a type owned by the cache
      */
-    inline std::vector<int> TopoCartesianCoords(const Comm &comm, const int rank) {
-        return TopoCartesianCoords(comm, rank, TopoCartesianNumDims(comm));
+    inline Datatype TypeCreateVector(TypeCache &cache, const Datatype &datatype, const int num, const int length, const int stride) {
+        auto key = TypeCache_key(3, datatype, 3);
+        key.push_back(num);
+        key.push_back(length);
+        key.push_back(stride);
+        return TypeCache_get(cache, key, [&]() { return TypeCreateVector(datatype, num, length, stride); });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the n-dim coordinates within the attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Get a cached derived type representing a strided sub array of a parent array, using byte offsets
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \return			Returns a std::vector representing the n-dim coordinates
+     * \see MPI_Type_create_hvector, MPI_Type_commit
+     *
+     * \param[in] cache			The cache that owns the returned type
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] num			The number of strided regions
+     * \param[in] length		The common block length of the strided regions
+     * \param[in] stride		The number of bytes between each region
+     * \return				Returns a type owned by the cache
      */
-    inline std::vector<int> TopoCartesianCoords(const Comm &comm) {
-        return TopoCartesianCoords(comm, CommRank(comm), TopoCartesianNumDims(comm));
+    inline Datatype TypeCreateHVector(TypeCache &cache, const Datatype &datatype, const int num, const int length, const Aint stride) {
+        auto key = TypeCache_key(4, datatype, 3);
+        key.push_back(num);
+        key.push_back(length);
+        key.push_back(stride);
+        return TypeCache_get(cache, key, [&]() { return TypeCreateHVector(datatype, num, length, stride); });
     };
 
     /**
-     * \ingroup Topo 
-     * Get the properties of an attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Compute an upper bound on the space needed to pack num elements of a datatype
      *
-     * \see MPI_Cart_get
+     * \see MPI_Pack_size
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] numdims	The number of dimensions in the topology
-     * \param[out] dims		Pointer to an array of n-dims size representing the sizes of each dimension
-     * \param[out] periods	Pointer to an array of n-dims size representing whether each dimension is periodic
-     * \param[out] coords	Pointer to an array of n-dims size representing the coordinate in each dimension
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] comm			The comm world the packed buffer will be used within
+     * \return				Returns the upper bound in bytes
      */
-    inline void TopoCartesianGet(const Comm &comm, int numdims, int *dims, int *periods, int *coords) {
-        MEL_THROW(MPI_Cart_get((MPI_Comm) comm, numdims, dims, periods, coords), "Topo::Cartesian::Get");
+    inline int PackSize(const int num, const Datatype &datatype, const Comm &comm) {
+        int size;
+        MEL_THROW( MPI_Pack_size(num, (MPI_Datatype) datatype, (MPI_Comm) comm, &size), "Datatype::PackSize" );
+        return size;
     };
 
     /**
-     * \ingroup Topo 
-     * Get the properties of an attached cartesian topology of a comm world
+     * \ingroup Datatype 
+     * Compute an upper bound on the space needed to pack num elements. Element type determined by template parameter
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \return			Returns a std::pair of a std::vector representing the process coordinates, and a std::vector of pairs representing the dimension sizes and periods
+     * \see MPI_Pack_size
+     *
+     * \param[in] num			The number of elements
+     * \param[in] comm			The comm world the packed buffer will be used within
+     * \return				Returns the upper bound in bytes
      */
-    inline std::pair<std::vector<int>, std::vector<TopoCartesian_Dim>> TopoCartesianGet(const Comm &comm) {
-        const int numdims = TopoCartesianNumDims(comm);
-        std::vector<int> coords(numdims), dims(numdims), periods(numdims);
-        TopoCartesianGet(comm, numdims, &dims[0], &periods[0], &coords[0]);
-
-        std::vector<TopoCartesian_Dim> r;
-        for (int i = 0; i < numdims; ++i) {
-            r[i].size        = dims[i];
-            r[i].periodic    = periods[i];
-        }
-        return std::make_pair(coords, r);
+    template<typename T>
+    inline int PackSize(const int num, const Comm &comm) {
+        return PackSize(Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR), comm);
     };
 
     /**
-     * \ingroup Topo 
-     * Compute the ranks of a left and right shifted neighbor for a given dimension within a topology
+     * \ingroup Datatype 
+     * Pack num elements of a datatype into a contiguous buffer, advancing position past the packed data
      *
-     * \see MPI_Cart_shift
+     * \see MPI_Pack
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] direction	The dimension to shift in
-     * \param[in] disp		How much to shift by
-     * \param[out] rank_prev	The left neighbour
-     * \param[out] rank_next	The right neighbour
+     * \param[in] ptr			Pointer to the elements to pack
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] buffer		The buffer to pack into
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to pack at
+     * \param[in] comm			The comm world the packed buffer will be used within
      */
-    inline void TopoCartesianShift(const Comm &comm, int direction, int disp, int &rank_prev, int &rank_next) {
-        MEL_THROW( MPI_Cart_shift((MPI_Comm) comm, direction, disp, &rank_prev, &rank_next), "Topo::Cartesian::Shift");
+    inline void Pack(const void *ptr, const int num, const Datatype &datatype, void *buffer, const int size, int &position, const Comm &comm) {
+        MEL_THROW( MPI_Pack(ptr, num, (MPI_Datatype) datatype, buffer, size, &position, (MPI_Comm) comm), "Datatype::Pack" );
     };
 
     /**
-     * \ingroup Topo 
-     * Compute the ranks of a left and right shifted neighbor for a given dimension within a topology
+     * \ingroup Datatype 
+     * Pack num elements into a contiguous buffer, advancing position past the packed data. Element type determined by template parameter
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \param[in] direction	The dimension to shift in
-     * \param[in] disp		How much to shift by
-     * \return			Returns a std::pair representing the ranks of the left and right neighbour
+     * \see MPI_Pack
+     *
+     * \param[in] ptr			Pointer to the elements to pack
+     * \param[in] num			The number of elements
+     * \param[in] buffer		The buffer to pack into
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to pack at
+     * \param[in] comm			The comm world the packed buffer will be used within
      */
-    inline std::pair<int, int> TopoCartesianShift(const Comm &comm, int direction, int disp) {
-        int rank_prev, rank_next;
-        TopoCartesianShift(comm, direction, disp, rank_prev, rank_next);
-        return std::make_pair(rank_prev, rank_next);
+    template<typename T>
+    inline void Pack(const T *ptr, const int num, void *buffer, const int size, int &position, const Comm &comm) {
+        Pack(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR), buffer, size, position, comm);
     };
 
-    struct CartesianStencil2D5P {
-        int y0, y1, x0, x1;
-
-        CartesianStencil2D5P() : y0(MEL::PROC_NULL), y1(MEL::PROC_NULL), x0(MEL::PROC_NULL), x1(MEL::PROC_NULL) {};
+    /**
+     * \ingroup Datatype 
+     * Unpack num elements of a datatype from a contiguous buffer, advancing position past the unpacked data
+     *
+     * \see MPI_Unpack
+     *
+     * \param[in] buffer		The buffer to unpack from
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to unpack from
+     * \param[out] ptr			Pointer to the elements to unpack into
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] comm			The comm world the packed buffer was used within
+     */
+    inline void Unpack(const void *buffer, const int size, int &position, void *ptr, const int num, const Datatype &datatype, const Comm &comm) {
+        MEL_THROW( MPI_Unpack(buffer, size, &position, ptr, num, (MPI_Datatype) datatype, (MPI_Comm) comm), "Datatype::Unpack" );
+    };
 
-        inline int operator[](const int i) {
-            switch (i) {
-            case 0: return y0;
-            case 1: return x1;
-            case 2: return y1;
-            case 3: return x0;
-            };
-            return MEL::PROC_NULL;
-        };
+    /**
+     * \ingroup Datatype 
+     * Unpack num elements from a contiguous buffer, advancing position past the unpacked data. Element type determined by template parameter
+     *
+     * \see MPI_Unpack
+     *
+     * \param[in] buffer		The buffer to unpack from
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to unpack from
+     * \param[out] ptr			Pointer to the elements to unpack into
+     * \param[in] num			The number of elements
+     * \param[in] comm			The comm world the packed buffer was used within
+     */
+    template<typename T>
+    inline void Unpack(const void *buffer, const int size, int &position, T *ptr, const int num, const Comm &comm) {
+        Unpack(buffer, size, position, ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR), comm);
     };
 
     /**
-     * \ingroup Topo 
-     * Create a 2D 5-point stencil of ranks representing the neighbouring processes
+     * \ingroup Datatype 
+     * Compute the exact space needed to pack num elements of a datatype in the portable external32 representation
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \return			Returns a 2D 5-point stencil of comm ranks
+     * \see MPI_Pack_external_size
+     *
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
+     * \return				Returns the size in bytes
      */
-    inline CartesianStencil2D5P TopoCartesianStencil2D5P(const Comm &comm) {
-        CartesianStencil2D5P stencil;
-        TopoCartesianShift(comm, 0, 1, stencil.x0, stencil.x1);
-        TopoCartesianShift(comm, 1, 1, stencil.y0, stencil.y1);
-        return stencil;
+    inline Aint PackExternalSize(const int num, const Datatype &datatype) {
+        Aint size;
+        MEL_THROW( MPI_Pack_external_size((char*) "external32", num, (MPI_Datatype) datatype, &size), "Datatype::PackExternalSize" );
+        return size;
     };
 
-    struct CartesianStencil2D9P {
-        int y0, y1, x0, x1, x0y0, x0y1, x1y0, x1y1;
+    /**
+     * \ingroup Datatype 
+     * Compute the exact space needed to pack num elements in the portable external32 representation. Element type determined by template parameter
+     *
+     * \see MPI_Pack_external_size
+     *
+     * \param[in] num			The number of elements
+     * \return				Returns the size in bytes
+     */
+    template<typename T>
+    inline Aint PackExternalSize(const int num) {
+        return PackExternalSize(Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
 
-        CartesianStencil2D9P() : y0(MEL::PROC_NULL), y1(MEL::PROC_NULL), x0(MEL::PROC_NULL), x1(MEL::PROC_NULL),
-                        x0y0(MEL::PROC_NULL), x0y1(MEL::PROC_NULL), x1y0(MEL::PROC_NULL), x1y1(MEL::PROC_NULL) {};
+    /**
+     * \ingroup Datatype 
+     * Pack num elements of a datatype into a buffer in the portable external32 representation, advancing position past the packed data. 
+     * The buffer can be unpacked by any MPI implementation on any architecture
+     *
+     * \see MPI_Pack_external
+     *
+     * \param[in] ptr			Pointer to the elements to pack
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
+     * \param[in] buffer		The buffer to pack into
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to pack at
+     */
+    inline void PackExternal(const void *ptr, const int num, const Datatype &datatype, void *buffer, const Aint size, Aint &position) {
+        MEL_THROW( MPI_Pack_external((char*) "external32", (void*) ptr, num, (MPI_Datatype) datatype, buffer, size, &position), "Datatype::PackExternal" );
+    };
 
-        inline int operator[](const int i) {
-            switch (i) {
-            case 0: return y0;
-            case 1: return x1y0;
-            case 2: return x1;
-            case 3: return x1y1;
-            case 4: return y1;
-            case 5: return x0y1;
-            case 6: return x0;
-            case 7: return x0y0;
-            };
-            return MEL::PROC_NULL;
-        };
+    /**
+     * \ingroup Datatype 
+     * Pack num elements into a buffer in the portable external32 representation, advancing position past the packed data. 
+     * Element type determined by template parameter. Types without a registered Datatype are packed as bytes and are not converted
+     *
+     * \see MPI_Pack_external
+     *
+     * \param[in] ptr			Pointer to the elements to pack
+     * \param[in] num			The number of elements
+     * \param[in] buffer		The buffer to pack into
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to pack at
+     */
+    template<typename T>
+    inline void PackExternal(const T *ptr, const int num, void *buffer, const Aint size, Aint &position) {
+        PackExternal(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR), buffer, size, position);
     };
 
     /**
-     * \ingroup Topo 
-     * Create a 2D 9-point stencil of ranks representing the neighbouring processes
+     * \ingroup Datatype 
+     * Unpack num elements of a datatype from a buffer in the portable external32 representation, advancing position past the unpacked data
      *
-     * \param[in] comm		The comm object the topology is attached to
-     * \return			Returns a 2D 9-point stencil of comm ranks
+     * \see MPI_Unpack_external
+     *
+     * \param[in] buffer		The buffer to unpack from
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to unpack from
+     * \param[out] ptr			Pointer to the elements to unpack into
+     * \param[in] num			The number of elements
+     * \param[in] datatype		The datatype of the elements
      */
-    inline CartesianStencil2D9P TopoCartesianStencil2D9P(const Comm &comm) {
-        CartesianStencil2D9P stencil;
-        TopoCartesianShift(comm, 0, 1, stencil.x0, stencil.x1);
-        TopoCartesianShift(comm, 1, 1, stencil.y0, stencil.y1);
-            
-        int dims[2], periods[2], coords[2];
-        TopoCartesianGet(comm, 2, dims, periods, coords);
+    inline void UnpackExternal(const void *buffer, const Aint size, Aint &position, void *ptr, const int num, const Datatype &datatype) {
+        MEL_THROW( MPI_Unpack_external((char*) "external32", (void*) buffer, size, &position, ptr, num, (MPI_Datatype) datatype), "Datatype::UnpackExternal" );
+    };
 
-        if (!(stencil.x0 == MEL::PROC_NULL || stencil.y0 == MEL::PROC_NULL)) {
-            int ncoords[2]{ coords[0] - 1, coords[1] - 1 };
-            if (ncoords[0] < 0) ncoords[0] += dims[0];
-            if (ncoords[1] < 0) ncoords[1] += dims[1];
-            stencil.x0y0 = TopoCartesianRank(comm, ncoords);
-        }
+    /**
+     * \ingroup Datatype 
+     * Unpack num elements from a buffer in the portable external32 representation, advancing position past the unpacked data. 
+     * Element type determined by template parameter
+     *
+     * \see MPI_Unpack_external
+     *
+     * \param[in] buffer		The buffer to unpack from
+     * \param[in] size			The size of the buffer in bytes
+     * \param[in,out] position	The byte position in the buffer to unpack from
+     * \param[out] ptr			Pointer to the elements to unpack into
+     * \param[in] num			The number of elements
+     */
+    template<typename T>
+    inline void UnpackExternal(const void *buffer, const Aint size, Aint &position, T *ptr, const int num) {
+        UnpackExternal(buffer, size, position, ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
 
-        if (!(stencil.x1 == MEL::PROC_NULL || stencil.y0 == MEL::PROC_NULL)) {
-            int ncoords[2]{ coords[0] + 1, coords[1] - 1 };
-            if (ncoords[0] >= dims[0]) ncoords[0] -= dims[0];
-            if (ncoords[1] < 0) ncoords[1] += dims[1];
-            stencil.x1y0 = TopoCartesianRank(comm, ncoords);
-        }
+    /**
+     * \ingroup Topo 
+     * Compute the 'ideal' dimensions for a topolgy over n-processes
+     *
+     * \see MPI_Dims_create
+     * 
+     * \param[in] numProcs	The number of processes in the topology
+     * \param[in] numdims	The number of dimensions in the topology
+     * \param[out] dims		Pointer to an (already allocated) array of length numdims
+     */
+    inline void TopoCartesianMakeDims(const int numProcs, const int numdims, int *dims) {
+        MEL_THROW( MPI_Dims_create(numProcs, numdims, dims), "Topo::Cartesian::MakeDims" );
+    };
 
-        if (!(stencil.x0 == MEL::PROC_NULL || stencil.y1 == MEL::PROC_NULL)) {
-            int ncoords[2]{ coords[0] - 1, coords[1] + 1 };
-            if (ncoords[0] < 0) ncoords[0] += dims[0];
-            if (ncoords[1] >= dims[1]) ncoords[1] -= dims[1];
-            stencil.x0y1 = TopoCartesianRank(comm, ncoords);
-        }
+    /**
+     * \ingroup Topo 
+     * Compute the 'ideal' dimensions for a topolgy over n-processes
+     * 
+     * \param[in] comm		The comm object the topology should represent
+     * \param[in] numdims	The number of dimensions in the topology
+     * \param[out] dims		Pointer to an (already allocated) array of length numdims
+     */
+    inline void TopoCartesianMakeDims(const Comm &comm, const int numdims, int *dims) {
+        TopoCartesianMakeDims(CommSize(comm), numdims, dims);
+    };
 
-        if (!(stencil.x1 == MEL::PROC_NULL || stencil.y1 == MEL::PROC_NULL)) {
-            int ncoords[2]{ coords[0] + 1, coords[1] + 1 };
-            if (ncoords[0] >= dims[0]) ncoords[0] -= dims[0];
-            if (ncoords[1] >= dims[1]) ncoords[1] -= dims[1];
-            stencil.x1y1 = TopoCartesianRank(comm, ncoords);
-        }
+    /**
+     * \ingroup Topo 
+     * Compute the 'ideal' dimensions for a topolgy over n-processes
+     * 
+     * \param[in] numProcs	The number of processes in the topology
+     * \param[in] numdims	The number of dimensions in the topology
+     * \return			Returns a std::vector of dimension sizes
+     */
+    inline std::vector<int> TopoCartesianMakeDims(const int numProcs, const int numdims) {
+        std::vector<int> dims(numdims);
+        TopoCartesianMakeDims(numProcs, numdims, &dims[0]);
+        return dims;
+    };
 
-        return stencil;
+    /**
+     * \ingroup Topo 
+     * Compute the 'ideal' dimensions for a topolgy over n-processes
+     * 
+     * \param[in] comm		The comm object the topology should represent
+     * \param[in] numdims	The number of dimensions in the topology
+     * \return			Returns a std::vector of dimension sizes
+     */
+    inline std::vector<int> TopoCartesianMakeDims(const Comm &comm, const int numdims) {
+        return TopoCartesianMakeDims(CommSize(comm), numdims);
     };
 
-    struct Op {
-        static const Op MAX,
-                        MIN,
-                        SUM,
-                        PROD,
-                        LAND,
-                        BAND,
-                        LOR,
-                        BOR,
-                        LXOR,
-                        BXOR,
-                        MINLOC,
-                        MAXLOC,
-                        REPLACE,
-#ifdef MEL_3
-                        NO_OP,
-#endif                        
-                        OP_NULL;
+    /**
+     * \ingroup Topo 
+     * Create a cartesian topology over a comm world
+     *
+     * \see MPI_Cart_create
+     * 
+     * \param[in] comm		The comm object the topology should represent
+     * \param[in] numdims	The number of dimensions in the topology
+     * \param[in] dims		Pointer to an array of sizes of each dimension
+     * \param[in] periods	Pointer to an array of logicals representing if each dimension is periodic or not
+     * \return			Returns a Comm world with an attached topology
+     */
+    inline Comm TopoCartesianCreate(const Comm &comm, int numdims, const int *dims, const int *periods) {
+        MPI_Comm out_comm;
+        MEL_THROW( MPI_Cart_create((MPI_Comm) comm, numdims, dims, periods, 0, &out_comm), "Topo::Cartesian::Create");
+        return Comm(out_comm);
+    };
 
-        MPI_Op op;
+    struct TopoCartesian_Dim {
+        int size, periodic;
 
-        Op() : op(MPI_OP_NULL) {};
-        explicit Op(const MPI_Op &_e) : op(_e) {};
-        inline Op& operator=(const MPI_Op &_e) {
-            op = _e;
-            return *this;
-        };
-        explicit operator MPI_Op() const {
-            return op;
-        };
+        TopoCartesian_Dim() {};
+        TopoCartesian_Dim(const int _size, const bool _p) : size(_size), periodic(_p ? 1 : 0) {};
+        TopoCartesian_Dim(const int _size, const int _p) : size(_size), periodic(_p) {};
     };
 
-#ifdef MEL_IMPLEMENTATION
-    const Op Op::MAX      = Op(MPI_MAX);
-    const Op Op::MIN      = Op(MPI_MIN);
-    const Op Op::SUM      = Op(MPI_SUM);
-    const Op Op::PROD     = Op(MPI_PROD);
-    const Op Op::LAND     = Op(MPI_LAND);
-    const Op Op::BAND     = Op(MPI_BAND);
-    const Op Op::LOR      = Op(MPI_LOR);
-    const Op Op::BOR      = Op(MPI_BOR);
-    const Op Op::LXOR     = Op(MPI_LXOR);
-    const Op Op::BXOR     = Op(MPI_BXOR);
-    const Op Op::MINLOC   = Op(MPI_MINLOC);
-    const Op Op::MAXLOC   = Op(MPI_MAXLOC);
-    const Op Op::REPLACE  = Op(MPI_REPLACE);
-#ifdef MEL_3
-    const Op Op::NO_OP    = Op(MPI_NO_OP);
-#endif    
-    const Op Op::OP_NULL  = Op(MPI_OP_NULL);
-#endif
-
-    namespace Functor {
-        /**
-         * \ingroup  Ops
-         * Binary Max Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the max of the two inputs
-         */
-        template<typename T>
-        T MAX(T &a, T &b) {
-            return (a > b) ? a : b;
-        };
-        
-        /**
-         * \ingroup  Ops
-         * Binary Min Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the min of the two inputs
-         */
-        template<typename T>
-        T MIN(T &a, T &b) {
-            return (a < b) ? a : b;
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary Sum Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the sum of the two inputs
-         */
-        template<typename T>
-        T SUM(T &a, T &b) {
-            return (a + b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary Product Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the product of the two inputs
-         */
-        template<typename T>
-        T PROD(T &a, T &b) {
-            return (a * b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary Logical And Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the logical and of the two inputs
-         */
-        template<typename T>
-        T LAND(T &a, T &b) {
-            return (a && b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary bitwise and Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the bitwise and of the two inputs
-         */
-        template<typename T>
-        T BAND(T &a, T &b) {
-            return (a & b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary logical or Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the logical or of the two inputs
-         */
-        template<typename T>
-        T LOR(T &a, T &b) {
-            return (a || b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary bitwise or Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the bitwise or of the two inputs
-         */
-        template<typename T>
-        T BOR(T &a, T &b) {
-            return (a | b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary logical exclusive or Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the logical exclusive or of the two inputs
-         */
-        template<typename T>
-        T LXOR(T &a, T &b) {
-            return (!a != !b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Binary bitwise exclusive or Functor
-         *
-         * \param[in] a			The left argument
-         * \param[in] b			The right argument
-         * \return				Returns the bitwise exclusive or of the two inputs
-         */
-        template<typename T>
-        T BXOR(T &a, T &b) {
-            return (a ^ b);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Maps the given binary functor to the local array of a reduction / accumulate operation
-         *
-         * \param[in] in		The left hand array for the reduction
-         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
-         * \param[in] len		Pointer to a single int representing the number of elements to be processed
-         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
-         */
-        template<typename T, T(*F)(T&, T&)>
-        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
-            for (int i = 0; i < *len; ++i) inout[i] = F(in[i], inout[i]);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Maps the given binary functor to the local array of a reduction / accumulate operation
-         *
-         * \param[in] in		The left hand array for the reduction
-         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
-         * \param[in] len		Pointer to a single int representing the number of elements to be processed
-         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
-         */
-        template<typename T, T(*F)(T&, T&, Datatype)>
-        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
-            Datatype dt((Datatype)*dptr);
-            for (int i = 0; i < *len; ++i) inout[i] = F(in[i], inout[i], dt);
-        };
-
-        /**
-         * \ingroup  Ops
-         * Maps the given binary functor to the local array of a reduction / accumulate operation
-         *
-         * \param[in] in		The left hand array for the reduction
-         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
-         * \param[in] len		Pointer to a single int representing the number of elements to be processed
-         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
-         */
-        template<typename T, void(*F)(T*, T*, int)>
-        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
-            F(in, inout, *len);
-        };
+    /**
+     * \ingroup Topo 
+     * Create a cartesian topology over a comm world
+     *
+     * \param[in] comm		The comm object the topology should represent
+     * \param[in] dims		A std::vector of pairs representing dimension sizes and whether dimensions are periodic
+     * \return			Returns a Comm world with an attached topology
+     */
+    inline Comm TopoCartesianCreate(const Comm &comm, const std::vector<TopoCartesian_Dim> &dims) {
+        const int numdims = dims.size();
+        std::vector<int>    sizes(numdims);
+        std::vector<int>    periods(numdims);
 
-        /**
-         * \ingroup  Ops
-         * Maps the given binary functor to the local array of a reduction / accumulate operation
-         *
-         * \param[in] in		The left hand array for the reduction
-         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
-         * \param[in] len		Pointer to a single int representing the number of elements to be processed
-         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
-         */
-        template<typename T, void(*F)(T*, T*, int, Datatype)>
-        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
-            F(in, inout, *len, (Datatype) *dptr);
-        };
+        for (int i = 0; i < numdims; ++i) {
+            sizes[i]    = dims[i].size;
+            periods[i]  = dims[i].periodic;
+        }
+        return TopoCartesianCreate(comm, numdims, &sizes[0], &periods[0]);
     };
 
     /**
-     * \ingroup Ops 
-     * Create a derived operation for reduction type functions
+     * \ingroup Topo 
+     * Get the number of dimensions in an attached cartesian topology of a comm world
      *
-     * \see MPI_Op_create
+     * \see MPI_Cartdim_get
      *
-     * \param[in] commute	Is the operation commutative?
-     * \return			Returns a handle to a new Op
+     * \param[in] comm		The comm object the topology is attached to
+     * \return			Returns the number of dimensions in the attached cartesian topology
      */
-    template<typename T, T(*F)(T&, T&)>
-    inline Op OpCreate(bool commute = true) {
-        MPI_Op op;
-        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
-        return Op(op);
+    inline int TopoCartesianNumDims(const Comm &comm) {
+        int dim;
+        MEL_THROW( MPI_Cartdim_get((MPI_Comm) comm, &dim), "Topo::Cartesian::NumDims");
+        return dim;
     };
 
     /**
-     * \ingroup Ops 
-     * Create a derived operation for reduction type functions
+     * \ingroup Topo 
+     * Get the rank within the attached cartesian topology of a comm world
      *
-     * \see MPI_Op_create
+     * \see MPI_Cart_rank
      *
-     * \param[in] commute	Is the operation commutative?
-     * \return			Returns a handle to a new Op
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] coords	Pointer to an array representing the n-dim coordinates in the topology
+     * \return			Returns the rank in the attached cartesian topology
      */
-    template<typename T, T(*F)(T&, T&, Datatype)>
-    inline Op OpCreate(bool commute = true) {
-        MPI_Op op;
-        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
-        return Op(op);
+    inline int TopoCartesianRank(const Comm &comm, const int *coords) {
+        int rank;
+        MEL_THROW( MPI_Cart_rank((MPI_Comm) comm, coords, &rank), "Topo::Cartesian::Rank");
+        return rank;
     };
 
     /**
-     * \ingroup Ops 
-     * Create a derived operation for reduction type functions
-     *
-     * \see MPI_Op_create
+     * \ingroup Topo 
+     * Get the rank within the attached cartesian topology of a comm world
      *
-     * \param[in] commute	Is the operation commutative?
-     * \return			Returns a handle to a new Op
-     */
-    template<typename T, void(*F)(T*, T*, int)>
-    inline Op OpCreate(bool commute = true) {
-        MPI_Op op;
-        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
-        return Op(op);
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] coords	A std::vector representing the n-dim coordinates in the topology
+     * \return			Returns the rank in the attached cartesian topology
+     */
+    inline int TopoCartesianRank(const Comm &comm, const std::vector<int> coords) {
+        return TopoCartesianRank(comm, &coords[0]);
     };
 
     /**
-     * \ingroup Ops 
-     * Create a derived operation for reduction type functions
+     * \ingroup Topo 
+     * Get the n-dim coordinates within the attached cartesian topology of a comm world
      *
-     * \see MPI_Op_create
+     * \see MPI_Cart_coords
      *
-     * \param[in] commute	Is the operation commutative?
-     * \return			Returns a handle to a new Op
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] rank		The rank within comm
+     * \param[in] numdims	The number of dimensions in the topology
+     * \param[out] coords	Pointer to an array of numdims ints representing the coordinates
      */
-    template<typename T, void(*F)(T*, T*, int, Datatype)>
-    inline Op OpCreate(bool commute = true) {
-        MPI_Op op;
-        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
-        return Op(op);
+    inline void TopoCartesianCoords(const Comm &comm, const int rank, int numdims, int *coords) {
+        MEL_THROW( MPI_Cart_coords((MPI_Comm) comm, rank, numdims, coords), "Topo::Cartesian::Coords");
     };
 
     /**
-     * \ingroup Ops 
-     * Create a derived operation for reduction type functions
-     *
-     * \see MPI_Op_create
+     * \ingroup Topo 
+     * Get the n-dim coordinates within the attached cartesian topology of a comm world
      *
-     * \param[in] commute	Is the operation commutative?
-     * \return			Returns a handle to a new Op
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] rank		The rank within comm
+     * \param[in] numdims	The number of dimensions in the topology
+     * \return			Returns a std::vector representing the n-dim coordinates
      */
-    template<typename T, void(*F)(T*, T*, int*, MPI_Datatype*)>
-    inline Op OpCreate(bool commute = true) {
-        MPI_Op op;
-        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) F, commute, (MPI_Op*) &op), "Op::CreatOp" );
-        return Op(op);
+    inline std::vector<int> TopoCartesianCoords(const Comm &comm, const int rank, int numdims) {
+        std::vector<int> coords(numdims);
+        TopoCartesianCoords(comm, rank, numdims, &coords[0]);
+        return coords;
     };
 
     /**
-     * \ingroup Ops 
-     * Free a derived operation
-     *
-     * \see MPI_Op_free
+     * \ingroup Topo 
+     * Get the n-dim coordinates within the attached cartesian topology of a comm world
      *
-     * \param[in] op		The op to free
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] rank		The rank within comm
+     * \return			Returns a std::vector representing the n-dim coordinates
      */
-    inline void OpFree(Op &op) {
-        MEL_THROW( MPI_Op_free((MPI_Op*) &op ), "Op::Free" );
+    inline std::vector<int> TopoCartesianCoords(const Comm &comm, const int rank) {
+        return TopoCartesianCoords(comm, rank, TopoCartesianNumDims(comm));
     };
 
     /**
-     * \ingroup Ops 
-     * Free a std::vector of derived operations
+     * \ingroup Topo 
+     * Get the n-dim coordinates within the attached cartesian topology of a comm world
      *
-     * \param[in] ops		A std::vector of ops to be freed
+     * \param[in] comm		The comm object the topology is attached to
+     * \return			Returns a std::vector representing the n-dim coordinates
      */
-    inline void OpFree(std::vector<Op> &ops) {
-        for (auto &e : ops) OpFree(e);
+    inline std::vector<int> TopoCartesianCoords(const Comm &comm) {
+        return TopoCartesianCoords(comm, CommRank(comm), TopoCartesianNumDims(comm));
     };
 
     /**
-     * \ingroup Ops 
-     * Free a varadic set of derived operations
+     * \ingroup Topo 
+     * Get the properties of an attached cartesian topology of a comm world
      *
-     * \param[in] d0		The first op to free
-     * \param[in] d1		The second op to free
-     * \param[in] args		The remaining ops to free
+     * \see MPI_Cart_get
+     *
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] numdims	The number of dimensions in the topology
+     * \param[out] dims		Pointer to an array of n-dims size representing the sizes of each dimension
+     * \param[out] periods	Pointer to an array of n-dims size representing whether each dimension is periodic
+     * \param[out] coords	Pointer to an array of n-dims size representing the coordinate in each dimension
      */
-    template<typename T0, typename T1, typename ...Args>
-    inline void OpFree(T0 &d0, T1 &d1, Args &&...args) {
-        OpFree(d0);
-        OpFree(d1, args...);
-    };
-
-#ifdef MEL_IMPLEMENTATION
-    const void* IN_PLACE = MPI_IN_PLACE;
-#endif
-
-    typedef MPI_File File;
-
-    enum class FileMode : int {
-        CREATE          = MPI_MODE_CREATE,
-        APPEND          = MPI_MODE_APPEND,
-        DELETE_ON_CLOSE = MPI_MODE_DELETE_ON_CLOSE,
-        EXCL            = MPI_MODE_EXCL,
-        
-        RDONLY          = MPI_MODE_RDONLY,
-        RDWR            = MPI_MODE_RDWR,    
-        WRONLY          = MPI_MODE_WRONLY,
-        
-        SEQUENTIAL      = MPI_MODE_SEQUENTIAL,
-        UNIQUE_OPEN     = MPI_MODE_UNIQUE_OPEN
+    inline void TopoCartesianGet(const Comm &comm, int numdims, int *dims, int *periods, int *coords) {
+        MEL_THROW(MPI_Cart_get((MPI_Comm) comm, numdims, dims, periods, coords), "Topo::Cartesian::Get");
     };
 
     /**
-     * Logical OR of two file access modes
+     * \ingroup Topo 
+     * Get the properties of an attached cartesian topology of a comm world
      *
-     * \param[in] a		The first file mode
-     * \param[in] b		The second file mode
-     * \return		The combined file mode
+     * \param[in] comm		The comm object the topology is attached to
+     * \return			Returns a std::pair of a std::vector representing the process coordinates, and a std::vector of pairs representing the dimension sizes and periods
      */
-    inline FileMode operator|(const FileMode &a, const FileMode &b) {
-        return static_cast<FileMode>(static_cast<int>(a) | static_cast<int>(b));
-    };
+    inline std::pair<std::vector<int>, std::vector<TopoCartesian_Dim>> TopoCartesianGet(const Comm &comm) {
+        const int numdims = TopoCartesianNumDims(comm);
+        std::vector<int> coords(numdims), dims(numdims), periods(numdims);
+        TopoCartesianGet(comm, numdims, &dims[0], &periods[0], &coords[0]);
 
-    enum class SeekMode : int {
-        SET                = MPI_SEEK_SET,
-        CUR                = MPI_SEEK_CUR,
-        END                = MPI_SEEK_END
+        std::vector<TopoCartesian_Dim> r;
+        for (int i = 0; i < numdims; ++i) {
+            r[i].size        = dims[i];
+            r[i].periodic    = periods[i];
+        }
+        return std::make_pair(coords, r);
     };
 
     /**
-     * \ingroup  File
-     * Create a file error handler
+     * \ingroup Topo 
+     * Compute the ranks of a left and right shifted neighbor for a given dimension within a topology
      *
-     * \see MPI_File_create_errhandler
+     * \see MPI_Cart_shift
      *
-     * \param[in] func	The function to use
-     * \return		Returns a handle to an error handler
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] direction	The dimension to shift in
+     * \param[in] disp		How much to shift by
+     * \param[out] rank_prev	The left neighbour
+     * \param[out] rank_next	The right neighbour
      */
-    inline ErrorHandler FileCreateErrorHandler(ErrorHandlerFunc func) {
-        MPI_Errhandler errHndl;
-        MEL_THROW( MPI_File_create_errhandler((MPI_File_errhandler_function*) func, &errHndl), "File::CreateErrorHandler" );
-        return ErrorHandler(errHndl);
+    inline void TopoCartesianShift(const Comm &comm, int direction, int disp, int &rank_prev, int &rank_next) {
+        MEL_THROW( MPI_Cart_shift((MPI_Comm) comm, direction, disp, &rank_prev, &rank_next), "Topo::Cartesian::Shift");
     };
 
     /**
-     * \ingroup  File
-     * Set the error handler for a file
-     *
-     * \see MPI_File_set_errhandler
+     * \ingroup Topo 
+     * Compute the ranks of a left and right shifted neighbor for a given dimension within a topology
      *
-     * \param[in] file		The file to attach to
-     * \param[in] errHndl	The handler to use
+     * \param[in] comm		The comm object the topology is attached to
+     * \param[in] direction	The dimension to shift in
+     * \param[in] disp		How much to shift by
+     * \return			Returns a std::pair representing the ranks of the left and right neighbour
      */
-    inline void FileSetErrorHandler(const File &file, const ErrorHandler &errHndl) {
-        MEL_THROW( MPI_File_set_errhandler(file, (MPI_Errhandler) errHndl), "File::SetErrorHandler" );
+    inline std::pair<int, int> TopoCartesianShift(const Comm &comm, int direction, int disp) {
+        int rank_prev, rank_next;
+        TopoCartesianShift(comm, direction, disp, rank_prev, rank_next);
+        return std::make_pair(rank_prev, rank_next);
     };
-    
-    /**
-     * \ingroup  File
-     * Set the error handler for a file
-     *
-     * \param[in] file	The file to attach to
-     * \param[in] func	The function to use
-     */
-    inline void FileSetErrorHandler(const File &file, ErrorHandlerFunc func) {
-        FileSetErrorHandler(file, FileCreateErrorHandler(func));
+
+    struct CartesianStencil2D5P {
+        int y0, y1, x0, x1;
+
+        CartesianStencil2D5P() : y0(MEL::PROC_NULL), y1(MEL::PROC_NULL), x0(MEL::PROC_NULL), x1(MEL::PROC_NULL) {};
+
+        inline int operator[](const int i) {
+            switch (i) {
+            case 0: return y0;
+            case 1: return x1;
+            case 2: return y1;
+            case 3: return x0;
+            };
+            return MEL::PROC_NULL;
+        };
     };
-    
+
     /**
-     * \ingroup  File
-     * Get the error handler for a file
-     *
-     * \see MPI_File_get_errhandler
+     * \ingroup Topo 
+     * Create a 2D 5-point stencil of ranks representing the neighbouring processes
      *
-     * \param[in] file	The file to attach to
-     * \return		Returns a handle to the error handler
+     * \param[in] comm		The comm object the topology is attached to
+     * \return			Returns a 2D 5-point stencil of comm ranks
      */
-    inline ErrorHandler FileGetErrorHandler(const File &file) {
-        MPI_Errhandler errHndl;
-        MEL_THROW( MPI_File_get_errhandler(file, &errHndl), "File::GetErrorHandler");
-        return ErrorHandler(errHndl);
+    inline CartesianStencil2D5P TopoCartesianStencil2D5P(const Comm &comm) {
+        CartesianStencil2D5P stencil;
+        TopoCartesianShift(comm, 0, 1, stencil.x0, stencil.x1);
+        TopoCartesianShift(comm, 1, 1, stencil.y0, stencil.y1);
+        return stencil;
     };
 
-    /**
-     * \ingroup File
-     * Get the mode a file was opened with
-     *
-     * \see MPI_File_get_amode
-     *
-     * \param[in] file	The file to attach to
-     * \return		Returns the file mode
-     */
-    inline FileMode FileGetMode(const File &file) {
-        int amode;
-        MEL_THROW( MPI_File_get_amode(file, &amode), "File::GetMode");
-        return FileMode(amode);
+    struct CartesianStencil2D9P {
+        int y0, y1, x0, x1, x0y0, x0y1, x1y0, x1y1;
+
+        CartesianStencil2D9P() : y0(MEL::PROC_NULL), y1(MEL::PROC_NULL), x0(MEL::PROC_NULL), x1(MEL::PROC_NULL),
+                        x0y0(MEL::PROC_NULL), x0y1(MEL::PROC_NULL), x1y0(MEL::PROC_NULL), x1y1(MEL::PROC_NULL) {};
+
+        inline int operator[](const int i) {
+            switch (i) {
+            case 0: return y0;
+            case 1: return x1y0;
+            case 2: return x1;
+            case 3: return x1y1;
+            case 4: return y1;
+            case 5: return x0y1;
+            case 6: return x0;
+            case 7: return x0y0;
+            };
+            return MEL::PROC_NULL;
+        };
     };
 
     /**
-     * \ingroup File
-     * Is the file opened in an atomic mode?
-     *
-     * \see MPI_File_get_atomicity
-     *
-     * \param[in] file	The file to attach to
-     * \return		Returns true is the file is opened atomically
-     */
-    inline bool FileIsAtomic(const File &file) {
-        int flag;
-        MEL_THROW( MPI_File_get_atomicity(file, &flag), "File::GetAtomicity");
-        return flag != 0;
-    };
-    
-    /**
-     * \ingroup File
-     * Set the atomicity of the file handle
-     *
-     * \see MPI_File_set_atomicity
-     *
-     * \param[in] file	The file to attach to
-     * \param[in] atom	Boolean value representing atomicity
-     */
-    inline void FileSetAtomicity(const File &file, const bool atom) {
-        MEL_THROW( MPI_File_set_atomicity(file, atom ? 1 : 0), "File::SetAtomicity");
-    };
-
-    /**
-     * \ingroup File
-     * Get the byte position of the file cursor relative to a given location
-     *
-     * \see MPI_File_get_byte_offset
+     * \ingroup Topo 
+     * Create a 2D 9-point stencil of ranks representing the neighbouring processes
      *
-     * \param[in] file		The file to attach to
-     * \param[in] offset	The relative offset to measure byte distance against
-     * \return			Returns the number of bytes from the given offset
+     * \param[in] comm		The comm object the topology is attached to
+     * \return			Returns a 2D 9-point stencil of comm ranks
      */
-    inline Offset FileGetByteOffset(const File &file, const Offset offset) {
-        Offset byteOffset;
-        MEL_THROW( MPI_File_get_byte_offset(file, offset, &byteOffset), "File::GetByteOffset" );
-        return byteOffset;
-    };
+    inline CartesianStencil2D9P TopoCartesianStencil2D9P(const Comm &comm) {
+        CartesianStencil2D9P stencil;
+        TopoCartesianShift(comm, 0, 1, stencil.x0, stencil.x1);
+        TopoCartesianShift(comm, 1, 1, stencil.y0, stencil.y1);
+            
+        int dims[2], periods[2], coords[2];
+        TopoCartesianGet(comm, 2, dims, periods, coords);
 
-    /**
-     * \ingroup File
-     * Get the comm group a file was opened as a part of
-     *
-     * \see MPI_File_get_group
-     *
-     * \param[in] file		The file to attach to
-     * \return			Returns comm group the file handle belongs to
-     */
-    inline Group FileGetGroup(const File &file) {
-        MPI_Group group;
-        MEL_THROW( MPI_File_get_group(file, &group), "File::GetGroup");
-        return Group(group);
-    };
+        if (!(stencil.x0 == MEL::PROC_NULL || stencil.y0 == MEL::PROC_NULL)) {
+            int ncoords[2]{ coords[0] - 1, coords[1] - 1 };
+            if (ncoords[0] < 0) ncoords[0] += dims[0];
+            if (ncoords[1] < 0) ncoords[1] += dims[1];
+            stencil.x0y0 = TopoCartesianRank(comm, ncoords);
+        }
 
-    /**
-     * \ingroup File
-     * Get the MPI_Info object attached to a file handle
-     *
-     * \see MPI_File_get_info
-     *
-     * \param[in] file		The file to attach to
-     * \return			Returns the info object
-     */
-    inline Info FileGetInfo(const File &file) {
-        MPI_Info info;
-        MEL_THROW( MPI_File_get_info(file, &info), "File::GetInfo");
-        return info;
-    };
+        if (!(stencil.x1 == MEL::PROC_NULL || stencil.y0 == MEL::PROC_NULL)) {
+            int ncoords[2]{ coords[0] + 1, coords[1] - 1 };
+            if (ncoords[0] >= dims[0]) ncoords[0] -= dims[0];
+            if (ncoords[1] < 0) ncoords[1] += dims[1];
+            stencil.x1y0 = TopoCartesianRank(comm, ncoords);
+        }
 
-    /**
-     * \ingroup File
-     * Set the MPI_Info object attached to a file handle
-     *
-     * \see MPI_File_set_info
-     *
-     * \param[in] file		The file to attach to
-     * \param[in] info		The info object to attach
-     */
-    inline void FileSetInfo(const File &file, const Info &info) {
-        MEL_THROW( MPI_File_set_info(file, info), "File::SetInfo");
-    };
+        if (!(stencil.x0 == MEL::PROC_NULL || stencil.y1 == MEL::PROC_NULL)) {
+            int ncoords[2]{ coords[0] - 1, coords[1] + 1 };
+            if (ncoords[0] < 0) ncoords[0] += dims[0];
+            if (ncoords[1] >= dims[1]) ncoords[1] -= dims[1];
+            stencil.x0y1 = TopoCartesianRank(comm, ncoords);
+        }
 
-    /**
-     * \ingroup File
-     * Get the position of the file cursor
-     *
-     * \see MPI_File_get_position
-     *
-     * \param[in] file		The file to attach to
-     * \return			Returns the location of the file cursor in bytes
-     */
-    inline Offset FileGetPosition(const File &file) {
-        Offset offset;
-        MEL_THROW( MPI_File_get_position(file, &offset), "File::GetPosition" );
-        return offset;
-    };
-    
-    /**
-     * \ingroup File
-     * Get the position of the shared file cursor
-     *
-     * \see MPI_File_get_position_shared
-     *
-     * \param[in] file		The file to attach to
-     * \return			Returns the location of the shared file cursor in bytes
-     */
-    inline Offset FileGetPositionShared(const File &file) {
-        Offset offset;
-        MEL_THROW( MPI_File_get_position_shared(file, &offset), "File::GetPositionShared" );
-        return offset;
-    };
+        if (!(stencil.x1 == MEL::PROC_NULL || stencil.y1 == MEL::PROC_NULL)) {
+            int ncoords[2]{ coords[0] + 1, coords[1] + 1 };
+            if (ncoords[0] >= dims[0]) ncoords[0] -= dims[0];
+            if (ncoords[1] >= dims[1]) ncoords[1] -= dims[1];
+            stencil.x1y1 = TopoCartesianRank(comm, ncoords);
+        }
 
-    /**
-     * \ingroup File
-     * Get the size of the file in bytes
-     *
-     * \see MPI_File_get_size
-     *
-     * \param[in] file		The file to attach to
-     * \return			Returns the size of the file in bytes
-     */
-    inline Offset FileGetSize(const File &file) {
-        Offset size;
-        MEL_THROW( MPI_File_get_size(file, &size), "File::GetSize" );
-        return size;
-    };
-    
-    /**
-     * \ingroup File
-     * Set the size of the file in bytes
-     *
-     * \see MPI_File_set_size
-     *
-     * \param[in] file	The file to attach to
-     * \param[in] size	The size in bytes to set the file size to
-     */
-    inline void FileSetSize(const File &file, const Offset size) {
-        MEL_THROW( MPI_File_set_size(file, size), "File::SetSize" );
-    };
-    
-    /**
-     * \ingroup File
-     * Get the extent of the derived type set to the file handle
-     *
-     * \see MPI_File_get_type_extent
-     *
-     * \param[in] file			The file to attach to
-     * \param[in] datatype		The derived datatype to measure the extent of
-     * \return					Returns the extent of the type
-     */
-    inline Aint FileGetTypeExtent(const File &file, const Datatype &datatype) {
-        Aint size;
-        MEL_THROW( MPI_File_get_type_extent(file, (MPI_Datatype) datatype, &size), "File::GetTypeExtent" );
-        return size;
+        return stencil;
     };
 
-    /**
-     * \ingroup File
-     * Open a file and return a handle to it
-     *
-     * \see MPI_File_open, MPI_File_set_errhandler
-     *
-     * \param[in] comm			The comm world to open the file with
-     * \param[in] path			The path to the desired file
-     * \param[in] amode			The file mode to open the file with
-     * \return					Returns a handle to the file pointer
-     */
-    inline File FileOpen(const Comm &comm, const std::string &path, const FileMode amode) {
-        MPI_File file;
-        MEL_THROW( MPI_File_open((MPI_Comm) comm, path.c_str(), (int) amode, MPI_INFO_NULL, &file), "File::Open");
-        MEL_THROW( MPI_File_set_errhandler(file, MPI_ERRORS_RETURN), "File::Open(SetErrorHandler)" );
-        return file;
-    };
+    struct Op {
+        static const Op MAX,
+                        MIN,
+                        SUM,
+                        PROD,
+                        LAND,
+                        BAND,
+                        LOR,
+                        BOR,
+                        LXOR,
+                        BXOR,
+                        MINLOC,
+                        MAXLOC,
+                        REPLACE,
+#ifdef MEL_3
+                        NO_OP,
+#endif                        
+                        OP_NULL;
 
-    /**
-     * \ingroup File
-     * Open a file on an individual process and return a handle to it
-     *
-     * \param[in] path			The path to the desired file
-     * \param[in] amode			The file mode to open the file with
-     * \return					Returns a handle to the file pointer
-     */
-    inline File FileOpenIndividual(const std::string &path, const FileMode amode) {
-        return FileOpen(MEL::Comm::SELF, path, amode);
-    };
+        MPI_Op op;
 
-    /**
-     * \ingroup File
-     * Delete a file by its path
-     *
-     * \see MPI_File_delete
-     *
-     * \param[in] path			The path to the file to be deleted
-     */
-    inline void FileDelete(const std::string &path) {
-        MEL_THROW( MPI_File_delete(path.c_str(), MPI_INFO_NULL), "File::Delete");
+        Op() : op(MPI_OP_NULL) {};
+        explicit Op(const MPI_Op &_e) : op(_e) {};
+        inline Op& operator=(const MPI_Op &_e) {
+            op = _e;
+            return *this;
+        };
+        explicit operator MPI_Op() const {
+            return op;
+        };
     };
 
-    /**
-     * \ingroup File
-     * Close the file attached to the given file handle
-     *
-     * \see MPI_File_close
-     *
-     * \param[in] file			The file handle to be closed
-     */
-    inline void FileClose(File &file) {
-        MEL_THROW( MPI_File_close(&file), "File::Close");
+#ifdef MEL_IMPLEMENTATION
+    const Op Op::MAX      = Op(MPI_MAX);
+    const Op Op::MIN      = Op(MPI_MIN);
+    const Op Op::SUM      = Op(MPI_SUM);
+    const Op Op::PROD     = Op(MPI_PROD);
+    const Op Op::LAND     = Op(MPI_LAND);
+    const Op Op::BAND     = Op(MPI_BAND);
+    const Op Op::LOR      = Op(MPI_LOR);
+    const Op Op::BOR      = Op(MPI_BOR);
+    const Op Op::LXOR     = Op(MPI_LXOR);
+    const Op Op::BXOR     = Op(MPI_BXOR);
+    const Op Op::MINLOC   = Op(MPI_MINLOC);
+    const Op Op::MAXLOC   = Op(MPI_MAXLOC);
+    const Op Op::REPLACE  = Op(MPI_REPLACE);
+#ifdef MEL_3
+    const Op Op::NO_OP    = Op(MPI_NO_OP);
+#endif    
+    const Op Op::OP_NULL  = Op(MPI_OP_NULL);
+#endif
+
+    namespace Functor {
+        /**
+         * \ingroup  Ops
+         * Binary Max Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the max of the two inputs
+         */
+        template<typename T>
+        T MAX(T &a, T &b) {
+            return (a > b) ? a : b;
+        };
+        
+        /**
+         * \ingroup  Ops
+         * Binary Min Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the min of the two inputs
+         */
+        template<typename T>
+        T MIN(T &a, T &b) {
+            return (a < b) ? a : b;
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary Sum Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the sum of the two inputs
+         */
+        template<typename T>
+        T SUM(T &a, T &b) {
+            return (a + b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary Product Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the product of the two inputs
+         */
+        template<typename T>
+        T PROD(T &a, T &b) {
+            return (a * b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary Logical And Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the logical and of the two inputs
+         */
+        template<typename T>
+        T LAND(T &a, T &b) {
+            return (a && b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary bitwise and Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the bitwise and of the two inputs
+         */
+        template<typename T>
+        T BAND(T &a, T &b) {
+            return (a & b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary logical or Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the logical or of the two inputs
+         */
+        template<typename T>
+        T LOR(T &a, T &b) {
+            return (a || b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary bitwise or Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the bitwise or of the two inputs
+         */
+        template<typename T>
+        T BOR(T &a, T &b) {
+            return (a | b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary logical exclusive or Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the logical exclusive or of the two inputs
+         */
+        template<typename T>
+        T LXOR(T &a, T &b) {
+            return (!a != !b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Binary bitwise exclusive or Functor
+         *
+         * \param[in] a			The left argument
+         * \param[in] b			The right argument
+         * \return				Returns the bitwise exclusive or of the two inputs
+         */
+        template<typename T>
+        T BXOR(T &a, T &b) {
+            return (a ^ b);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Maps the given binary functor to the local array of a reduction / accumulate operation
+         *
+         * \param[in] in		The left hand array for the reduction
+         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
+         * \param[in] len		Pointer to a single int representing the number of elements to be processed
+         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
+         */
+        template<typename T, T(*F)(T&, T&)>
+        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
+            for (int i = 0; i < *len; ++i) inout[i] = F(in[i], inout[i]);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Maps the given binary functor to the local array of a reduction / accumulate operation
+         *
+         * \param[in] in		The left hand array for the reduction
+         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
+         * \param[in] len		Pointer to a single int representing the number of elements to be processed
+         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
+         */
+        template<typename T, T(*F)(T&, T&, Datatype)>
+        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
+            Datatype dt((Datatype)*dptr);
+            for (int i = 0; i < *len; ++i) inout[i] = F(in[i], inout[i], dt);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Maps the given binary functor to the local array of a reduction / accumulate operation
+         *
+         * \param[in] in		The left hand array for the reduction
+         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
+         * \param[in] len		Pointer to a single int representing the number of elements to be processed
+         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
+         */
+        template<typename T, void(*F)(T*, T*, int)>
+        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
+            F(in, inout, *len);
+        };
+
+        /**
+         * \ingroup  Ops
+         * Maps the given binary functor to the local array of a reduction / accumulate operation
+         *
+         * \param[in] in		The left hand array for the reduction
+         * \param[in] inout		The right hand array for the reduction. This array is modified to reflect the result of the functor on each element
+         * \param[in] len		Pointer to a single int representing the number of elements to be processed
+         * \param[in] dptr		Pointer to a single derived datatype representing the data to be processed
+         */
+        template<typename T, void(*F)(T*, T*, int, Datatype)>
+        void ARRAY_OP_FUNC(T *in, T *inout, int *len, MPI_Datatype *dptr) {
+            F(in, inout, *len, (Datatype) *dptr);
+        };
     };
 
     /**
-     * \ingroup File
-     * Preallocate the opened file to the given size on the file system
+     * \ingroup Ops 
+     * Create a derived operation for reduction type functions
      *
-     * \see MPI_File_preallocate
+     * \see MPI_Op_create
      *
-     * \param[in] file			The file to be preallocated
-     * \param[in] fileSize		The size of the file in bytes
+     * \param[in] commute	Is the operation commutative?
+     * \return			Returns a handle to a new Op
      */
-    inline void FilePreallocate(const File &file, const Offset fileSize) {
-        MEL_THROW( MPI_File_preallocate(file, fileSize), "File::Preallocate" );
+    template<typename T, T(*F)(T&, T&)>
+    inline Op OpCreate(bool commute = true) {
+        MPI_Op op;
+        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
+        return Op(op);
     };
 
     /**
-     * \ingroup File
-     * Move the file cursor to a specific position
+     * \ingroup Ops 
+     * Create a derived operation for reduction type functions
      *
-     * \see MPI_File_seek
+     * \see MPI_Op_create
      *
-     * \param[in] file			The file
-     * \param[in] offset		The position to move the file cursor to
-     * \param[in] seekMode		The mode to move the cursor by
+     * \param[in] commute	Is the operation commutative?
+     * \return			Returns a handle to a new Op
      */
-    inline void FileSeek(const File &file, const Offset offset, const SeekMode seekMode = MEL::SeekMode::SET) {
-        MEL_THROW( MPI_File_seek(file, offset, (int) seekMode), "File::Seek" );
+    template<typename T, T(*F)(T&, T&, Datatype)>
+    inline Op OpCreate(bool commute = true) {
+        MPI_Op op;
+        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
+        return Op(op);
     };
 
     /**
-     * \ingroup File
-     * Move the shared file cursor to a specific position. The same values must be provided by all processes
+     * \ingroup Ops 
+     * Create a derived operation for reduction type functions
      *
-     * \see MPI_File_seek_shared
+     * \see MPI_Op_create
      *
-     * \param[in] file			The shared file
-     * \param[in] offset		The position to move the file cursor to
-     * \param[in] seekMode		The mode to move the cursor by
-     */
-    inline void FileSeekShared(const File &file, const Offset offset, const SeekMode seekMode = MEL::SeekMode::SET) {
-        MEL_THROW( MPI_File_seek_shared(file, offset, (int) seekMode), "File::SeekShared" );
+     * \param[in] commute	Is the operation commutative?
+     * \return			Returns a handle to a new Op
+     */
+    template<typename T, void(*F)(T*, T*, int)>
+    inline Op OpCreate(bool commute = true) {
+        MPI_Op op;
+        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
+        return Op(op);
     };
 
     /**
-     * \ingroup File
-     * Force all queued and pending disk operations on a file to be completed
+     * \ingroup Ops 
+     * Create a derived operation for reduction type functions
      *
-     * \see MPI_File_sync
+     * \see MPI_Op_create
      *
-     * \param[in] file			The file to be synchronized
+     * \param[in] commute	Is the operation commutative?
+     * \return			Returns a handle to a new Op
      */
-    inline void FileSync(const File &file) {
-        MEL_THROW( MPI_File_sync(file), "File::Sync");
-    };
-
-    /// \cond HIDE
-    struct FileView {
-        Offset offset;
-        Datatype elementaryType, fileType;
-        std::string datarep;
-        FileView() {};
-        FileView(const Offset _offset, const Datatype _elementaryType, const Datatype _fileType, const std::string &_datarep = "native") 
-                : offset(_offset), elementaryType(_elementaryType), fileType(_fileType), datarep(_datarep) {};
+    template<typename T, void(*F)(T*, T*, int, Datatype)>
+    inline Op OpCreate(bool commute = true) {
+        MPI_Op op;
+        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) Functor::ARRAY_OP_FUNC<T, F>, commute, (MPI_Op*) &op), "Op::CreatOp" );
+        return Op(op);
     };
-    /// \endcond
 
     /**
-     * \ingroup File
-     * Set the view of a file handle for subsequent read/writes
+     * \ingroup Ops 
+     * Create a derived operation for reduction type functions
      *
-     * \see MPI_File_set_view
+     * \see MPI_Op_create
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset from start of the file
-     * \param[in] elementaryType	The derived type representing the type of each element to be written
-     * \param[in] fileType			The derived type representing the structure of data to be written
-     * \param[in] datarep			String argument telling the MPI implementation how data is represented. Default is "native"
+     * \param[in] commute	Is the operation commutative?
+     * \return			Returns a handle to a new Op
      */
-    inline void FileSetView(const File &file, const Offset offset, const Datatype elementaryType, const Datatype fileType, const std::string &datarep = "native") {
-        MEL_THROW( MPI_File_set_view(file, offset, (MPI_Datatype) elementaryType, (MPI_Datatype) fileType, datarep.c_str(), MPI_INFO_NULL), "File::SetView" );    
+    template<typename T, void(*F)(T*, T*, int*, MPI_Datatype*)>
+    inline Op OpCreate(bool commute = true) {
+        MPI_Op op;
+        MEL_THROW( MPI_Op_create((void(*)(void*, void*, int*, MPI_Datatype*)) F, commute, (MPI_Op*) &op), "Op::CreatOp" );
+        return Op(op);
     };
 
     /**
-     * \ingroup File
-     * Set the view of a file handle for subsequent read/writes
+     * \ingroup Ops 
+     * Free a derived operation
      *
-     * \param[in] file				The file handle
-     * \param[in] view				A utility structure that stores the values of a file view
+     * \see MPI_Op_free
+     *
+     * \param[in] op		The op to free
      */
-    inline void FileSetView(const File &file, const FileView &view) {
-        FileSetView(file, view.offset, view.elementaryType, view.fileType, view.datarep);
+    inline void OpFree(Op &op) {
+        MEL_THROW( MPI_Op_free((MPI_Op*) &op ), "Op::Free" );
     };
 
     /**
-     * \ingroup File
-     * Get the view attached to a file handle
-     *
-     * \see MPI_File_get_view
+     * \ingroup Ops 
+     * Free a std::vector of derived operations
      *
-     * \param[in] file				The file handle
-     * \param[out] offset			Byte offset from start of the file
-     * \param[out] elementaryType	The derived type representing the type of each element to be written
-     * \param[out] fileType			The derived type representing the structure of data to be written
-     * \param[out] datarep			String argument telling the MPI implementation how data is represented. Default is "native"
+     * \param[in] ops		A std::vector of ops to be freed
      */
-    inline void FileGetView(const File &file, Offset &offset, Datatype &elementaryType, Datatype &fileType, std::string &datarep) {
-        datarep.resize(BUFSIZ);
-        MEL_THROW( MPI_File_get_view(file, &offset, (MPI_Datatype*) &elementaryType, (MPI_Datatype*) &fileType, (char*) &datarep[0]), "File::GetView" ); 
+    inline void OpFree(std::vector<Op> &ops) {
+        for (auto &e : ops) OpFree(e);
     };
 
     /**
-     * \ingroup File
-     * Get the view attached to a file handle
+     * \ingroup Ops 
+     * Free a varadic set of derived operations
      *
-     * \param[in] file				The file handle
-     * \return						Returns a utility structure that stores the values of a file view
+     * \param[in] d0		The first op to free
+     * \param[in] d1		The second op to free
+     * \param[in] args		The remaining ops to free
      */
-    inline FileView FileGetView(const File &file) {
-        FileView view;
-        FileGetView(file, view.offset, view.elementaryType, view.fileType, view.datarep);
-        return view;
+    template<typename T0, typename T1, typename ...Args>
+    inline void OpFree(T0 &d0, T1 &d1, Args &&...args) {
+        OpFree(d0);
+        OpFree(d1, args...);
+    };
+
+#ifdef MEL_IMPLEMENTATION
+    const void* IN_PLACE = MPI_IN_PLACE;
+#endif
+
+    typedef MPI_File File;
+
+    enum class FileMode : int {
+        CREATE          = MPI_MODE_CREATE,
+        APPEND          = MPI_MODE_APPEND,
+        DELETE_ON_CLOSE = MPI_MODE_DELETE_ON_CLOSE,
+        EXCL            = MPI_MODE_EXCL,
+        
+        RDONLY          = MPI_MODE_RDONLY,
+        RDWR            = MPI_MODE_RDWR,    
+        WRONLY          = MPI_MODE_WRONLY,
+        
+        SEQUENTIAL      = MPI_MODE_SEQUENTIAL,
+        UNIQUE_OPEN     = MPI_MODE_UNIQUE_OPEN
     };
 
     /**
-     * \ingroup File
-     * Write to file from a single process
-     *
-     * \see MPI_File_write
+     * Logical OR of two file access modes
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] a		The first file mode
+     * \param[in] b		The second file mode
+     * \return		The combined file mode
      */
-    inline Status FileWrite(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::Write" );
-        return status;
+    inline FileMode operator|(const FileMode &a, const FileMode &b) {
+        return static_cast<FileMode>(static_cast<int>(a) | static_cast<int>(b));
     };
-    
+
+    enum class SeekMode : int {
+        SET                = MPI_SEEK_SET,
+        CUR                = MPI_SEEK_CUR,
+        END                = MPI_SEEK_END
+    };
+
     /**
-     * \ingroup File
-     * Write to file from all processes that opened the file
+     * \ingroup  File
+     * Create a file error handler
      *
-     * \see MPI_File_write_all
+     * \see MPI_File_create_errhandler
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] func	The function to use
+     * \return		Returns a handle to an error handler
      */
-    inline Status FileWriteAll(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write_all(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAll" );
-        return status;
+    inline ErrorHandler FileCreateErrorHandler(ErrorHandlerFunc func) {
+        MPI_Errhandler errHndl;
+        MEL_THROW( MPI_File_create_errhandler((MPI_File_errhandler_function*) func, &errHndl), "File::CreateErrorHandler" );
+        return ErrorHandler(errHndl);
     };
 
     /**
-     * \ingroup File
-     * Write to file from a single process at the desired offset
+     * \ingroup  File
+     * Set the error handler for a file
      *
-     * \see MPI_File_write_at
+     * \see MPI_File_set_errhandler
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to write at
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \param[in] errHndl	The handler to use
      */
-    inline Status FileWriteAt(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write_at(file, offset, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAt" );
-        return status;
+    inline void FileSetErrorHandler(const File &file, const ErrorHandler &errHndl) {
+        MEL_THROW( MPI_File_set_errhandler(file, (MPI_Errhandler) errHndl), "File::SetErrorHandler" );
     };
     
     /**
-     * \ingroup File
-     * Write to file from all processes that opened the file at the desired offset
-     *
-     * \see MPI_File_write_at_all
+     * \ingroup  File
+     * Set the error handler for a file
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to write at
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] file	The file to attach to
+     * \param[in] func	The function to use
      */
-    inline Status FileWriteAtAll(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write_at_all(file, offset, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAtAll" );
-        return status;
+    inline void FileSetErrorHandler(const File &file, ErrorHandlerFunc func) {
+        FileSetErrorHandler(file, FileCreateErrorHandler(func));
     };
-
+    
     /**
-     * \ingroup File
-     * Write to file from all processes that opened the file in sequence
+     * \ingroup  File
+     * Get the error handler for a file
      *
-     * \see MPI_File_write_ordered
+     * \see MPI_File_get_errhandler
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] file	The file to attach to
+     * \return		Returns a handle to the error handler
      */
-    inline Status FileWriteOrdered(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write_ordered(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteOrdered" );
-        return status;
+    inline ErrorHandler FileGetErrorHandler(const File &file) {
+        MPI_Errhandler errHndl;
+        MEL_THROW( MPI_File_get_errhandler(file, &errHndl), "File::GetErrorHandler");
+        return ErrorHandler(errHndl);
     };
 
     /**
      * \ingroup File
-     * Write to file from any processes that opened the file in parallel
+     * Get the mode a file was opened with
      *
-     * \see MPI_File_write_shared
+     * \see MPI_File_get_amode
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A status object
+     * \param[in] file	The file to attach to
+     * \return		Returns the file mode
      */
-    inline Status FileWriteShared(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_write_shared(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteShared" );
-        return status;
+    inline FileMode FileGetMode(const File &file) {
+        int amode;
+        MEL_THROW( MPI_File_get_amode(file, &amode), "File::GetMode");
+        return FileMode(amode);
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from a single processes 
+     * Is the file opened in an atomic mode?
      *
-     * \see MPI_File_iwrite
+     * \see MPI_File_get_atomicity
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A request object
+     * \param[in] file	The file to attach to
+     * \return		Returns true is the file is opened atomically
      */
-    inline Request FileIwrite(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW( MPI_File_iwrite(file, sptr, snum, (MPI_Datatype) datatype, &request), "File::Iwrite" );
-        return Request(request);
+    inline bool FileIsAtomic(const File &file) {
+        int flag;
+        MEL_THROW( MPI_File_get_atomicity(file, &flag), "File::GetAtomicity");
+        return flag != 0;
     };
     
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from a single process at the desired offset
+     * Set the atomicity of the file handle
      *
-     * \see MPI_File_iwrite_at
+     * \see MPI_File_set_atomicity
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to write to
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A request object
+     * \param[in] file	The file to attach to
+     * \param[in] atom	Boolean value representing atomicity
      */
-    inline Request FileIwriteAt(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW(MPI_File_iwrite_at(file, offset, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteAt");
-        return Request(request);
+    inline void FileSetAtomicity(const File &file, const bool atom) {
+        MEL_THROW( MPI_File_set_atomicity(file, atom ? 1 : 0), "File::SetAtomicity");
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from any processes that opened the file in parallel
+     * Get the byte position of the file cursor relative to a given location
      *
-     * \see MPI_File_iwrite_shared
+     * \see MPI_File_get_byte_offset
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \param[in] datatype			The derived type representing the elements to be written
-     * \return						A request object
+     * \param[in] file		The file to attach to
+     * \param[in] offset	The relative offset to measure byte distance against
+     * \return			Returns the number of bytes from the given offset
      */
-    inline Request FileIwriteShared(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW( MPI_File_iwrite_shared(file, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteShared" );
-        return Request(request);
+    inline Offset FileGetByteOffset(const File &file, const Offset offset) {
+        Offset byteOffset;
+        MEL_THROW( MPI_File_get_byte_offset(file, offset, &byteOffset), "File::GetByteOffset" );
+        return byteOffset;
     };
 
     /**
      * \ingroup File
-     * Read from file from a single process
+     * Get the comm group a file was opened as a part of
      *
-     * \see MPI_File_read
+     * \see MPI_File_get_group
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \return			Returns comm group the file handle belongs to
      */
-    inline Status FileRead(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::Read" );
-        return status;
+    inline Group FileGetGroup(const File &file) {
+        MPI_Group group;
+        MEL_THROW( MPI_File_get_group(file, &group), "File::GetGroup");
+        return Group(group);
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file
+     * Get the MPI_Info object attached to a file handle
      *
-     * \see MPI_File_read_all
+     * \see MPI_File_get_info
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \return			Returns the info object
      */
-    inline Status FileReadAll(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read_all(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAll" );
-        return status;
+    inline Info FileGetInfo(const File &file) {
+        MPI_Info info;
+        MEL_THROW( MPI_File_get_info(file, &info), "File::GetInfo");
+        return Info(info);
     };
 
     /**
      * \ingroup File
-     * Read from file from a single process at the desired offset
+     * Set the MPI_Info object attached to a file handle
      *
-     * \see MPI_File_read_at
+     * \see MPI_File_set_info
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \param[in] info		The info object to attach
      */
-    inline Status FileReadAt(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read_at(file, offset, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAt" );
-        return status;
+    inline void FileSetInfo(const File &file, const Info &info) {
+        MEL_THROW( MPI_File_set_info(file, (MPI_Info) info), "File::SetInfo");
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file at the desired offset
+     * Get the position of the file cursor
      *
-     * \see MPI_File_read_at_all
+     * \see MPI_File_get_position
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \return			Returns the location of the file cursor in bytes
      */
-    inline Status FileReadAtAll(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read_at_all(file, offset, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAtAll" );
-        return status;
+    inline Offset FileGetPosition(const File &file) {
+        Offset offset;
+        MEL_THROW( MPI_File_get_position(file, &offset), "File::GetPosition" );
+        return offset;
+    };
+    
+    /**
+     * \ingroup File
+     * Get the position of the shared file cursor
+     *
+     * \see MPI_File_get_position_shared
+     *
+     * \param[in] file		The file to attach to
+     * \return			Returns the location of the shared file cursor in bytes
+     */
+    inline Offset FileGetPositionShared(const File &file) {
+        Offset offset;
+        MEL_THROW( MPI_File_get_position_shared(file, &offset), "File::GetPositionShared" );
+        return offset;
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file in sequence
+     * Get the size of the file in bytes
      *
-     * \see MPI_File_read_ordered
+     * \see MPI_File_get_size
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file		The file to attach to
+     * \return			Returns the size of the file in bytes
      */
-    inline Status FileReadOrdered(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read_ordered(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadOrdered" );
-        return status;
+    inline Offset FileGetSize(const File &file) {
+        Offset size;
+        MEL_THROW( MPI_File_get_size(file, &size), "File::GetSize" );
+        return size;
     };
     
     /**
      * \ingroup File
-     * Read from file from any processes that opened the file in parallel
+     * Set the size of the file in bytes
      *
-     * \see MPI_File_read_shared
+     * \see MPI_File_set_size
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A status object
+     * \param[in] file	The file to attach to
+     * \param[in] size	The size in bytes to set the file size to
      */
-    inline Status FileReadShared(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Status status;
-        MEL_THROW( MPI_File_read_shared(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadShared" );
-        return status;
+    inline void FileSetSize(const File &file, const Offset size) {
+        MEL_THROW( MPI_File_set_size(file, size), "File::SetSize" );
     };
-
+    
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from a single process
+     * Get the extent of the derived type set to the file handle
      *
-     * \see MPI_File_iread
+     * \see MPI_File_get_type_extent
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A request object
+     * \param[in] file			The file to attach to
+     * \param[in] datatype		The derived datatype to measure the extent of
+     * \return					Returns the extent of the type
      */
-    inline Request FileIread(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW( MPI_File_iread(file, rptr, rnum, (MPI_Datatype) datatype, &request), "File::Iread" );
-        return Request(request);
+    inline Aint FileGetTypeExtent(const File &file, const Datatype &datatype) {
+        Aint size;
+        MEL_THROW( MPI_File_get_type_extent(file, (MPI_Datatype) datatype, &size), "File::GetTypeExtent" );
+        return size;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from a single process at the desired offset
+     * Open a file and return a handle to it
      *
-     * \see MPI_File_iread_at
+     * \see MPI_File_open, MPI_File_set_errhandler
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A request object
+     * \param[in] comm			The comm world to open the file with
+     * \param[in] path			The path to the desired file
+     * \param[in] amode			The file mode to open the file with
+     * \param[in] info			Hints for the file system, such as those from InfoCreateWriteHeavy
+     * \return					Returns a handle to the file pointer
      */
-    inline Request FileIreadAt(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW(MPI_File_iread_at(file, offset, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadAt");
-        return Request(request);
+    inline File FileOpen(const Comm &comm, const std::string &path, const FileMode amode, const Info &info) {
+        MPI_File file;
+        MEL_THROW( MPI_File_open((MPI_Comm) comm, path.c_str(), (int) amode, (MPI_Info) info, &file), "File::Open");
+        MEL_THROW( MPI_File_set_errhandler(file, MPI_ERRORS_RETURN), "File::Open(SetErrorHandler)" );
+        return file;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from any process that opened the file in parallel
+     * Open a file and return a handle to it
      *
-     * \see MPI_File_iread_shared
+     * \param[in] comm			The comm world to open the file with
+     * \param[in] path			The path to the desired file
+     * \param[in] amode			The file mode to open the file with
+     * \return					Returns a handle to the file pointer
+     */
+    inline File FileOpen(const Comm &comm, const std::string &path, const FileMode amode) {
+        return FileOpen(comm, path, amode, MEL::Info::INFO_NULL);
+    };
+
+    /**
+     * \ingroup File
+     * Open a file on an individual process and return a handle to it
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \param[in] datatype			The derived type representing the elements to be read
-     * \return						A request object
+     * \param[in] path			The path to the desired file
+     * \param[in] amode			The file mode to open the file with
+     * \return					Returns a handle to the file pointer
      */
-    inline Request FileIreadShared(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
-        MPI_Request request;
-        MEL_THROW( MPI_File_iread_shared(file, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadShared" );
-        return Request(request);
-    };    
-
-    /// \cond HIDE
-#define MEL_FILE(T, D) inline Status FileWrite(const File &file, const T *sptr, const int snum) {                                    \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write(file, sptr, snum,  D, &status), "File::Write(#T, #D)" );                                            \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileWriteAll(const File &file, const T *sptr, const int snum) {                                                    \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write_all(file, sptr, snum,  D, &status), "File::WriteAll(#T, #D)" );                                    \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileWriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {                                \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write_at(file, offset, sptr, snum,  D, &status), "File::WriteAt(#T, #D)" );                                \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileWriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {                            \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write_at_all(file, offset, sptr, snum,  D, &status), "File::WriteAtAll(#T, #D)" );                        \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileWriteOrdered(const File &file, const T *sptr, const int snum) {                                                \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write_ordered(file, sptr, snum,  D, &status), "File::WriteOrdered(#T, #D)" );                            \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileWriteShared(const File &file, const T *sptr, const int snum) {                                                \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_write_shared(file, sptr, snum,  D, &status), "File::WriteShared(#T, #D)" );                                \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Request FileIwrite(const File &file, const T *sptr, const int snum) {                                                    \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW( MPI_File_iwrite(file, sptr, snum,  D, &request), "File::Iwrite(#T, #D)" );                                        \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                \
-    inline Request FileIwriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {                                \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW(MPI_File_iwrite_at(file, offset, sptr, snum,  D, &request), "File::IwriteAt");                                    \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                \
-    inline Request FileIwriteShared(const File &file, const T *sptr, const int snum) {                                                \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW( MPI_File_iwrite_shared(file, sptr, snum,  D, &request), "File::IwriteShared(#T, #D)" );                            \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                \
-    inline Status FileRead(const File &file, T *rptr, const int rnum) {                                                                \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read(file, rptr, rnum,  D, &status), "File::Read(#T, #D)" );                                            \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileReadAll(const File &file, T *rptr, const int rnum) {                                                            \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read_all(file, rptr, rnum,  D, &status), "File::ReadAll(#T, #D)" );                                        \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileReadAt(const File &file, const Offset offset, T *rptr, const int rnum) {                                        \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read_at(file, offset, rptr, rnum,  D, &status), "File::ReadAt(#T, #D)" );                                \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileReadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {                                    \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read_at_all(file, offset, rptr, rnum,  D, &status), "File::ReadAtAll(#T, #D)" );                        \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileReadOrdered(const File &file, T *rptr, const int rnum) {                                                        \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read_ordered(file, rptr, rnum,  D, &status), "File::ReadOrdered(#T, #D)" );                                \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Status FileReadShared(const File &file, T *rptr, const int rnum) {                                                        \
-        MPI_Status status;                                                                                                            \
-        MEL_THROW( MPI_File_read_shared(file, rptr, rnum,  D, &status), "File::ReadShared(#T, #D)" );                                \
-        return status;                                                                                                                \
-    };                                                                                                                                \
-    inline Request FileIread(const File &file, T *rptr, const int rnum) {                                                            \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW( MPI_File_iread(file, rptr, rnum,  D, &request), "File::Iread(#T, #D)" );                                            \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                \
-    inline Request FileIreadAt(const File &file, const Offset offset, T *rptr, const int rnum) {                                    \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW(MPI_File_iread_at(file, offset, rptr, rnum,  D, &request), "File::IreadAt");                                        \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                \
-    inline Request FileIreadShared(const File &file, T *rptr, const int rnum) {                                                        \
-        MPI_Request request;                                                                                                        \
-        MEL_THROW( MPI_File_iread_shared(file, rptr, rnum,  D, &request), "File::IreadShared(#T, #D)" );                            \
-        return Request(request);                                                                                                    \
-    };                                                                                                                                
-    
-    MEL_FILE(wchar_t, MPI_WCHAR);
-
-    MEL_FILE(float, MPI_FLOAT);
-    MEL_FILE(double, MPI_DOUBLE);
-    MEL_FILE(long double, MPI_LONG_DOUBLE);
-
-    MEL_FILE(int8_t, MPI_INT8_T);
-    MEL_FILE(int16_t, MPI_INT16_T);
-    MEL_FILE(int32_t, MPI_INT32_T);
-    MEL_FILE(int64_t, MPI_INT64_T);
-
-    MEL_FILE(uint8_t, MPI_UINT8_T);
-    MEL_FILE(uint16_t, MPI_UINT16_T);
-    MEL_FILE(uint32_t, MPI_UINT32_T);
-    MEL_FILE(uint64_t, MPI_UINT64_T);
-
-#ifdef MEL_3
-    MEL_FILE(std::complex<float>, MPI_CXX_FLOAT_COMPLEX);
-    MEL_FILE(std::complex<double>, MPI_CXX_DOUBLE_COMPLEX);
-    MEL_FILE(std::complex<long double>, MPI_CXX_LONG_DOUBLE_COMPLEX);
-    MEL_FILE(bool, MPI_CXX_BOOL);
-#endif
-
-#undef MEL_FILE
-    /// \endcond
+    inline File FileOpenIndividual(const std::string &path, const FileMode amode) {
+        return FileOpen(MEL::Comm::SELF, path, amode);
+    };
 
     /**
      * \ingroup File
-     * Write to file from a single process. Element size determined by template type
+     * Open a file on an individual process and return a handle to it
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \param[in] path			The path to the desired file
+     * \param[in] amode			The file mode to open the file with
+     * \param[in] info			Hints for the file system
+     * \return					Returns a handle to the file pointer
      */
-    template<typename T>
-    inline Status FileWrite(const File &file, const T *sptr, const int snum) {
-        return FileWrite(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline File FileOpenIndividual(const std::string &path, const FileMode amode, const Info &info) {
+        return FileOpen(MEL::Comm::SELF, path, amode, info);
     };
 
     /**
      * \ingroup File
-     * Write to file from a single process at the desired offset. Element size determined by template type
+     * Delete a file by its path
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to write to
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \see MPI_File_delete
+     *
+     * \param[in] path			The path to the file to be deleted
      */
-    template<typename T>
-    inline Status FileWriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {
-        return FileWriteAt(file, offset, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileDelete(const std::string &path) {
+        MEL_THROW( MPI_File_delete(path.c_str(), MPI_INFO_NULL), "File::Delete");
     };
 
     /**
      * \ingroup File
-     * Write to file from all processes that opened the file. Element size determined by template type
+     * Close the file attached to the given file handle
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \see MPI_File_close
+     *
+     * \param[in] file			The file handle to be closed
      */
-    template<typename T>
-    inline Status FileWriteAll(const File &file, const T *sptr, const int snum) {
-        return FileWriteAll(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileClose(File &file) {
+        MEL_THROW( MPI_File_close(&file), "File::Close");
     };
 
     /**
      * \ingroup File
-     * Write to file from all processes that opened the file at the desired offset. Element size determined by template type
+     * Preallocate the opened file to the given size on the file system
      *
-     * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to write to
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \see MPI_File_preallocate
+     *
+     * \param[in] file			The file to be preallocated
+     * \param[in] fileSize		The size of the file in bytes
      */
-    template<typename T>
-    inline Status FileWriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {
-        return FileWriteAtAll(file, offset, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FilePreallocate(const File &file, const Offset fileSize) {
+        MEL_THROW( MPI_File_preallocate(file, fileSize), "File::Preallocate" );
     };
 
     /**
      * \ingroup File
-     * Write to file from all processes that opened the file in sequence. Element size determined by template type
+     * Move the file cursor to a specific position
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \see MPI_File_seek
+     *
+     * \param[in] file			The file
+     * \param[in] offset		The position to move the file cursor to
+     * \param[in] seekMode		The mode to move the cursor by
      */
-    template<typename T>
-    inline Status FileWriteOrdered(const File &file, const T *sptr, const int snum) {
-        return FileWriteOrdered(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileSeek(const File &file, const Offset offset, const SeekMode seekMode = MEL::SeekMode::SET) {
+        MEL_THROW( MPI_File_seek(file, offset, (int) seekMode), "File::Seek" );
     };
 
     /**
      * \ingroup File
-     * Write to file from any processes that opened the file in parallel. Element size determined by template type
+     * Move the shared file cursor to a specific position. The same values must be provided by all processes
      *
-     * \param[in] file				The file handle
-     * \param[in] sptr				Pointer to the memory to be written
-     * \param[in] snum				The number of elements to write
-     * \return						A status object
+     * \see MPI_File_seek_shared
+     *
+     * \param[in] file			The shared file
+     * \param[in] offset		The position to move the file cursor to
+     * \param[in] seekMode		The mode to move the cursor by
      */
-    template<typename T>
-    inline Status FileWriteShared(const File &file, const T *sptr, const int snum) {
-        return FileWriteShared(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileSeekShared(const File &file, const Offset offset, const SeekMode seekMode = MEL::SeekMode::SET) {
+        MEL_THROW( MPI_File_seek_shared(file, offset, (int) seekMode), "File::SeekShared" );
     };
 
     /**
      * \ingroup File
-     * Read from file from a single process. Element size determined by template type
+     * Force all queued and pending disk operations on a file to be completed
      *
-     * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \return						A status object
+     * \see MPI_File_sync
+     *
+     * \param[in] file			The file to be synchronized
      */
-    template<typename T>
-    inline Status FileRead(const File &file, T *rptr, const int rnum) {
-        return FileRead(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileSync(const File &file) {
+        MEL_THROW( MPI_File_sync(file), "File::Sync");
+    };
+
+    /// \cond HIDE
+    struct FileView {
+        Offset offset;
+        Datatype elementaryType, fileType;
+        std::string datarep;
+        FileView() {};
+        FileView(const Offset _offset, const Datatype _elementaryType, const Datatype _fileType, const std::string &_datarep = "native") 
+                : offset(_offset), elementaryType(_elementaryType), fileType(_fileType), datarep(_datarep) {};
     };
+    /// \endcond
 
     /**
      * \ingroup File
-     * Read from file from a single process at the desired offset. Element size determined by template type
+     * Set the view of a file handle for subsequent read/writes
+     *
+     * \see MPI_File_set_view
      *
      * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \return						A status object
+     * \param[in] offset			Byte offset from start of the file
+     * \param[in] elementaryType	The derived type representing the type of each element to be written
+     * \param[in] fileType			The derived type representing the structure of data to be written
+     * \param[in] datarep			String argument telling the MPI implementation how data is represented. Default is "native"
      */
-    template<typename T>
-    inline Status FileReadAt(const File &file, const Offset offset, T *rptr, const int rnum) {
-        return FileReadAt(file, offset, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileSetView(const File &file, const Offset offset, const Datatype elementaryType, const Datatype fileType, const std::string &datarep = "native") {
+        MEL_THROW( MPI_File_set_view(file, offset, (MPI_Datatype) elementaryType, (MPI_Datatype) fileType, datarep.c_str(), MPI_INFO_NULL), "File::SetView" );    
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file. Element size determined by template type
+     * Set the view of a file handle for subsequent read/writes
      *
      * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \return						A status object
+     * \param[in] view				A utility structure that stores the values of a file view
      */
-    template<typename T>
-    inline Status FileReadAll(const File &file, T *rptr, const int rnum) {
-        return FileReadAll(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileSetView(const File &file, const FileView &view) {
+        FileSetView(file, view.offset, view.elementaryType, view.fileType, view.datarep);
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file at the desired offset. Element size determined by template type
+     * Get the view attached to a file handle
+     *
+     * \see MPI_File_get_view
      *
      * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
-     * \return						A status object
+     * \param[out] offset			Byte offset from start of the file
+     * \param[out] elementaryType	The derived type representing the type of each element to be written
+     * \param[out] fileType			The derived type representing the structure of data to be written
+     * \param[out] datarep			String argument telling the MPI implementation how data is represented. Default is "native"
      */
-    template<typename T>
-    inline Status FileReadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {
-        return FileReadAtAll(file, offset, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline void FileGetView(const File &file, Offset &offset, Datatype &elementaryType, Datatype &fileType, std::string &datarep) {
+        datarep.resize(BUFSIZ);
+        MEL_THROW( MPI_File_get_view(file, &offset, (MPI_Datatype*) &elementaryType, (MPI_Datatype*) &fileType, (char*) &datarep[0]), "File::GetView" ); 
     };
 
     /**
      * \ingroup File
-     * Read from file from all processes that opened the file in sequence. Element size determined by template type
+     * Get the view attached to a file handle
      *
      * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
+     * \return						Returns a utility structure that stores the values of a file view
+     */
+    inline FileView FileGetView(const File &file) {
+        FileView view;
+        FileGetView(file, view.offset, view.elementaryType, view.fileType, view.datarep);
+        return view;
+    };
+
+    /**
+     * \ingroup File
+     * Write to file from a single process
+     *
+     * \see MPI_File_write
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      * \return						A status object
      */
-    template<typename T>
-    inline Status FileReadOrdered(const File &file, T *rptr, const int rnum) {
-        return FileReadOrdered(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileWrite(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::Write" );
+        return status;
+    };
+    
+    /**
+     * \ingroup File
+     * Write to file from all processes that opened the file
+     *
+     * \see MPI_File_write_all
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A status object
+     */
+    inline Status FileWriteAll(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_all(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAll" );
+        return status;
     };
 
     /**
      * \ingroup File
-     * Read from file from any processes that opened the file in parallel. Element size determined by template type
+     * Write to file from a single process at the desired offset
+     *
+     * \see MPI_File_write_at
      *
      * \param[in] file				The file handle
-     * \param[out] rptr				Pointer to the memory to be read into
-     * \param[in] rnum				The number of elements to read
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      * \return						A status object
      */
-    template<typename T>
-    inline Status FileReadShared(const File &file, T *rptr, const int rnum) {
-        return FileReadShared(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileWriteAt(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_at(file, offset, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAt" );
+        return status;
+    };
+    
+    /**
+     * \ingroup File
+     * Write to file from all processes that opened the file at the desired offset
+     *
+     * \see MPI_File_write_at_all
+     *
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A status object
+     */
+    inline Status FileWriteAtAll(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_at_all(file, offset, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteAtAll" );
+        return status;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from a single process. Element size determined by template type
+     * Write to file from all processes that opened the file in sequence
+     *
+     * \see MPI_File_write_ordered
      *
      * \param[in] file				The file handle
      * \param[in] sptr				Pointer to the memory to be written
      * \param[in] snum				The number of elements to write
-     * \return						A request object
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A status object
      */
-    template<typename T>
-    inline Request FileIwrite(const File &file, const T *sptr, const int snum) {
-        return FileIwrite(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileWriteOrdered(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_ordered(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteOrdered" );
+        return status;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from all processes that opened the file at the desired offset. Element size determined by template type
+     * Write to file from any processes that opened the file in parallel
+     *
+     * \see MPI_File_write_shared
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A status object
+     */
+    inline Status FileWriteShared(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_shared(file, sptr, snum, (MPI_Datatype) datatype, &status), "File::WriteShared" );
+        return status;
+    };
+
+    /**
+     * \ingroup File
+     * Non-Blocking. Write to file from a single processes 
+     *
+     * \see MPI_File_iwrite
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A request object
+     */
+    inline Request FileIwrite(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_iwrite(file, sptr, snum, (MPI_Datatype) datatype, &request), "File::Iwrite" );
+        return Request(request);
+    };
+    
+    /**
+     * \ingroup File
+     * Non-Blocking. Write to file from a single process at the desired offset
+     *
+     * \see MPI_File_iwrite_at
      *
      * \param[in] file				The file handle
      * \param[in] offset			Byte offset into the file to write to
      * \param[in] sptr				Pointer to the memory to be written
      * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      * \return						A request object
      */
-    template<typename T>
-    inline Request FileIwriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {
-        return FileIwriteAt(file, offset, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Request FileIwriteAt(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW(MPI_File_iwrite_at(file, offset, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteAt");
+        return Request(request);
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Write to file from any processes that opened the file in parallel. Element size determined by template type
+     * Non-Blocking. Write to file from any processes that opened the file in parallel
+     *
+     * \see MPI_File_iwrite_shared
      *
      * \param[in] file				The file handle
      * \param[in] sptr				Pointer to the memory to be written
      * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      * \return						A request object
      */
-    template<typename T>
-    inline Request FileIwriteShared(const File &file, const T *sptr, const int snum) {
-        return FileIwriteShared(file, sptr, snum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Request FileIwriteShared(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_iwrite_shared(file, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteShared" );
+        return Request(request);
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from a single process. Element size determined by template type
+     * Read from file from a single process
+     *
+     * \see MPI_File_read
      *
      * \param[in] file				The file handle
      * \param[out] rptr				Pointer to the memory to be read into
      * \param[in] rnum				The number of elements to read
-     * \return						A request object
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
      */
-    template<typename T>
-    inline Request FileIread(const File &file, T *rptr, const int rnum) {
-        return FileIread(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileRead(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::Read" );
+        return status;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from a single process at the desired offset. Element size determined by template type
+     * Read from file from all processes that opened the file
+     *
+     * \see MPI_File_read_all
      *
      * \param[in] file				The file handle
-     * \param[in] offset			Byte offset into the file to read from
      * \param[out] rptr				Pointer to the memory to be read into
      * \param[in] rnum				The number of elements to read
-     * \return						A request object
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
      */
-    template<typename T>
-    inline Request FileIreadAt(const File &file, const Offset offset, T *rptr, const int rnum) {
-        return FileIreadAt(file, offset, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileReadAll(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_all(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAll" );
+        return status;
     };
 
     /**
      * \ingroup File
-     * Non-Blocking. Read from file from any processes that opened the file in parallel. Element size determined by template type
+     * Read from file from a single process at the desired offset
+     *
+     * \see MPI_File_read_at
      *
      * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
      * \param[out] rptr				Pointer to the memory to be read into
      * \param[in] rnum				The number of elements to read
-     * \return						A request object
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
      */
-    template<typename T>
-    inline Request FileIreadShared(const File &file, T *rptr, const int rnum) {
-        return FileIreadShared(file, rptr, rnum * sizeof(T), MEL::Datatype::UNSIGNED_CHAR);
+    inline Status FileReadAt(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_at(file, offset, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAt" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Send num elements of a derived type from the given address
+     * \ingroup File
+     * Read from file from all processes that opened the file at the desired offset
      *
-     * \see MPI_Send
+     * \see MPI_File_read_at_all
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
      */
-    inline void Send(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                
-        MEL_THROW( MPI_Send(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Send" );                                            
-    };                                                                                                                                
-    
+    inline Status FileReadAtAll(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_at_all(file, offset, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadAtAll" );
+        return status;
+    };
+
     /**
-     * \ingroup P2P
-     * Buffered send num elements of a derived type from the given address
+     * \ingroup File
+     * Read from file from all processes that opened the file in sequence
      *
-     * \see MPI_Bsend
+     * \see MPI_File_read_ordered
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
      */
-    inline void Bsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
-        MEL_THROW( MPI_Bsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Bsend" );                                        
+    inline Status FileReadOrdered(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_ordered(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadOrdered" );
+        return status;
     };
     
     /**
-     * \ingroup P2P
-     * Synchronous send num elements of a derived type from the given address
-     *
-     * \see MPI_Ssend
+     * \ingroup File
+     * Read from file from any processes that opened the file in parallel
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     */                                                                                                                                
-    inline void Ssend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
-        MEL_THROW( MPI_Ssend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Ssend" );                                        
+     * \see MPI_File_read_shared
+     *
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A status object
+     */
+    inline Status FileReadShared(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Status status;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_shared(file, rptr, rnum, (MPI_Datatype) datatype, &status), "File::ReadShared" );
+        return status;
     };
-    
+
     /**
-     * \ingroup P2P
-     * Ready send num elements of a derived type from the given address
-     *
-     * \see MPI_Rsend
+     * \ingroup File
+     * Non-Blocking. Read from file from a single process
      *
-     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     * \see MPI_File_iread
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     */                                                                                                                                  
-    inline void Rsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
-        MEL_THROW( MPI_Rsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Rsend" );                                        
-    };  
-    
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A request object
+     */
+    inline Request FileIread(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_iread(file, rptr, rnum, (MPI_Datatype) datatype, &request), "File::Iread" );
+        return Request(request);
+    };
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Send num elements of a derived type from the given address
-     *
-     * \see MPI_Isend
+     * \ingroup File
+     * Non-Blocking. Read from file from a single process at the desired offset
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
-     */                                                                                                                               
-    inline void Isend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
-        MEL_THROW( MPI_Isend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Isend" );                                    
-    };                                                                                                                               
-    
-    /**
-     * \ingroup P2P
-     * Non-Blocking. Send num elements of a derived type from the given address
+     * \see MPI_File_iread_at
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A request object
      */
-    inline Request Isend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
-        Request rq{};                                                                                                            
-        Isend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
-        return rq;                                                                                                                    
+    inline Request FileIreadAt(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW(MPI_File_iread_at(file, offset, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadAt");
+        return Request(request);
     };
-    
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Buffered send num elements of a derived type from the given address
+     * \ingroup File
+     * Non-Blocking. Read from file from any process that opened the file in parallel
      *
-     * \see MPI_Ibsend
+     * \see MPI_File_iread_shared
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
-     */                                                                                                                                  
-    inline void Ibsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
-        MEL_THROW( MPI_Ibsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibsend" );                                
-    };  
-    
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A request object
+     */
+    inline Request FileIreadShared(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_iread_shared(file, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadShared" );
+        return Request(request);
+    };    
+
+#ifdef MEL_3_1
     /**
-     * \ingroup P2P
-     * Non-Blocking. Buffered send num elements of a derived type from the given address
+     * \ingroup File
+     * Non-Blocking. Write to file from all processes that opened the file
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
-     */                                                                                                                              
-    inline Request Ibsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
-        Request rq{};                                                                                                            
-        Ibsend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
-        return rq;                                                                                                                    
-    }; 
-    
+     * \see MPI_File_iwrite_all
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A request object
+     */
+    inline Request FileIwriteAll(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_iwrite_all(file, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteAll" );
+        return Request(request);
+    };
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Synchronous send num elements of a derived type from the given address
+     * \ingroup File
+     * Non-Blocking. Write to file from all processes that opened the file at the desired offset
      *
-     * \see MPI_Issend
+     * \see MPI_File_iwrite_at_all
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
-     */                                                                                                                                  
-    inline void Issend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
-        MEL_THROW( MPI_Issend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Issend" );                                
-    }; 
-    
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     * \return						A request object
+     */
+    inline Request FileIwriteAtAll(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_iwrite_at_all(file, offset, sptr, snum, (MPI_Datatype) datatype, &request), "File::IwriteAtAll" );
+        return Request(request);
+    };
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Synchronous send num elements of a derived type from the given address
+     * \ingroup File
+     * Non-Blocking. Read from file from all processes that opened the file
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
-     */                                                                                                                                 
-    inline Request Issend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
-        Request rq{};                                                                                                            
-        Issend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
-        return rq;                                                                                                                    
-    }; 
-    
+     * \see MPI_File_iread_all
+     *
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A request object
+     */
+    inline Request FileIreadAll(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_iread_all(file, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadAll" );
+        return Request(request);
+    };
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Ready send num elements of a derived type from the given address
+     * \ingroup File
+     * Non-Blocking. Read from file from all processes that opened the file at the desired offset
      *
-     * \see MPI_Irsend
+     * \see MPI_File_iread_at_all
      *
-     * \warning Requires that the matching Recieve has already been posted!Programmer is responsible for making a correct program.
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
+     * \return						A request object
+     */
+    inline Request FileIreadAtAll(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
+        MPI_Request request;
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_iread_at_all(file, offset, rptr, rnum, (MPI_Datatype) datatype, &request), "File::IreadAtAll" );
+        return Request(request);
+    };
+#endif
+
+    /**
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file. The buffer must not be touched until the matching end call
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
-     */                                                                                                                               
-    inline void Irsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
-        MEL_THROW( MPI_Irsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irsend" );                                
+     * \see MPI_File_write_all_begin
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
+     */
+    inline void FileWriteAllBegin(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_all_begin(file, sptr, snum, (MPI_Datatype) datatype), "File::WriteAllBegin" );
     };
-    
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Ready send num elements of a derived type from the given address
+     * \ingroup File
+     * Split-Collective. Complete a call to FileWriteAllBegin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
-     */                                                                                                                                
-    inline Request Irsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
-        Request rq{};                                                                                                            
-        Irsend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
-        return rq;                                                                                                                    
-    };
-
-    /// \cond HIDE
-#define MEL_SEND(T, D)    inline void Send(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                \
-        MEL_THROW( MPI_Send(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Send( " #T ", " #D " )" );                                \
-    }                                                                                                                                \
-    inline void Bsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
-        MEL_THROW( MPI_Bsend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Bsend( " #T ", " #D " )" );                            \
-    }                                                                                                                                \
-    inline void Ssend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
-        MEL_THROW( MPI_Ssend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Ssend( " #T ", " #D " )" );                            \
-    }                                                                                                                                \
-    inline void Rsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
-        MEL_THROW( MPI_Rsend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Rsend( " #T ", " #D " )" );                            \
-    }                                                                                                                                \
-    inline void Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
-        MEL_THROW( MPI_Isend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Isend( " #T ", " #D " )" );        \
-    }                                                                                                                                \
-    inline Request Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
-        Request rq{};                                                                                                                \
-        Isend(ptr, num, dst, tag, comm, rq);                                                                                        \
-        return rq;                                                                                                                    \
-    }                                                                                                                                \
-    inline void Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
-        MEL_THROW( MPI_Ibsend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibsend( " #T ", " #D " )" );        \
-    }                                                                                                                                \
-    inline Request Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
-        Request rq{};                                                                                                                \
-        Ibsend(ptr, num, dst, tag, comm, rq);                                                                                        \
-        return rq;                                                                                                                    \
-    }                                                                                                                                \
-    inline void Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
-        MEL_THROW( MPI_Issend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Issend( " #T ", " #D " )" );        \
-    }                                                                                                                                \
-    inline Request Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
-        Request rq{};                                                                                                                \
-        Issend(ptr, num, dst, tag, comm, rq);                                                                                        \
-        return rq;                                                                                                                    \
-    }                                                                                                                                \
-    inline void Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
-        MEL_THROW( MPI_Irsend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irsend( " #T ", " #D " )" );        \
-    }                                                                                                                                \
-    inline Request Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
-        Request rq{};                                                                                                                \
-        Irsend(ptr, num, dst, tag, comm, rq);                                                                                        \
-        return rq;                                                                                                                    \
-    }                                                                                                                                
-
-    MEL_SEND(char,                            MPI_CHAR);
-    MEL_SEND(wchar_t,                        MPI_WCHAR);
-
-    MEL_SEND(float,                            MPI_FLOAT);
-    MEL_SEND(double,                        MPI_DOUBLE);
-    MEL_SEND(long double,                    MPI_LONG_DOUBLE);
-
-    MEL_SEND(int8_t,                        MPI_INT8_T);
-    MEL_SEND(int16_t,                        MPI_INT16_T);
-    MEL_SEND(int32_t,                        MPI_INT32_T);
-    MEL_SEND(int64_t,                        MPI_INT64_T);
-
-    MEL_SEND(uint8_t,                        MPI_UINT8_T);
-    MEL_SEND(uint16_t,                        MPI_UINT16_T);
-    MEL_SEND(uint32_t,                        MPI_UINT32_T);
-    MEL_SEND(uint64_t,                        MPI_UINT64_T);
-
-#ifdef MEL_3
-    MEL_SEND(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
-    MEL_SEND(std::complex<double>,            MPI_CXX_DOUBLE_COMPLEX);
-    MEL_SEND(std::complex<long double>,        MPI_CXX_LONG_DOUBLE_COMPLEX);
-    MEL_SEND(bool,                            MPI_CXX_BOOL);
-#endif
-
-#undef MEL_SEND
-    /// \endcond
-
-    /**
-     * \ingroup P2P
-     * Send num elements of a derived type from the given address. Element size determined by template parameter
+     * \see MPI_File_write_all_end
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline void Send(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        Send(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileWriteAllEnd(const File &file, const void *sptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_write_all_end(file, (void*) sptr, &status), "File::WriteAllEnd" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Buffered send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file at the desired offset. The buffer must not be touched until the matching end call
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \see MPI_File_write_at_all_begin
+     *
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      */
-    template<typename T>
-    inline void Bsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        Bsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline void FileWriteAtAllBegin(const File &file, const Offset offset, const void *sptr, const int snum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_at_all_begin(file, offset, sptr, snum, (MPI_Datatype) datatype), "File::WriteAtAllBegin" );
     };
 
     /**
-     * \ingroup P2P
-     * Synchronous send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Complete a call to FileWriteAtAllBegin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \see MPI_File_write_at_all_end
+     *
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline void Ssend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        Ssend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileWriteAtAllEnd(const File &file, const void *sptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_write_at_all_end(file, (void*) sptr, &status), "File::WriteAtAllEnd" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Ready send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file in sequence. The buffer must not be touched until the matching end call
      *
-     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     * \see MPI_File_write_ordered_begin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \param[in] datatype			The derived type representing the elements to be written
      */
-    template<typename T>
-    inline void Rsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        Rsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline void FileWriteOrderedBegin(const File &file, const void *sptr, const int snum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(snum, datatype);
+        MEL_THROW( MPI_File_write_ordered_begin(file, sptr, snum, (MPI_Datatype) datatype), "File::WriteOrderedBegin" );
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Complete a call to FileWriteOrderedBegin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
-     */
-    template<typename T>
-    inline void Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
-        Isend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm, rq);
-    };
-    
-    /**
-     * \ingroup P2P
-     * Non-Blocking. Send num elements of a derived type from the given address. Element size determined by template parameter
+     * \see MPI_File_write_ordered_end
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline Request Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        return Isend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileWriteOrderedEnd(const File &file, const void *sptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_write_ordered_end(file, (void*) sptr, &status), "File::WriteOrderedEnd" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Buffered send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file. The buffer must not be touched until the matching end call
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
+     * \see MPI_File_read_all_begin
+     *
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
      */
-    template<typename T>
-    inline void Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
-        Ibsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm, rq);
+    inline void FileReadAllBegin(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_all_begin(file, rptr, rnum, (MPI_Datatype) datatype), "File::ReadAllBegin" );
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Buffered end num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Complete a call to FileReadAllBegin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
+     * \see MPI_File_read_all_end
+     *
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline Request Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        return Ibsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileReadAllEnd(const File &file, void *rptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_read_all_end(file, rptr, &status), "File::ReadAllEnd" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Synchronous send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file at the desired offset. The buffer must not be touched until the matching end call
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
+     * \see MPI_File_read_at_all_begin
+     *
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
      */
-    template<typename T>
-    inline void Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
-        Issend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm, rq);
+    inline void FileReadAtAllBegin(const File &file, const Offset offset, void *rptr, const int rnum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_at_all_begin(file, offset, rptr, rnum, (MPI_Datatype) datatype), "File::ReadAtAllBegin" );
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Synchronous end num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Complete a call to FileReadAtAllBegin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
+     * \see MPI_File_read_at_all_end
+     *
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline Request Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        return Issend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileReadAtAllEnd(const File &file, void *rptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_read_at_all_end(file, rptr, &status), "File::ReadAtAllEnd" );
+        return status;
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Ready send num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file in sequence. The buffer must not be touched until the matching end call
      *
-     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     * \see MPI_File_read_ordered_begin
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \param[out] rq				A request object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \param[in] datatype			The derived type representing the elements to be read
      */
-    template<typename T>
-    inline void Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
-        Irsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm, rq);
+    inline void FileReadOrderedBegin(const File &file, void *rptr, const int rnum, const Datatype &datatype) {
+        MEL_PROFILE_BYTES(rnum, datatype);
+        MEL_THROW( MPI_File_read_ordered_begin(file, rptr, rnum, (MPI_Datatype) datatype), "File::ReadOrderedBegin" );
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Ready end num elements of a derived type from the given address. Element size determined by template parameter
+     * \ingroup File
+     * Split-Collective. Complete a call to FileReadOrderedBegin
      *
-     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     * \see MPI_File_read_ordered_end
      *
-     * \param[in] ptr				Pointer to the memory to be sent
-     * \param[in] num				The number of elements to send
-     * \param[in] dst				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory passed to the matching begin call
+     * \return						A status object
      */
-    template<typename T>
-    inline Request Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
-        return Irsend(ptr, num * sizeof(T), MEL::Datatype::CHAR, dst, tag, comm);
+    inline Status FileReadOrderedEnd(const File &file, void *rptr) {
+        MPI_Status status;
+        MEL_THROW( MPI_File_read_ordered_end(file, rptr, &status), "File::ReadOrderedEnd" );
+        return status;
     };
 
+    /// \cond HIDE
+#ifdef MEL_3_1
+#define MEL_FILE_NB_COLLECTIVE(T, D) inline Request FileIwriteAll(const File &file, const T *sptr, const int snum) {                    \
+        MPI_Request request;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                     \
+        MEL_THROW( MPI_File_iwrite_all(file, sptr, snum,  D, &request), "File::IwriteAll(#T, #D)" );                                    \
+        return Request(request);                                                                                                        \
+    };                                                                                                                                  \
+    inline Request FileIwriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {                              \
+        MPI_Request request;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                     \
+        MEL_THROW( MPI_File_iwrite_at_all(file, offset, sptr, snum,  D, &request), "File::IwriteAtAll(#T, #D)" );                       \
+        return Request(request);                                                                                                        \
+    };                                                                                                                                  \
+    inline Request FileIreadAll(const File &file, T *rptr, const int rnum) {                                                            \
+        MPI_Request request;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                     \
+        MEL_THROW( MPI_File_iread_all(file, rptr, rnum,  D, &request), "File::IreadAll(#T, #D)" );                                      \
+        return Request(request);                                                                                                        \
+    };                                                                                                                                  \
+    inline Request FileIreadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {                                     \
+        MPI_Request request;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                     \
+        MEL_THROW( MPI_File_iread_at_all(file, offset, rptr, rnum,  D, &request), "File::IreadAtAll(#T, #D)" );                         \
+        return Request(request);                                                                                                        \
+    };
+#else
+#define MEL_FILE_NB_COLLECTIVE(T, D)
+#endif
+#define MEL_FILE_SPLIT_COLLECTIVE(T, D) inline void FileWriteAllBegin(const File &file, const T *sptr, const int snum) {                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                     \
+        MEL_THROW( MPI_File_write_all_begin(file, sptr, snum,  D), "File::WriteAllBegin(#T, #D)" );                                     \
+    };                                                                                                                                  \
+    inline void FileWriteAtAllBegin(const File &file, const Offset offset, const T *sptr, const int snum) {                             \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                     \
+        MEL_THROW( MPI_File_write_at_all_begin(file, offset, sptr, snum,  D), "File::WriteAtAllBegin(#T, #D)" );                        \
+    };                                                                                                                                  \
+    inline void FileWriteOrderedBegin(const File &file, const T *sptr, const int snum) {                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                     \
+        MEL_THROW( MPI_File_write_ordered_begin(file, sptr, snum,  D), "File::WriteOrderedBegin(#T, #D)" );                             \
+    };                                                                                                                                  \
+    inline void FileReadAllBegin(const File &file, T *rptr, const int rnum) {                                                           \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                     \
+        MEL_THROW( MPI_File_read_all_begin(file, rptr, rnum,  D), "File::ReadAllBegin(#T, #D)" );                                       \
+    };                                                                                                                                  \
+    inline void FileReadAtAllBegin(const File &file, const Offset offset, T *rptr, const int rnum) {                                    \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                     \
+        MEL_THROW( MPI_File_read_at_all_begin(file, offset, rptr, rnum,  D), "File::ReadAtAllBegin(#T, #D)" );                          \
+    };                                                                                                                                  \
+    inline void FileReadOrderedBegin(const File &file, T *rptr, const int rnum) {                                                       \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                     \
+        MEL_THROW( MPI_File_read_ordered_begin(file, rptr, rnum,  D), "File::ReadOrderedBegin(#T, #D)" );                               \
+    };
+
+#define MEL_FILE(T, D) inline Status FileWrite(const File &file, const T *sptr, const int snum) {                                    \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                   \
+        MEL_THROW( MPI_File_write(file, sptr, snum,  D, &status), "File::Write(#T, #D)" );                                            \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileWriteAll(const File &file, const T *sptr, const int snum) {                                                    \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                  \
+        MEL_THROW( MPI_File_write_all(file, sptr, snum,  D, &status), "File::WriteAll(#T, #D)" );                                    \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileWriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {                                \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                    \
+        MEL_THROW( MPI_File_write_at(file, offset, sptr, snum,  D, &status), "File::WriteAt(#T, #D)" );                                \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileWriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {                            \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                   \
+        MEL_THROW( MPI_File_write_at_all(file, offset, sptr, snum,  D, &status), "File::WriteAtAll(#T, #D)" );                        \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileWriteOrdered(const File &file, const T *sptr, const int snum) {                                                \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                  \
+        MEL_THROW( MPI_File_write_ordered(file, sptr, snum,  D, &status), "File::WriteOrdered(#T, #D)" );                            \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileWriteShared(const File &file, const T *sptr, const int snum) {                                                \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                    \
+        MEL_THROW( MPI_File_write_shared(file, sptr, snum,  D, &status), "File::WriteShared(#T, #D)" );                                \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Request FileIwrite(const File &file, const T *sptr, const int snum) {                                                    \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                  \
+        MEL_THROW( MPI_File_iwrite(file, sptr, snum,  D, &request), "File::Iwrite(#T, #D)" );                                        \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                \
+    inline Request FileIwriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {                                \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                 \
+        MEL_THROW(MPI_File_iwrite_at(file, offset, sptr, snum,  D, &request), "File::IwriteAt");                                    \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                \
+    inline Request FileIwriteShared(const File &file, const T *sptr, const int snum) {                                                \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                   \
+        MEL_THROW( MPI_File_iwrite_shared(file, sptr, snum,  D, &request), "File::IwriteShared(#T, #D)" );                            \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                \
+    inline Status FileRead(const File &file, T *rptr, const int rnum) {                                                                \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                 \
+        MEL_THROW( MPI_File_read(file, rptr, rnum,  D, &status), "File::Read(#T, #D)" );                                            \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileReadAll(const File &file, T *rptr, const int rnum) {                                                            \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                    \
+        MEL_THROW( MPI_File_read_all(file, rptr, rnum,  D, &status), "File::ReadAll(#T, #D)" );                                        \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileReadAt(const File &file, const Offset offset, T *rptr, const int rnum) {                                        \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                  \
+        MEL_THROW( MPI_File_read_at(file, offset, rptr, rnum,  D, &status), "File::ReadAt(#T, #D)" );                                \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileReadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {                                    \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                 \
+        MEL_THROW( MPI_File_read_at_all(file, offset, rptr, rnum,  D, &status), "File::ReadAtAll(#T, #D)" );                        \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileReadOrdered(const File &file, T *rptr, const int rnum) {                                                        \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                    \
+        MEL_THROW( MPI_File_read_ordered(file, rptr, rnum,  D, &status), "File::ReadOrdered(#T, #D)" );                                \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Status FileReadShared(const File &file, T *rptr, const int rnum) {                                                        \
+        MPI_Status status;                                                                                                            \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                  \
+        MEL_THROW( MPI_File_read_shared(file, rptr, rnum,  D, &status), "File::ReadShared(#T, #D)" );                                \
+        return status;                                                                                                                \
+    };                                                                                                                                \
+    inline Request FileIread(const File &file, T *rptr, const int rnum) {                                                            \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                    \
+        MEL_THROW( MPI_File_iread(file, rptr, rnum,  D, &request), "File::Iread(#T, #D)" );                                            \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                \
+    inline Request FileIreadAt(const File &file, const Offset offset, T *rptr, const int rnum) {                                    \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                   \
+        MEL_THROW(MPI_File_iread_at(file, offset, rptr, rnum,  D, &request), "File::IreadAt");                                        \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                \
+    inline Request FileIreadShared(const File &file, T *rptr, const int rnum) {                                                        \
+        MPI_Request request;                                                                                                        \
+        MEL_PROFILE_BYTES(rnum, D);                                                                                                 \
+        MEL_THROW( MPI_File_iread_shared(file, rptr, rnum,  D, &request), "File::IreadShared(#T, #D)" );                            \
+        return Request(request);                                                                                                    \
+    };                                                                                                                                  \
+    MEL_FILE_SPLIT_COLLECTIVE(T, D)                                                                                                    \
+    MEL_FILE_NB_COLLECTIVE(T, D)
+    
+    MEL_FILE(wchar_t, MPI_WCHAR);
+
+    MEL_FILE(float, MPI_FLOAT);
+    MEL_FILE(double, MPI_DOUBLE);
+    MEL_FILE(long double, MPI_LONG_DOUBLE);
+
+    MEL_FILE(int8_t, MPI_INT8_T);
+    MEL_FILE(int16_t, MPI_INT16_T);
+    MEL_FILE(int32_t, MPI_INT32_T);
+    MEL_FILE(int64_t, MPI_INT64_T);
+
+    MEL_FILE(uint8_t, MPI_UINT8_T);
+    MEL_FILE(uint16_t, MPI_UINT16_T);
+    MEL_FILE(uint32_t, MPI_UINT32_T);
+    MEL_FILE(uint64_t, MPI_UINT64_T);
+
+#ifdef MEL_3
+    MEL_FILE(std::complex<float>, MPI_CXX_FLOAT_COMPLEX);
+    MEL_FILE(std::complex<double>, MPI_CXX_DOUBLE_COMPLEX);
+    MEL_FILE(std::complex<long double>, MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_FILE(bool, MPI_CXX_BOOL);
+#endif
+
+#undef MEL_FILE
+#undef MEL_FILE_SPLIT_COLLECTIVE
+#undef MEL_FILE_NB_COLLECTIVE
+    /// \endcond
+
     /**
-     * \ingroup P2P
-     * Probe an incoming message to predetermine its contents
-     *
-     * \see MPI_Probe
+     * \ingroup File
+     * Write to file from a single process. Element size determined by template type
      *
-     * \param[in] source			The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a status object
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
-     inline Status Probe(const int source, const int tag, const Comm &comm) {
-        MPI_Status status{};
-        MEL_THROW( MPI_Probe(source, tag, (MPI_Comm) comm, &status), "Comm::Probe" );
-        return status;
+    template<typename T>
+    inline Status FileWrite(const File &file, const T *sptr, const int snum) {
+        return FileWrite(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Probe an incoming message to predetermine its contents
-     *
-     * \see MPI_Iprobe
+     * \ingroup File
+     * Write to file from a single process at the desired offset. Element size determined by template type
      *
-     * \param[in] source			The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns a std::pair of a bool representing if a message was available and status object for that message
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write to
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
-    inline std::pair<bool, Status> Iprobe(const int source, const int tag, const Comm &comm) {
-        MPI_Status status{}; int f;
-        MEL_THROW( MPI_Iprobe(source, tag, (MPI_Comm) comm, &f, &status), "Comm::Iprobe" );
-        return std::make_pair(f != 0, status);
+    template<typename T>
+    inline Status FileWriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {
+        return FileWriteAt(file, offset, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Probe the length of an incoming message. Element type is determined from the template parameter
-     *
-     * \see MPI_Get_count
+     * \ingroup File
+     * Write to file from all processes that opened the file. Element size determined by template type
      *
-     * \param[in] status			A status object containing the rank and tag for the message
-     * \return						Returns the number of elements in the message
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
     template<typename T>
-    inline int ProbeGetCount(const MPI_Status &status) {
-        int c;
-        MEL_THROW(MPI_Get_count(&status, MPI_CHAR, &c), "Comm::ProbeGetCount");
-        return c / sizeof(T);
+    inline Status FileWriteAll(const File &file, const T *sptr, const int snum) {
+        return FileWriteAll(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
+
     /**
-     * \ingroup P2P
-     * Probe the length of an incoming message
-     *
-     * \see MPI_Get_count 
+     * \ingroup File
+     * Write to file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in] datatype			The derived datatype of the elements 
-     * \param[in] status			A status object containing the rank and tag for the message
-     * \return						Returns the number of elements in the message
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write to
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
-    inline int ProbeGetCount(const Datatype &datatype, const Status &status) {
-        int c;
-        MEL_THROW(MPI_Get_count(&status, (MPI_Datatype) datatype, &c), "Comm::ProbeGetCount");
-        return c;
+    template<typename T>
+    inline Status FileWriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {
+        return FileWriteAtAll(file, offset, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Probe the length of an incoming message. Element type is determined from the template parameter
+     * \ingroup File
+     * Write to file from all processes that opened the file in sequence. Element size determined by template type
      *
-     * \param[in] src				The rank of the process to send to
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to send within
-     * \return						Returns the number of elements in the message
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
     template<typename T>
-    inline int ProbeGetCount(const int src, const int tag, const Comm &comm) {
-        Status status = Probe(src, tag, comm);
-        return ProbeGetCount<T>(status);
+    inline Status FileWriteOrdered(const File &file, const T *sptr, const int snum) {
+        return FileWriteOrdered(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Probe the length of an incoming message 
+     * \ingroup File
+     * Write to file from any processes that opened the file in parallel. Element size determined by template type
      *
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] src				The rank of the process to probe from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \return						Returns the number of elements in the message
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A status object
      */
-    inline int ProbeGetCount(const Datatype &datatype, const int src, const int tag, const Comm &comm) {
-        Status status = Probe(src, tag, comm);
-        return ProbeGetCount(datatype, status);
+    template<typename T>
+    inline Status FileWriteShared(const File &file, const T *sptr, const int snum) {
+        return FileWriteShared(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Recieve a message of known length into the given pointer 
-     *
-     * \see MPI_Recv
+     * \ingroup File
+     * Read from file from a single process. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \return						Returns a status object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
      */
-    inline Status Recv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm) {
-        Status status{};                                                                                                        
-        MEL_THROW( MPI_Recv(ptr, num, (MPI_Datatype) datatype, src, tag, (MPI_Comm) comm, &status), "Comm::Recv" );                                
-        return status;                                                                                                                
+    template<typename T>
+    inline Status FileRead(const File &file, T *rptr, const int rnum) {
+        return FileRead(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Recieve a message of known length into the given pointer 
-     *
-     * \see MPI_Irecv
+     * \ingroup File
+     * Read from file from a single process at the desired offset. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \param[out] rq				A request object
-     */                                                                                                                                
-    inline void Irecv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm, Request &rq) {
-        MEL_THROW( MPI_Irecv(ptr, num, (MPI_Datatype) datatype, src, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irecv" );                                    
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
+     */
+    template<typename T>
+    inline Status FileReadAt(const File &file, const Offset offset, T *rptr, const int rnum) {
+        return FileReadAt(file, offset, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Recieve a message of known length into the given pointer 
+     * \ingroup File
+     * Read from file from all processes that opened the file. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] datatype			The derived datatype of the elements
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \return						Returns a request object
-     */                                                                                                                               
-    inline Request Irecv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm) {
-        Request rq{};                                                                                                            
-        Irecv(ptr, num, datatype, src, tag, comm, rq);                                                                                        
-        return rq;                                                                                                                    
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
+     */
+    template<typename T>
+    inline Status FileReadAll(const File &file, T *rptr, const int rnum) {
+        return FileReadAll(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
-    /// \cond HIDE
-#define MEL_RECV(T, D) inline Status Recv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {                    \
-        Status status{};                                                                                                            \
-        MEL_THROW( MPI_Recv(ptr, num, D, src, tag, (MPI_Comm) comm, &status), "Comm::Recv( " #T ", " #D " )" );                        \
-        return status;                                                                                                                \
-    }                                                                                                                                \
-    inline void Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm, Request &rq) {                            \
-        MEL_THROW( MPI_Irecv(ptr, num, D, src, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irecv( " #T ", " #D " )" );        \
-    }                                                                                                                                \
-    inline Request Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {                                    \
-        Request rq{};                                                                                                                \
-        Irecv(ptr, num, src, tag, comm, rq);                                                                                        \
-        return rq;                                                                                                                    \
-    }
-
-    MEL_RECV(char,                            MPI_CHAR);
-    MEL_RECV(wchar_t,                        MPI_WCHAR);
-
-    MEL_RECV(float,                            MPI_FLOAT);
-    MEL_RECV(double,                        MPI_DOUBLE);
-    MEL_RECV(long double,                    MPI_LONG_DOUBLE);
-
-    MEL_RECV(int8_t,                        MPI_INT8_T);
-    MEL_RECV(int16_t,                        MPI_INT16_T);
-    MEL_RECV(int32_t,                        MPI_INT32_T);
-    MEL_RECV(int64_t,                        MPI_INT64_T);
-
-    MEL_RECV(uint8_t,                        MPI_UINT8_T);
-    MEL_RECV(uint16_t,                        MPI_UINT16_T);
-    MEL_RECV(uint32_t,                        MPI_UINT32_T);
-    MEL_RECV(uint64_t,                        MPI_UINT64_T);
-
-#ifdef MEL_3
-    MEL_RECV(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
-    MEL_RECV(std::complex<double>,            MPI_CXX_DOUBLE_COMPLEX);
-    MEL_RECV(std::complex<long double>,        MPI_CXX_LONG_DOUBLE_COMPLEX);
-    MEL_RECV(bool,                            MPI_CXX_BOOL);
-#endif
-#undef MEL_RECV
-    /// \endcond
-
     /**
-     * \ingroup P2P
-     * Recieve a message of known length into the given pointer. Element size is determined from the template parameter
+     * \ingroup File
+     * Read from file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \return						Returns a status object
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
      */
     template<typename T>
-    inline Status Recv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {
-        return Recv(ptr, num * sizeof(T), MEL::Datatype::CHAR, src, tag, comm);
+    inline Status FileReadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {
+        return FileReadAtAll(file, offset, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup P2P
-     * Non-Blocking. Recieve a message of known length into the given pointer. Element size is determined from the template parameter 
+     * \ingroup File
+     * Read from file from all processes that opened the file in sequence. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \param[out] rq				A request object
-     */   
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
+     */
     template<typename T>
-    inline void Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm, Request &rq) {
-        Irecv(ptr, num * sizeof(T), MEL::Datatype::CHAR, src, tag, comm, rq);
+    inline Status FileReadOrdered(const File &file, T *rptr, const int rnum) {
+        return FileReadOrdered(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
+
     /**
-     * \ingroup P2P
-     * Non-Blocking. Recieve a message of known length into the given pointer. Element size is determined from the template parameter 
+     * \ingroup File
+     * Read from file from any processes that opened the file in parallel. Element size determined by template type
      *
-     * \param[out] ptr				Pointer to the memory receive into
-     * \param[in] num				The number of elements to receive
-     * \param[in] src				The rank of the process to receive from
-     * \param[in] tag				A tag for the message
-     * \param[in] comm				The comm world to receive within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A status object
      */
     template<typename T>
-    inline Request Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {
-        return Irecv(ptr, num * sizeof(T), MEL::Datatype::CHAR, src, tag, comm);
+    inline Status FileReadShared(const File &file, T *rptr, const int rnum) {
+        return FileReadShared(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Broadcast an array to all processes in comm, where all processes know how many elements to expect 
-     *
-     * \see MPI_Bcast
+     * \ingroup File
+     * Non-Blocking. Write to file from a single process. Element size determined by template type
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] datatype			The derived datatype of the elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
-     */                                                                                                                      
-    inline void Bcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm) {                                                                            
-        MEL_THROW( MPI_Bcast(ptr, num, (MPI_Datatype) datatype, root, (MPI_Comm) comm), "Comm::Bcast" );                                                                
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A request object
+     */
+    template<typename T>
+    inline Request FileIwrite(const File &file, const T *sptr, const int snum) {
+        return FileIwrite(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Scatter an array to all processes in comm, where all processes know how many elements to expect 
-     *
-     * \see MPI_Scatter
+     * \ingroup File
+     * Non-Blocking. Write to file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				The number of elements to scatter, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write to
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A request object
      */
-    inline void Scatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        MEL_THROW( MPI_Scatter(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Scatter" );                                            
-    };        
-    
+    template<typename T>
+    inline Request FileIwriteAt(const File &file, const Offset offset, const T *sptr, const int snum) {
+        return FileIwriteAt(file, offset, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
+
     /**
-     * \ingroup COL
-     * Scatter an array to all processes in comm, where all processes have an independent number of elements to expect 
-     *
-     * \see MPI_Scatterv
+     * \ingroup File
+     * Non-Blocking. Write to file from any processes that opened the file in parallel. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
-     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
-     */                                                                                                                                            
-    inline void Scatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        MEL_THROW( MPI_Scatterv(sptr, snum, displs, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Scatterv" );                                
-    };    
-                                                                                                                                                    
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A request object
+     */
+    template<typename T>
+    inline Request FileIwriteShared(const File &file, const T *sptr, const int snum) {
+        return FileIwriteShared(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
+
     /**
-     * \ingroup COL
-     * Gather an array from all processes in comm 
+     * \ingroup File
+     * Non-Blocking. Read from file from a single process. Element size determined by template type
      *
-     * \see MPI_Gather
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A request object
+     */
+    template<typename T>
+    inline Request FileIread(const File &file, T *rptr, const int rnum) {
+        return FileIread(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
+
+    /**
+     * \ingroup File
+     * Non-Blocking. Read from file from a single process at the desired offset. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				The number of elements to receive, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     */                                                                                                                                
-    inline void Gather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        MEL_THROW( MPI_Gather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Gather" );                                            
-    };    
-      
-    /**
-     * \ingroup COL
-     * Gather an array from all processes in comm, where all processes have an independent number of elements to send
-     *
-     * \see MPI_Gatherv
-     *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
-     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     */                                                                                                                                                      
-    inline void Gatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm) {
-        MEL_THROW( MPI_Gatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displs, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Gatherv" );                                    
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A request object
+     */
+    template<typename T>
+    inline Request FileIreadAt(const File &file, const Offset offset, T *rptr, const int rnum) {
+        return FileIreadAt(file, offset, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-                                                                                                                                                            
-    /**
-     * \ingroup COL
-     * Gather an array from all processes in comm and distribute it to all processes 
-     *
-     * \see MPI_Allgather
-     *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
-     */                                                                                                                            
-    inline void Allgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
-        MEL_THROW( MPI_Allgather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Allgather" );                                            
-    };    
-    
-    /**
-     * \ingroup COL
-     * Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
-     *
-     * \see MPI_Allgatherv
-     *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
-     */                                                                                                                                                          
-    inline void Allgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm) {
-        MEL_THROW( MPI_Allgatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displ, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Allgather" );  
-    };   
-                                                                                                                                                
+
     /**
-     * \ingroup COL
-     * Broadcast from all processes to all processes
-     *
-     * \see MPI_Alltoall
+     * \ingroup File
+     * Non-Blocking. Read from file from any processes that opened the file in parallel. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				The number of elements to send
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to rnum * commsize elements to receive
-     * \param[in] rnum				The number of elements to receive from each process in comm
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
-     */                                                                                                                                
-    inline void Alltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
-        MEL_THROW( MPI_Alltoall(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Alltoall" );                                                
-    };    
-    
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A request object
+     */
+    template<typename T>
+    inline Request FileIreadShared(const File &file, T *rptr, const int rnum) {
+        return FileIreadShared(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
+
     /**
-     * \ingroup COL
-     * Broadcast from all processes to all processes with independent number of elements for each process
-     *
-     * \see MPI_Alltoallv
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
-     */                                                                                                                                         
-    inline void Alltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm) {
-        MEL_THROW( MPI_Alltoallv(sptr, snum, sdispl, (MPI_Datatype) sdatatype, rptr, rnum, rdispl, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Alltoallv" );                            
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     */
+    template<typename T>
+    inline void FileWriteAllBegin(const File &file, const T *sptr, const int snum) {
+        FileWriteAllBegin(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
-     *
-     * \see MPI_Alltoallw
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
-     * \param[in] comm				The comm world to broadcast within
-     */    
-    inline void Alltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm) {
-        MEL_THROW( MPI_Alltoallw(sptr, snum, sdispl, (MPI_Datatype*) sdatatype, rptr, rnum, rdispl, (MPI_Datatype*) rdatatype, (MPI_Comm) comm), "Comm::Alltoallw" );
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     */
+    template<typename T>
+    inline void FileWriteAtAllBegin(const File &file, const Offset offset, const T *sptr, const int snum) {
+        FileWriteAtAllBegin(file, offset, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Reduce an array of known length across all processes in comm using the given operation
-     *
-     * \see MPI_Reduce
+     * \ingroup File
+     * Split-Collective. Write to file from all processes that opened the file in sequence. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer, significant only on root
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] root				The process to receive the result
-     * \param[in] comm				The comm world to reduce within
-     */                                                                                                                             
-    inline void Reduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm) {
-        MEL_THROW( MPI_Reduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, root, (MPI_Comm) comm), "Comm::Reduce" );                                                
-    };                                                                                                                                                
-    
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     */
+    template<typename T>
+    inline void FileWriteOrderedBegin(const File &file, const T *sptr, const int snum) {
+        FileWriteOrderedBegin(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
+    };
+
     /**
-     * \ingroup COL
-     * Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
-     *
-     * \see MPI_Allreduce
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] comm				The comm world to reduce within
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
      */
-    inline void Allreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
-        MEL_THROW( MPI_Allreduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm), "Comm::Allreduce" );                                            
+    template<typename T>
+    inline void FileReadAllBegin(const File &file, T *rptr, const int rnum) {
+        FileReadAllBegin(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
-#ifdef MEL_3
+
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect 
-     *
-     * \see MPI_Ibcast
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] datatype			The derived datatype of the elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
-     * \param[out] rq				A request object
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
      */
-    inline void Ibcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Ibcast(ptr, num, (MPI_Datatype) datatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibcast");
+    template<typename T>
+    inline void FileReadAtAllBegin(const File &file, const Offset offset, T *rptr, const int rnum) {
+        FileReadAtAllBegin(file, offset, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
-    
+
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect 
+     * \ingroup File
+     * Split-Collective. Read from file from all processes that opened the file in sequence. Element size determined by template type
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] datatype			The derived datatype of the elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
      */
-    inline Request Ibcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm) {
-        Request rq{};
-        Ibcast(ptr, num, datatype, root, comm, rq);
-        return rq;
+    template<typename T>
+    inline void FileReadOrderedBegin(const File &file, T *rptr, const int rnum) {
+        FileReadOrderedBegin(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
+#ifdef MEL_3_1
     /**
-     * \ingroup COL
-     * Non-Blocking. Scatter an array to all processes in comm, where all processes know how many elements to expect 
-     *
-     * \see MPI_Iscatter
+     * \ingroup File
+     * Non-Blocking. Write to file from all processes that opened the file. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				The number of elements to scatter, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
-     * \param[out] rq				A request object
+     * \param[in] file				The file handle
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A request object
      */
-    inline void Iscatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Iscatter(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatter");
+    template<typename T>
+    inline Request FileIwriteAll(const File &file, const T *sptr, const int snum) {
+        return FileIwriteAll(file, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Scatter an array to all processes in comm, where all processes know how many elements to expect 
+     * \ingroup File
+     * Non-Blocking. Write to file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				The number of elements to scatter, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to write at
+     * \param[in] sptr				Pointer to the memory to be written
+     * \param[in] snum				The number of elements to write
+     * \return						A request object
      */
-    inline Request Iscatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        Request rq{};
-        Iscatter(sptr, snum, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
-        return rq;
+    template<typename T>
+    inline Request FileIwriteAtAll(const File &file, const Offset offset, const T *sptr, const int snum) {
+        return FileIwriteAtAll(file, offset, sptr, Datatype_count<T>(snum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Scatter an array to all processes in comm, where all processes have an independent number of elements to expect
-     *
-     * \see MPI_Iscatterv 
+     * \ingroup File
+     * Non-Blocking. Read from file from all processes that opened the file. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
-     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
-     * \param[out] rq				A request object
+     * \param[in] file				The file handle
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A request object
      */
-    inline void Iscatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Iscatterv(sptr, snum, displs, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatterv");
+    template<typename T>
+    inline Request FileIreadAll(const File &file, T *rptr, const int rnum) {
+        return FileIreadAll(file, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Scatter an array to all processes in comm, where all processes have an independent number of elements to expect 
+     * \ingroup File
+     * Non-Blocking. Read from file from all processes that opened the file at the desired offset. Element size determined by template type
      *
-     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
-     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
-     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
-     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to scatter within
-     * \return						Returns a request object
+     * \param[in] file				The file handle
+     * \param[in] offset			Byte offset into the file to read from
+     * \param[out] rptr				Pointer to the memory to be read into
+     * \param[in] rnum				The number of elements to read
+     * \return						A request object
      */
-    inline Request Iscatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        Request rq{};
-        Iscatterv(sptr, snum, displs, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
-        return rq;
+    template<typename T>
+    inline Request FileIreadAtAll(const File &file, const Offset offset, T *rptr, const int rnum) {
+        return FileIreadAtAll(file, offset, rptr, Datatype_count<T>(rnum), Datatype_select<T>(MEL::Datatype::UNSIGNED_CHAR));
     };
+#endif
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm 
+     * \ingroup P2P
+     * Send num elements of a derived type from the given address
      *
-     * \see MPI_Igather
+     * \see MPI_Send
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				The number of elements to receive, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     * \param[out] rq				A request object
-     */ 
-    inline void Igather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Igather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igather");
-    };
-
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    inline void Send(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Send(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Send" );                                            
+    };                                                                                                                                
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm 
+     * \ingroup P2P
+     * Buffered send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				The number of elements to receive, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     * \return						Returns a request object
-     */ 
-    inline Request Igather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
-        Request rq{};
-        Igather(sptr, snum, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
-        return rq;
+     * \see MPI_Bsend
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    inline void Bsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Bsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Bsend" );                                        
     };
-
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm, where all processes have an independent number of elements to send
+     * \ingroup P2P
+     * Synchronous send num elements of a derived type from the given address
      *
-     * \see MPI_Igatherv
+     * \see MPI_Ssend
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
-     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     * \param[out] rq				A request object
-     */ 
-    inline void Igatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Igatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displs, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igatherv");
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */                                                                                                                                
+    inline void Ssend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Ssend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Ssend" );                                        
     };
-
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm, where all processes have an independent number of elements to send
+     * \ingroup P2P
+     * Ready send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
-     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
-     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
-     * \param[in] root				The rank of the process to send to
-     * \param[in] comm				The comm world to gather within
-     * \return						Returns a request object
-     */ 
-    inline Request Igatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm) {
-        Request rq{};
-        Igatherv(sptr, snum, sdatatype, rptr, rnum, displs, rdatatype, root, comm, rq);
-        return rq;
-    };
-
+     * \see MPI_Rsend
+     *
+     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */                                                                                                                                  
+    inline void Rsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                                
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Rsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm), "Comm::Rsend" );                                        
+    };  
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes 
+     * \ingroup P2P
+     * Non-Blocking. Send num elements of a derived type from the given address
      *
-     * \see MPI_Iallgather
+     * \see MPI_Isend
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \param[out] rq				A request object
-     */  
-    inline void Iallgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Iallgather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather");
-    };
-
+     */                                                                                                                               
+    inline void Isend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Isend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Isend" );                                    
+    };                                                                                                                               
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes 
+     * \ingroup P2P
+     * Non-Blocking. Send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				The number of elements to receive
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \return						Returns a request object
-     */  
-    inline Request Iallgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
-        Request rq{};
-        Iallgather(sptr, snum, sdatatype, rptr, rnum, rdatatype, comm, rq);
-        return rq;
+     */
+    inline Request Isend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
+        Request rq{};                                                                                                            
+        Isend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
+        return rq;                                                                                                                    
     };
-
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
+     * \ingroup P2P
+     * Non-Blocking. Buffered send num elements of a derived type from the given address
      *
-     * \see MPI_Iallgatherv
-     *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
-     * \param[out] rq				A request object
-     */  
-    inline void Iallgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Iallgatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displ, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather");
-    };
-
-    /**
-     * \ingroup COL
-     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
-     *
-     * \param[in] sptr				Pointer to the memory to gather
-     * \param[in] snum				The number of elements to gather
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the memory to receive into
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to gather within
-     * \return						Returns a request object
-     */  
-    inline Request Iallgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm) {
-        Request rq{};
-        Iallgatherv(sptr, snum, sdatatype, rptr, rnum, displ, rdatatype, comm, rq);
-        return rq;
-    };
-
-    /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes
-     *
-     * \see MPI_Ialltoall
+     * \see MPI_Ibsend
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				The number of elements to send
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to rnum * commsize elements to receive
-     * \param[in] rnum				The number of elements to receive from each process in comm
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \param[out] rq				A request object
-     */
-    inline void Ialltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Ialltoall(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoall");
-    };
-
+     */                                                                                                                                  
+    inline void Ibsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Ibsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibsend" );                                
+    };  
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes
+     * \ingroup P2P
+     * Non-Blocking. Buffered send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				The number of elements to send
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to rnum * commsize elements to receive
-     * \param[in] rnum				The number of elements to receive from each process in comm
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \return						Returns a request object
-     */
-    inline Request Ialltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
-        Request rq{};
-        Ialltoall(sptr, snum, sdatatype, rptr, rnum, rdatatype, comm, rq);
-        return rq;
-    };
+     */                                                                                                                              
+    inline Request Ibsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
+        Request rq{};                                                                                                            
+        Ibsend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
+        return rq;                                                                                                                    
+    }; 
     
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes with independent number of elements for each process
+     * \ingroup P2P
+     * Non-Blocking. Synchronous send num elements of a derived type from the given address
      *
-     * \see MPI_Ialltoallv
+     * \see MPI_Issend
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \param[out] rq				A request object
-     */
-    inline void Ialltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Ialltoallv(sptr, snum, sdispl, (MPI_Datatype) sdatatype, rptr, rnum, rdispl, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallv");
-    };
-
+     */                                                                                                                                  
+    inline void Issend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Issend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Issend" );                                
+    }; 
+    
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes with independent number of elements for each process
+     * \ingroup P2P
+     * Non-Blocking. Synchronous send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			The derived datatype of the elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			The derived datatype of the elements to receive
-     * \param[in] comm				The comm world to broadcast within
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
      * \return						Returns a request object
-     */
-    inline Request Ialltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm) {
-        Request rq{};
-        Ialltoallv(sptr, snum, sdispl, sdatatype, rptr, rnum, rdispl, rdatatype, comm, rq);
-        return rq;
-    };
+     */                                                                                                                                 
+    inline Request Issend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
+        Request rq{};                                                                                                            
+        Issend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
+        return rq;                                                                                                                    
+    }; 
     
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
+     * \ingroup P2P
+     * Non-Blocking. Ready send num elements of a derived type from the given address
      *
-     * \see MPI_Ialltoallw
+     * \see MPI_Irsend
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
-     * \param[in] comm				The comm world to broadcast within
-     * \param[out] rq				A request object
-     */   
-    inline void Ialltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Ialltoallw(sptr, snum, sdispl, (MPI_Datatype*) sdatatype, rptr, rnum, rdispl, (MPI_Datatype*) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallw");
-    };
-
-    /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
+     * \warning Requires that the matching Recieve has already been posted!Programmer is responsible for making a correct program.
      *
-     * \param[in] sptr				Pointer to snum elements to send
-     * \param[in] snum				Pointer to an array of the number of elements to send from each process
-     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
-     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
-     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
-     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
-     * \param[in] comm				The comm world to broadcast within
-     * \return						Returns a request object
-     */   
-    inline Request Ialltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm) {
-        Request rq{};
-        Ialltoallw(sptr, snum, sdispl, sdatatype, rptr, rnum, rdispl, rdatatype, comm, rq);
-        return rq;
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */                                                                                                                               
+    inline void Irsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm, Request &rq) {            
+        MEL_COMM_MATRIX_P2P(dst, num, datatype, comm);
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Irsend(ptr, num, (MPI_Datatype) datatype, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irsend" );                                
     };
     
     /**
-     * \ingroup COL
-     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation
-     *
-     * \see MPI_Ireduce
+     * \ingroup P2P
+     * Non-Blocking. Ready send num elements of a derived type from the given address
      *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer, significant only on root
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] root				The process to receive the result
-     * \param[in] comm				The comm world to reduce within
-     * \param[out] rq				A request object
-     */     
-    inline void Ireduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm, Request &rq) {
-        MEL_THROW(MPI_Ireduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ireduce");
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */                                                                                                                                
+    inline Request Irsend(const void *ptr, const int num, const Datatype &datatype, const int dst, const int tag, const Comm &comm) {                        
+        Request rq{};                                                                                                            
+        Irsend(ptr, num, datatype, dst, tag, comm, rq);                                                                                        
+        return rq;                                                                                                                    
     };
 
-    /**
-     * \ingroup COL
-     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation
-     *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer, significant only on root
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] root				The process to receive the result
-     * \param[in] comm				The comm world to reduce within
-     * \return						Returns a request object
-     */     
-    inline Request Ireduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm) {
-        Request rq{};
-        Ireduce(sptr, rptr, num, datatype, op, root, comm, rq);
-        return rq;
-    };    
-    
-    /**
-     * \ingroup COL
-     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
+    /// \cond HIDE
+#define MEL_SEND(T, D)    inline void Send(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                       \
+        MEL_PROFILE_BYTES(num, D);                                                                                                    \
+        MEL_THROW( MPI_Send(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Send( " #T ", " #D " )" );                                \
+    }                                                                                                                                \
+    inline void Bsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                     \
+        MEL_PROFILE_BYTES(num, D);                                                                                                  \
+        MEL_THROW( MPI_Bsend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Bsend( " #T ", " #D " )" );                            \
+    }                                                                                                                                \
+    inline void Ssend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                     \
+        MEL_PROFILE_BYTES(num, D);                                                                                                  \
+        MEL_THROW( MPI_Ssend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Ssend( " #T ", " #D " )" );                            \
+    }                                                                                                                                \
+    inline void Rsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                     \
+        MEL_PROFILE_BYTES(num, D);                                                                                                  \
+        MEL_THROW( MPI_Rsend(ptr, num, D, dst, tag, (MPI_Comm) comm), "Comm::Rsend( " #T ", " #D " )" );                            \
+    }                                                                                                                                \
+    inline void Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                     \
+        MEL_PROFILE_BYTES(num, D);                                                                                                  \
+        MEL_THROW( MPI_Isend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Isend( " #T ", " #D " )" );        \
+    }                                                                                                                                \
+    inline Request Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                                \
+        Request rq{};                                                                                                                \
+        Isend(ptr, num, dst, tag, comm, rq);                                                                                        \
+        return rq;                                                                                                                    \
+    }                                                                                                                                \
+    inline void Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                       \
+        MEL_PROFILE_BYTES(num, D);                                                                                                    \
+        MEL_THROW( MPI_Ibsend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibsend( " #T ", " #D " )" );        \
+    }                                                                                                                                \
+    inline Request Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
+        Request rq{};                                                                                                                \
+        Ibsend(ptr, num, dst, tag, comm, rq);                                                                                        \
+        return rq;                                                                                                                    \
+    }                                                                                                                                \
+    inline void Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                       \
+        MEL_PROFILE_BYTES(num, D);                                                                                                    \
+        MEL_THROW( MPI_Issend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Issend( " #T ", " #D " )" );        \
+    }                                                                                                                                \
+    inline Request Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
+        Request rq{};                                                                                                                \
+        Issend(ptr, num, dst, tag, comm, rq);                                                                                        \
+        return rq;                                                                                                                    \
+    }                                                                                                                                \
+    inline void Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {                    \
+        MEL_COMM_MATRIX_P2P(dst, num, D, comm);                                                                                       \
+        MEL_PROFILE_BYTES(num, D);                                                                                                    \
+        MEL_THROW( MPI_Irsend(ptr, num, D, dst, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irsend( " #T ", " #D " )" );        \
+    }                                                                                                                                \
+    inline Request Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {                            \
+        Request rq{};                                                                                                                \
+        Irsend(ptr, num, dst, tag, comm, rq);                                                                                        \
+        return rq;                                                                                                                    \
+    }                                                                                                                                
+
+    MEL_SEND(char,                            MPI_CHAR);
+    MEL_SEND(wchar_t,                        MPI_WCHAR);
+
+    MEL_SEND(float,                            MPI_FLOAT);
+    MEL_SEND(double,                        MPI_DOUBLE);
+    MEL_SEND(long double,                    MPI_LONG_DOUBLE);
+
+    MEL_SEND(int8_t,                        MPI_INT8_T);
+    MEL_SEND(int16_t,                        MPI_INT16_T);
+    MEL_SEND(int32_t,                        MPI_INT32_T);
+    MEL_SEND(int64_t,                        MPI_INT64_T);
+
+    MEL_SEND(uint8_t,                        MPI_UINT8_T);
+    MEL_SEND(uint16_t,                        MPI_UINT16_T);
+    MEL_SEND(uint32_t,                        MPI_UINT32_T);
+    MEL_SEND(uint64_t,                        MPI_UINT64_T);
+
+#ifdef MEL_3
+    MEL_SEND(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
+    MEL_SEND(std::complex<double>,            MPI_CXX_DOUBLE_COMPLEX);
+    MEL_SEND(std::complex<long double>,        MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_SEND(bool,                            MPI_CXX_BOOL);
+#endif
+
+#undef MEL_SEND
+    /// \endcond
+
+    /**
+     * \ingroup P2P
+     * Send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename T>
+    inline void Send(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        Send(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Buffered send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename T>
+    inline void Bsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        Bsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Synchronous send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename T>
+    inline void Ssend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        Ssend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Ready send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename T>
+    inline void Rsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        Rsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
+        Isend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm, rq);
+    };
+    
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Isend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        return Isend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Buffered send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
+        Ibsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Buffered end num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Ibsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        return Ibsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Synchronous send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
+        Issend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Synchronous end num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Issend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        return Issend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Ready send num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm, Request &rq) {
+        Irsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Ready end num elements of a derived type from the given address. Element size determined by template parameter
+     *
+     * \warning Requires that the matching Recieve has already been posted! Programmer is responsible for making a correct program.
+     *
+     * \param[in] ptr				Pointer to the memory to be sent
+     * \param[in] num				The number of elements to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Irsend(const T *ptr, const int num, const int dst, const int tag, const Comm &comm) {
+        return Irsend(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Probe an incoming message to predetermine its contents
+     *
+     * \see MPI_Probe
+     *
+     * \param[in] source			The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a status object
+     */
+     inline Status Probe(const int source, const int tag, const Comm &comm) {
+        MPI_Status status{};
+        MEL_THROW( MPI_Probe(source, tag, (MPI_Comm) comm, &status), "Comm::Probe" );
+        return status;
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Probe an incoming message to predetermine its contents
+     *
+     * \see MPI_Iprobe
+     *
+     * \param[in] source			The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a std::pair of a bool representing if a message was available and status object for that message
+     */
+    inline std::pair<bool, Status> Iprobe(const int source, const int tag, const Comm &comm) {
+        MPI_Status status{}; int f;
+        MEL_THROW( MPI_Iprobe(source, tag, (MPI_Comm) comm, &f, &status), "Comm::Iprobe" );
+        return std::make_pair(f != 0, status);
+    };
+
+#ifdef MEL_3
+    /**
+     * \ingroup P2P
+     * Probe an incoming message and remove it from matching, so that only the returned message handle can receive it. 
+     * Unlike Probe followed by Recv this is safe with wildcard sources and tags when other threads are receiving
+     *
+     * \see MPI_Mprobe
+     *
+     * \param[in] source			The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \param[out] message			The handle of the matched message
+     * \return						Returns a status object
+     */
+    inline Status Mprobe(const int source, const int tag, const Comm &comm, Message &message) {
+        MPI_Status status{};
+        MEL_THROW( MPI_Mprobe(source, tag, (MPI_Comm) comm, (MPI_Message*) &message, &status), "Comm::Mprobe" );
+        return status;
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Probe an incoming message and remove it from matching, so that only the returned message handle can receive it
+     *
+     * \see MPI_Improbe
+     *
+     * \param[in] source			The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \param[out] message			The handle of the matched message, if one was available
+     * \return						Returns a std::pair of a bool representing if a message was available and status object for that message
+     */
+    inline std::pair<bool, Status> Improbe(const int source, const int tag, const Comm &comm, Message &message) {
+        MPI_Status status{}; int f;
+        MEL_THROW( MPI_Improbe(source, tag, (MPI_Comm) comm, &f, (MPI_Message*) &message, &status), "Comm::Improbe" );
+        return std::make_pair(f != 0, status);
+    };
+#endif
+
+    /**
+     * \ingroup P2P
+     * Probe the length of an incoming message. Element type is determined from the template parameter
+     *
+     * \see MPI_Get_count
+     *
+     * \param[in] status			A status object containing the rank and tag for the message
+     * \return						Returns the number of elements in the message
+     */
+    template<typename T>
+    inline int ProbeGetCount(const MPI_Status &status) {
+        int c;
+        MEL_THROW(MPI_Get_count(&status, (MPI_Datatype) Datatype_select<T>(MEL::Datatype::CHAR), &c), "Comm::ProbeGetCount");
+        return Datatype_registry<T>::REGISTERED ? c : (int) (c / sizeof(T));
+    };
+    
+    /**
+     * \ingroup P2P
+     * Probe the length of an incoming message
+     *
+     * \see MPI_Get_count 
+     *
+     * \param[in] datatype			The derived datatype of the elements 
+     * \param[in] status			A status object containing the rank and tag for the message
+     * \return						Returns the number of elements in the message
+     */
+    inline int ProbeGetCount(const Datatype &datatype, const Status &status) {
+        int c;
+        MEL_THROW(MPI_Get_count(&status, (MPI_Datatype) datatype, &c), "Comm::ProbeGetCount");
+        return c;
+    };
+
+    /**
+     * \ingroup P2P
+     * Probe the length of an incoming message. Element type is determined from the template parameter
+     *
+     * \param[in] src				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns the number of elements in the message
+     */
+    template<typename T>
+    inline int ProbeGetCount(const int src, const int tag, const Comm &comm) {
+        Status status = Probe(src, tag, comm);
+        return ProbeGetCount<T>(status);
+    };
+
+    /**
+     * \ingroup P2P
+     * Probe the length of an incoming message 
+     *
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] src				The rank of the process to probe from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns the number of elements in the message
+     */
+    inline int ProbeGetCount(const Datatype &datatype, const int src, const int tag, const Comm &comm) {
+        Status status = Probe(src, tag, comm);
+        return ProbeGetCount(datatype, status);
+    };
+
+    /**
+     * \ingroup P2P
+     * Recieve a message of known length into the given pointer 
+     *
+     * \see MPI_Recv
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a status object
+     */
+    inline Status Recv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm) {
+        Status status{};                                                                                                        
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Recv(ptr, num, (MPI_Datatype) datatype, src, tag, (MPI_Comm) comm, &status), "Comm::Recv" );                                
+        return status;                                                                                                                
+    };
+    
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into the given pointer 
+     *
+     * \see MPI_Irecv
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \param[out] rq				A request object
+     */                                                                                                                                
+    inline void Irecv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Irecv(ptr, num, (MPI_Datatype) datatype, src, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irecv" );                                    
+    };
+    
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into the given pointer 
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a request object
+     */                                                                                                                               
+    inline Request Irecv(void *ptr, const int num, const Datatype &datatype, const int src, const int tag, const Comm &comm) {
+        Request rq{};                                                                                                            
+        Irecv(ptr, num, datatype, src, tag, comm, rq);                                                                                        
+        return rq;                                                                                                                    
+    };
+
+    /// \cond HIDE
+#define MEL_RECV(T, D) inline Status Recv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {                    \
+        Status status{};                                                                                                            \
+        MEL_PROFILE_BYTES(num, D);                                                                                                     \
+        MEL_THROW( MPI_Recv(ptr, num, D, src, tag, (MPI_Comm) comm, &status), "Comm::Recv( " #T ", " #D " )" );                        \
+        return status;                                                                                                                \
+    }                                                                                                                                \
+    inline void Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm, Request &rq) {                            \
+        MEL_PROFILE_BYTES(num, D);                                                                                                  \
+        MEL_THROW( MPI_Irecv(ptr, num, D, src, tag, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Irecv( " #T ", " #D " )" );        \
+    }                                                                                                                                \
+    inline Request Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {                                    \
+        Request rq{};                                                                                                                \
+        Irecv(ptr, num, src, tag, comm, rq);                                                                                        \
+        return rq;                                                                                                                    \
+    }
+
+    MEL_RECV(char,                            MPI_CHAR);
+    MEL_RECV(wchar_t,                        MPI_WCHAR);
+
+    MEL_RECV(float,                            MPI_FLOAT);
+    MEL_RECV(double,                        MPI_DOUBLE);
+    MEL_RECV(long double,                    MPI_LONG_DOUBLE);
+
+    MEL_RECV(int8_t,                        MPI_INT8_T);
+    MEL_RECV(int16_t,                        MPI_INT16_T);
+    MEL_RECV(int32_t,                        MPI_INT32_T);
+    MEL_RECV(int64_t,                        MPI_INT64_T);
+
+    MEL_RECV(uint8_t,                        MPI_UINT8_T);
+    MEL_RECV(uint16_t,                        MPI_UINT16_T);
+    MEL_RECV(uint32_t,                        MPI_UINT32_T);
+    MEL_RECV(uint64_t,                        MPI_UINT64_T);
+
+#ifdef MEL_3
+    MEL_RECV(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
+    MEL_RECV(std::complex<double>,            MPI_CXX_DOUBLE_COMPLEX);
+    MEL_RECV(std::complex<long double>,        MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_RECV(bool,                            MPI_CXX_BOOL);
+#endif
+#undef MEL_RECV
+    /// \endcond
+
+    /**
+     * \ingroup P2P
+     * Recieve a message of known length into the given pointer. Element size is determined from the template parameter
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a status object
+     */
+    template<typename T>
+    inline Status Recv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {
+        return Recv(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), src, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into the given pointer. Element size is determined from the template parameter 
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \param[out] rq				A request object
+     */   
+    template<typename T>
+    inline void Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm, Request &rq) {
+        Irecv(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), src, tag, comm, rq);
+    };
+    
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into the given pointer. Element size is determined from the template parameter 
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Irecv(T *ptr, const int num, const int src, const int tag, const Comm &comm) {
+        return Irecv(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), src, tag, comm);
+    };
+
+    /// \cond HIDE
+    template<typename...>
+    struct Iterator_void {
+        typedef void type;
+    };
+
+    template<typename It, typename = void>
+    struct Iterator_random : public std::false_type {};
+    template<typename T>
+    struct Iterator_random<T*, void> : public std::true_type {};
+    template<typename It>
+    struct Iterator_random<It, typename Iterator_void<typename It::iterator_category>::type> 
+        : public std::is_same<typename std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag> {};
+
+    template<typename It, typename R = void>
+    using enable_if_iterator = typename std::enable_if<Iterator_random<It>::value, R>::type;
+
+    template<typename It>
+    inline typename std::iterator_traits<It>::value_type* Iterator_ptr(const It &first, const It &last) {
+        typedef typename std::iterator_traits<It>::value_type T;
+        return (first == last) ? nullptr : const_cast<T*>(&*first);
+    };
+
+    template<typename It>
+    inline int Iterator_count(const It &first, const It &last) {
+        return (int) std::distance(first, last);
+    };
+    /// \endcond
+
+    /**
+     * \ingroup P2P
+     * Send the elements of an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] first				Iterator to the first element to send
+     * \param[in] last				Iterator past the last element to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Send(const It first, const It last, const int dst, const int tag, const Comm &comm) {
+        Send(Iterator_ptr(first, last), Iterator_count(first, last), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Buffered send the elements of an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] first				Iterator to the first element to send
+     * \param[in] last				Iterator past the last element to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Bsend(const It first, const It last, const int dst, const int tag, const Comm &comm) {
+        Bsend(Iterator_ptr(first, last), Iterator_count(first, last), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Synchronous send the elements of an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] first				Iterator to the first element to send
+     * \param[in] last				Iterator past the last element to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Ssend(const It first, const It last, const int dst, const int tag, const Comm &comm) {
+        Ssend(Iterator_ptr(first, last), Iterator_count(first, last), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Send the elements of an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] first				Iterator to the first element to send
+     * \param[in] last				Iterator past the last element to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \param[out] rq				A request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Isend(const It first, const It last, const int dst, const int tag, const Comm &comm, Request &rq) {
+        Isend(Iterator_ptr(first, last), Iterator_count(first, last), dst, tag, comm, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Send the elements of an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] first				Iterator to the first element to send
+     * \param[in] last				Iterator past the last element to send
+     * \param[in] dst				The rank of the process to send to
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to send within
+     * \return						Returns a request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It, Request> Isend(const It first, const It last, const int dst, const int tag, const Comm &comm) {
+        return Isend(Iterator_ptr(first, last), Iterator_count(first, last), dst, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Recieve a message of known length into an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[out] first			Iterator to the first element to receive into
+     * \param[in] last				Iterator past the last element to receive into
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a status object
+     */
+    template<typename It>
+    inline enable_if_iterator<It, Status> Recv(const It first, const It last, const int src, const int tag, const Comm &comm) {
+        return Recv(Iterator_ptr(first, last), Iterator_count(first, last), src, tag, comm);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[out] first			Iterator to the first element to receive into
+     * \param[in] last				Iterator past the last element to receive into
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \param[out] rq				A request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Irecv(const It first, const It last, const int src, const int tag, const Comm &comm, Request &rq) {
+        Irecv(Iterator_ptr(first, last), Iterator_count(first, last), src, tag, comm, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message of known length into an iterator range. Element size determined by the value type of the iterator
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[out] first			Iterator to the first element to receive into
+     * \param[in] last				Iterator past the last element to receive into
+     * \param[in] src				The rank of the process to receive from
+     * \param[in] tag				A tag for the message
+     * \param[in] comm				The comm world to receive within
+     * \return						Returns a request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It, Request> Irecv(const It first, const It last, const int src, const int tag, const Comm &comm) {
+        return Irecv(Iterator_ptr(first, last), Iterator_count(first, last), src, tag, comm);
+    };
+
+#ifdef MEL_3
+    /**
+     * \ingroup P2P
+     * Recieve a message matched by Mprobe or Improbe into the given pointer
+     *
+     * \see MPI_Mrecv
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \return						Returns a status object
+     */
+    inline Status Mrecv(void *ptr, const int num, const Datatype &datatype, Message &message) {
+        Status status{};
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Mrecv(ptr, num, (MPI_Datatype) datatype, (MPI_Message*) &message, &status), "Comm::Mrecv" );
+        return status;
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message matched by Mprobe or Improbe into the given pointer
+     *
+     * \see MPI_Imrecv
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \param[out] rq				A request object
+     */
+    inline void Imrecv(void *ptr, const int num, const Datatype &datatype, Message &message, Request &rq) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Imrecv(ptr, num, (MPI_Datatype) datatype, (MPI_Message*) &message, (MPI_Request*) &rq), "Comm::Imrecv" );
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message matched by Mprobe or Improbe into the given pointer
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in] datatype			The derived datatype of the elements
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \return						Returns a request object
+     */
+    inline Request Imrecv(void *ptr, const int num, const Datatype &datatype, Message &message) {
+        Request rq{};
+        Imrecv(ptr, num, datatype, message, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup P2P
+     * Recieve a message matched by Mprobe or Improbe into the given pointer. Element size is determined from the template parameter
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \return						Returns a status object
+     */
+    template<typename T>
+    inline Status Mrecv(T *ptr, const int num, Message &message) {
+        return Mrecv(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), message);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message matched by Mprobe or Improbe into the given pointer. Element size is determined from the template parameter
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Imrecv(T *ptr, const int num, Message &message, Request &rq) {
+        Imrecv(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), message, rq);
+    };
+
+    /**
+     * \ingroup P2P
+     * Non-Blocking. Recieve a message matched by Mprobe or Improbe into the given pointer. Element size is determined from the template parameter
+     *
+     * \param[out] ptr				Pointer to the memory receive into
+     * \param[in] num				The number of elements to receive
+     * \param[in,out] message		The handle of the matched message. Set to MESSAGE_NULL
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Imrecv(T *ptr, const int num, Message &message) {
+        Request rq{};
+        Imrecv(ptr, num, message, rq);
+        return rq;
+    };
+#endif
+
+    /**
+     * \ingroup COL
+     * Broadcast an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \see MPI_Bcast
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] datatype			The derived datatype of the elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     */                                                                                                                      
+    inline void Bcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm) {                                                                            
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Bcast(ptr, num, (MPI_Datatype) datatype, root, (MPI_Comm) comm), "Comm::Bcast" );                                                                
+    };
+
+    /**
+     * \ingroup COL
+     * Scatter an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \see MPI_Scatter
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				The number of elements to scatter, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     */
+    inline void Scatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW( MPI_Scatter(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Scatter" );                                            
+    };        
+    
+    /**
+     * \ingroup COL
+     * Scatter an array to all processes in comm, where all processes have an independent number of elements to expect 
+     *
+     * \see MPI_Scatterv
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
+     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     */                                                                                                                                            
+    inline void Scatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        MEL_THROW( MPI_Scatterv(sptr, snum, displs, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Scatterv" );                                
+    };    
+                                                                                                                                                    
+    /**
+     * \ingroup COL
+     * Gather an array from all processes in comm 
+     *
+     * \see MPI_Gather
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				The number of elements to receive, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     */                                                                                                                                
+    inline void Gather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW( MPI_Gather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Gather" );                                            
+    };    
+      
+    /**
+     * \ingroup COL
+     * Gather an array from all processes in comm, where all processes have an independent number of elements to send
+     *
+     * \see MPI_Gatherv
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
+     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     */                                                                                                                                                      
+    inline void Gatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm) {
+        MEL_THROW( MPI_Gatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displs, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm), "Comm::Gatherv" );                                    
+    };
+                                                                                                                                                            
+    /**
+     * \ingroup COL
+     * Gather an array from all processes in comm and distribute it to all processes 
+     *
+     * \see MPI_Allgather
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     */                                                                                                                            
+    inline void Allgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW( MPI_Allgather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Allgather" );                                            
+    };    
+    
+    /**
+     * \ingroup COL
+     * Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
+     *
+     * \see MPI_Allgatherv
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     */                                                                                                                                                          
+    inline void Allgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm) {
+        MEL_THROW( MPI_Allgatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displ, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Allgather" );  
+    };   
+                                                                                                                                                
+    /**
+     * \ingroup COL
+     * Broadcast from all processes to all processes
+     *
+     * \see MPI_Alltoall
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				The number of elements to send
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to rnum * commsize elements to receive
+     * \param[in] rnum				The number of elements to receive from each process in comm
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     */                                                                                                                                
+    inline void Alltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW( MPI_Alltoall(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Alltoall" );                                                
+    };    
+    
+    /**
+     * \ingroup COL
+     * Broadcast from all processes to all processes with independent number of elements for each process
+     *
+     * \see MPI_Alltoallv
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     */                                                                                                                                         
+    inline void Alltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm) {
+        MEL_THROW( MPI_Alltoallv(sptr, snum, sdispl, (MPI_Datatype) sdatatype, rptr, rnum, rdispl, (MPI_Datatype) rdatatype, (MPI_Comm) comm), "Comm::Alltoallv" );                            
+    };
+
+    /**
+     * \ingroup COL
+     * Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
+     *
+     * \see MPI_Alltoallw
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
+     * \param[in] comm				The comm world to broadcast within
+     */    
+    inline void Alltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm) {
+        MEL_THROW( MPI_Alltoallw(sptr, snum, sdispl, (MPI_Datatype*) sdatatype, rptr, rnum, rdispl, (MPI_Datatype*) rdatatype, (MPI_Comm) comm), "Comm::Alltoallw" );
+    };
+
+    /**
+     * \ingroup COL
+     * Reduce an array of known length across all processes in comm using the given operation
+     *
+     * \see MPI_Reduce
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer, significant only on root
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] root				The process to receive the result
+     * \param[in] comm				The comm world to reduce within
+     */                                                                                                                             
+    inline void Reduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Reduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, root, (MPI_Comm) comm), "Comm::Reduce" );                                                
+    };                                                                                                                                                
+    
+    /**
+     * \ingroup COL
+     * Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
+     *
+     * \see MPI_Allreduce
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     */
+    inline void Allreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Allreduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm), "Comm::Allreduce" );                                            
+    };
+
+    /**
+     * \ingroup COL
+     * Inclusive prefix reduction of an array across all processes in comm. Process i receives the reduction of the values from processes 0 to i
+     *
+     * \see MPI_Scan
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     */
+    inline void Scan(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Scan(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm), "Comm::Scan" );
+    };
+
+    /**
+     * \ingroup COL
+     * Exclusive prefix reduction of an array across all processes in comm. Process i receives the reduction of the values from processes 0 to i-1. 
+     * The receive buffer on process 0 is left undefined
+     *
+     * \see MPI_Exscan
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     */
+    inline void Exscan(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Exscan(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm), "Comm::Exscan" );
+    };
+    
+#ifdef MEL_3
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \see MPI_Ibcast
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] datatype			The derived datatype of the elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */
+    inline void Ibcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW(MPI_Ibcast(ptr, num, (MPI_Datatype) datatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibcast");
+    };
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] datatype			The derived datatype of the elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */
+    inline Request Ibcast(void *ptr, const int num, const Datatype &datatype, const int root, const Comm &comm) {
+        Request rq{};
+        Ibcast(ptr, num, datatype, root, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Scatter an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \see MPI_Iscatter
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				The number of elements to scatter, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     * \param[out] rq				A request object
+     */
+    inline void Iscatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW(MPI_Iscatter(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatter");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Scatter an array to all processes in comm, where all processes know how many elements to expect 
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				The number of elements to scatter, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     * \return						Returns a request object
+     */
+    inline Request Iscatter(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        Request rq{};
+        Iscatter(sptr, snum, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Scatter an array to all processes in comm, where all processes have an independent number of elements to expect
+     *
+     * \see MPI_Iscatterv 
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
+     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     * \param[out] rq				A request object
+     */
+    inline void Iscatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
+        MEL_THROW(MPI_Iscatterv(sptr, snum, displs, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatterv");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Scatter an array to all processes in comm, where all processes have an independent number of elements to expect 
+     *
+     * \param[in] sptr				Pointer to the memory to scatter, significant only on root
+     * \param[in] snum				Pointer to an array of number of elements to send to each process, significant only on root
+     * \param[in] displs			Pointer to an array of the element displacements of where each processes data is to be sent, significant only on root
+     * \param[in] sdatatype			The derived datatype of the elements to send, significant only on root
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to scatter within
+     * \return						Returns a request object
+     */
+    inline Request Iscatterv(void *sptr, const int *snum, const int *displs, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        Request rq{};
+        Iscatterv(sptr, snum, displs, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm 
+     *
+     * \see MPI_Igather
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				The number of elements to receive, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     * \param[out] rq				A request object
+     */ 
+    inline void Igather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW(MPI_Igather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igather");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm 
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				The number of elements to receive, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     * \return						Returns a request object
+     */ 
+    inline Request Igather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const int root, const Comm &comm) {
+        Request rq{};
+        Igather(sptr, snum, sdatatype, rptr, rnum, rdatatype, root, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm, where all processes have an independent number of elements to send
+     *
+     * \see MPI_Igatherv
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
+     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     * \param[out] rq				A request object
+     */ 
+    inline void Igatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm, Request &rq) {
+        MEL_THROW(MPI_Igatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displs, (MPI_Datatype) rdatatype, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igatherv");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm, where all processes have an independent number of elements to send
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into, significant only on root
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process, significant only on root
+     * \param[in] displs			Pointer to an array of the displacements of elements to be received from each process, significant only on root
+     * \param[in] rdatatype			The derived datatype of the elements to receive, significant only on root
+     * \param[in] root				The rank of the process to send to
+     * \param[in] comm				The comm world to gather within
+     * \return						Returns a request object
+     */ 
+    inline Request Igatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displs, const Datatype &rdatatype, const int root, const Comm &comm) {
+        Request rq{};
+        Igatherv(sptr, snum, sdatatype, rptr, rnum, displs, rdatatype, root, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes 
+     *
+     * \see MPI_Iallgather
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     * \param[out] rq				A request object
+     */  
+    inline void Iallgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW(MPI_Iallgather(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes 
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				The number of elements to receive
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     * \return						Returns a request object
+     */  
+    inline Request Iallgather(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
+        Request rq{};
+        Iallgather(sptr, snum, sdatatype, rptr, rnum, rdatatype, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
+     *
+     * \see MPI_Iallgatherv
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     * \param[out] rq				A request object
+     */  
+    inline void Iallgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm, Request &rq) {
+        MEL_THROW(MPI_Iallgatherv(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, displ, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Gather an array from all processes in comm and distribute it to all processes, where all processes have an independent number of elements to send
+     *
+     * \param[in] sptr				Pointer to the memory to gather
+     * \param[in] snum				The number of elements to gather
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the memory to receive into
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] displ				Pointer to an array of the element displacements of where each processes data is to be received
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to gather within
+     * \return						Returns a request object
+     */  
+    inline Request Iallgatherv(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int *rnum, const int *displ, const Datatype &rdatatype, const Comm &comm) {
+        Request rq{};
+        Iallgatherv(sptr, snum, sdatatype, rptr, rnum, displ, rdatatype, comm, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes
+     *
+     * \see MPI_Ialltoall
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				The number of elements to send
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to rnum * commsize elements to receive
+     * \param[in] rnum				The number of elements to receive from each process in comm
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */
+    inline void Ialltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(snum, sdatatype);
+        MEL_THROW(MPI_Ialltoall(sptr, snum, (MPI_Datatype) sdatatype, rptr, rnum, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoall");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				The number of elements to send
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to rnum * commsize elements to receive
+     * \param[in] rnum				The number of elements to receive from each process in comm
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */
+    inline Request Ialltoall(void *sptr, const int snum, const Datatype &sdatatype, void *rptr, const int rnum, const Datatype &rdatatype, const Comm &comm) {
+        Request rq{};
+        Ialltoall(sptr, snum, sdatatype, rptr, rnum, rdatatype, comm, rq);
+        return rq;
+    };
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes with independent number of elements for each process
+     *
+     * \see MPI_Ialltoallv
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */
+    inline void Ialltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm, Request &rq) {
+        MEL_THROW(MPI_Ialltoallv(sptr, snum, sdispl, (MPI_Datatype) sdatatype, rptr, rnum, rdispl, (MPI_Datatype) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallv");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes with independent number of elements for each process
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			The derived datatype of the elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			The derived datatype of the elements to receive
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */
+    inline Request Ialltoallv(void *sptr, const int *snum, const int *sdispl, const Datatype &sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype &rdatatype, const Comm &comm) {
+        Request rq{};
+        Ialltoallv(sptr, snum, sdispl, sdatatype, rptr, rnum, rdispl, rdatatype, comm, rq);
+        return rq;
+    };
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
+     *
+     * \see MPI_Ialltoallw
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */   
+    inline void Ialltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm, Request &rq) {
+        MEL_THROW(MPI_Ialltoallw(sptr, snum, sdispl, (MPI_Datatype*) sdatatype, rptr, rnum, rdispl, (MPI_Datatype*) rdatatype, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallw");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast from all processes to all processes with independent derived datatypes and number of elements for each process
+     *
+     * \param[in] sptr				Pointer to snum elements to send
+     * \param[in] snum				Pointer to an array of the number of elements to send from each process
+     * \param[in] sdispl			Pointer to an array of element displacements of where each processes data is to be sent from
+     * \param[in] sdatatype			Pointer to an array of the derived datatypes of the elements to send for each process
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] rnum				Pointer to an array of the number of elements to receive from each process
+     * \param[in] rdispl			Pointer to an array of element displacements of where each processes data is to be recieved to
+     * \param[in] rdatatype			Pointer to an array of the derived datatypes of the elements to receive for each process
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */   
+    inline Request Ialltoallw(void *sptr, const int *snum, const int *sdispl, const Datatype *sdatatype, void *rptr, const int *rnum, const int *rdispl, const Datatype *rdatatype, const Comm &comm) {
+        Request rq{};
+        Ialltoallw(sptr, snum, sdispl, sdatatype, rptr, rnum, rdispl, rdatatype, comm, rq);
+        return rq;
+    };
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation
+     *
+     * \see MPI_Ireduce
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer, significant only on root
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] root				The process to receive the result
+     * \param[in] comm				The comm world to reduce within
+     * \param[out] rq				A request object
+     */     
+    inline void Ireduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW(MPI_Ireduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ireduce");
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer, significant only on root
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] root				The process to receive the result
+     * \param[in] comm				The comm world to reduce within
+     * \return						Returns a request object
+     */     
+    inline Request Ireduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const int root, const Comm &comm) {
+        Request rq{};
+        Ireduce(sptr, rptr, num, datatype, op, root, comm, rq);
+        return rq;
+    };    
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
+     *
+     * \see MPI_Iallreduce
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     * \param[out] rq				A request object
+     */
+    inline void Iallreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm, Request &rq) {
+        MEL_PROFILE_BYTES(num, datatype);
+        MEL_THROW( MPI_Iallreduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallreduce" );                            
+    }; 
+    
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
+     *
+     * \param[in] sptr				Pointer to num elements to send
+     * \param[out] rptr				Pointer to the receive buffer
+     * \param[in] num				The number of elements in the array
+     * \param[in] datatype			The derived datatype of the elements to reduce
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     * \return						Returns a request object
+     */                                                                                                                                                       
+    inline Request Iallreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
+        Request rq{};                                                                                                                                        
+        Iallreduce(sptr, rptr, num, datatype, op, comm, rq);                                                                                                    
+        return rq;                                                                                                                                            
+    };
+#endif
+
+    /// \cond HIDE
+#define MEL_COLLECTIVE(T, D) inline void Bcast(T *ptr, const int num, const int root, const Comm &comm) {                                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                          \
+        MEL_THROW( MPI_Bcast(ptr, num, D, root, (MPI_Comm) comm), "Comm::Bcast( " #T ", " #D " )" );                                                        \
+    }                                                                                                                                                        \
+    /* Scatter / Scatterv */                                                                                                                                \
+    inline void Scatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                          \
+        MEL_THROW( MPI_Scatter(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Scatter( " #T ", " #D " )" );                                    \
+    }                                                                                                                                                        \
+    inline void Scatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm) {                            \
+        MEL_THROW( MPI_Scatterv(sptr, snum, displs, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Scatterv( " #T ", " #D " )" );                            \
+    }                                                                                                                                                        \
+    /* Gather / Gatherv */                                                                                                                                    \
+    inline void Gather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                            \
+        MEL_THROW( MPI_Gather(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Gather( " #T ", " #D " )" );                                        \
+    }                                                                                                                                                        \
+    inline void Gatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm) {                            \
+        MEL_THROW( MPI_Gatherv(sptr, snum, D, rptr, rnum, displs, D, root, (MPI_Comm) comm), "Comm::Gatherv( " #T ", " #D " )" );                            \
+    }                                                                                                                                                        \
+    /* Allgather / Allgatherv */                                                                                                                            \
+    inline void Allgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                            \
+        MEL_THROW( MPI_Allgather(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm), "Comm::Allgather( " #T ", " #D " )" );                                        \
+    }                                                                                                                                                        \
+    inline void Allgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm) {                                            \
+        MEL_THROW( MPI_Allgatherv(sptr, snum, D, rptr, rnum, displ, D, (MPI_Comm) comm), "Comm::Allgatherv( " #T ", " #D " )" );                            \
+    }                                                                                                                                                        \
+    /* Alltoall / Alltoallv */                                                                                                                                \
+    inline void Alltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                          \
+        MEL_THROW( MPI_Alltoall(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm), "Comm::Alltoall( " #T ", " #D " )" );                                        \
+    }                                                                                                                                                        \
+    inline void Alltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm) {                        \
+        MEL_THROW( MPI_Alltoallv(sptr, snum, sdispl, D, rptr, rnum, rdispl, D, (MPI_Comm) comm), "Comm::Alltoallv( " #T ", " #D " )" );                        \
+    }                                                                                                                                                        \
+    /* Reduce / Allreduce */                                                                                                                                \
+    inline void Reduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm) {                                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                            \
+        MEL_THROW( MPI_Reduce(sptr, rptr, num, D, (MPI_Op) op, root, (MPI_Comm) comm), "Comm::Reduce( " #T ", " #D " )" );                                    \
+    }                                                                                                                                                        \
+    inline void Allreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                                \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                            \
+        MEL_THROW( MPI_Allreduce(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm), "Comm::Allreduce( " #T ", " #D " )" );                                    \
+    }                                                                                                                                                        \
+    /* Scan / Exscan */                                                                                                                                      \
+    inline void Scan(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                                      \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                           \
+        MEL_THROW( MPI_Scan(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm), "Comm::Scan( " #T ", " #D " )" );                                             \
+    }                                                                                                                                                        \
+    inline void Exscan(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                           \
+        MEL_THROW( MPI_Exscan(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm), "Comm::Exscan( " #T ", " #D " )" );                                         \
+    }                                                                                                                                                        
+
+#define MEL_3_COLLECTIVE(T, D) inline void Ibcast(T *ptr, const int num, const int root, const Comm &comm, Request &rq) {                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                            \
+        MEL_THROW( MPI_Ibcast(ptr, num, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibcast( " #T ", " #D " )" );                                    \
+    }                                                                                                                                                        \
+    inline Request Ibcast(T *ptr, const int num, const int root, const Comm &comm) {                                                                        \
+        Request rq{};                                                                                                                                        \
+        Ibcast(ptr, num, root, comm, rq);                                                                                                                    \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    /* Scatter / Scatterv */                                                                                                                                \
+    inline void Iscatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {                                    \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                            \
+        MEL_THROW( MPI_Iscatter(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatter( " #T ", " #D " )" );                \
+    }                                                                                                                                                        \
+    inline Request Iscatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                            \
+        Request rq{};                                                                                                                                        \
+        Iscatter(sptr, snum, rptr, rnum, root, comm, rq);                                                                                                    \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    inline void Iscatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {            \
+        MEL_THROW( MPI_Iscatterv(sptr, snum, displs, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatterv( " #T ", " #D " )" );    \
+    }                                                                                                                                                        \
+    inline Request Iscatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm) {                        \
+        Request rq{};                                                                                                                                        \
+        Iscatterv(sptr, snum, displs, rptr, rnum, root, comm, rq);                                                                                            \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    /* Gather / Gatherv */                                                                                                                                    \
+    inline void Igather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {                                    \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                          \
+        MEL_THROW( MPI_Igather(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igather( " #T ", " #D " )" );                \
+    }                                                                                                                                                        \
+    inline Request Igather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                            \
+        Request rq{};                                                                                                                                        \
+        Igather(sptr, snum, rptr, rnum, root, comm, rq);                                                                                                    \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    inline void Igatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm, Request &rq) {                \
+        MEL_THROW( MPI_Igatherv(sptr, snum, D, rptr, rnum, displs, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igatherv( " #T ", " #D " )" );        \
+    }                                                                                                                                                        \
+    inline Request Igatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm) {                        \
+        Request rq{};                                                                                                                                        \
+        Igatherv(sptr, snum, rptr, rnum, displs, root, comm, rq);                                                                                            \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    /* Allgather / Allgatherv */                                                                                                                            \
+    inline void Iallgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm, Request &rq) {                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                          \
+        MEL_THROW( MPI_Iallgather(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather( " #T ", " #D " )" );                \
+    }                                                                                                                                                        \
+    inline Request Iallgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                            \
+        Request rq{};                                                                                                                                        \
+        Iallgather(sptr, snum, rptr, rnum, comm, rq);                                                                                                        \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    inline void Iallgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm, Request &rq) {                            \
+        MEL_THROW( MPI_Iallgatherv(sptr, snum, D, rptr, rnum, displ, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgatherv( " #T ", " #D " )" );        \
+    }                                                                                                                                                        \
+    inline Request Iallgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm) {                                        \
+        Request rq{};                                                                                                                                        \
+        Iallgatherv(sptr, snum, rptr, rnum, displ, comm, rq);                                                                                                \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    /* Alltoall / Alltoallv */                                                                                                                                \
+    inline void Ialltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm, Request &rq) {                                                \
+        MEL_PROFILE_BYTES(snum, D);                                                                                                                            \
+        MEL_THROW( MPI_Ialltoall(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoall( " #T ", " #D " )" );                    \
+    }                                                                                                                                                        \
+    inline Request Ialltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                            \
+        Request rq{};                                                                                                                                        \
+        Ialltoall(sptr, snum, rptr, rnum, comm, rq);                                                                                                        \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    inline void Ialltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm, Request &rq) {        \
+        MEL_THROW( MPI_Ialltoallv(sptr, snum, sdispl, D, rptr, rnum, rdispl, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallv( " #T ", " #D " )" );    \
+    }                                                                                                                                                        \
+    inline Request Ialltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm) {                    \
+        Request rq{};                                                                                                                                        \
+        Ialltoallv(sptr, snum, sdispl, rptr, rnum, rdispl, comm, rq);                                                                                        \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    /* Reduce / Allreduce */                                                                                                                                \
+    inline void Ireduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm, Request &rq) {                                        \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                          \
+        MEL_THROW( MPI_Ireduce(sptr, rptr, num, D, (MPI_Op) op, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ireduce( " #T ", " #D " )" );            \
+    }                                                                                                                                                        \
+    inline Request Ireduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm) {                                                \
+        Request rq{};                                                                                                                                        \
+        Ireduce(sptr, rptr, num, op, root, comm, rq);                                                                                                        \
+        return rq;                                                                                                                                            \
+    }                                                                                                                                                        \
+    inline void Iallreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm, Request &rq) {                                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                          \
+        MEL_THROW( MPI_Iallreduce(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallreduce( " #T ", " #D " )" );            \
+    }                                                                                                                                                        \
+    inline Request Iallreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                            \
+        Request rq{};                                                                                                                                        \
+        Iallreduce(sptr, rptr, num, op, comm, rq);                                                                                                            \
+        return rq;                                                                                                                                            \
+    }
+
+    MEL_COLLECTIVE(char,                        MPI_CHAR);
+    MEL_COLLECTIVE(wchar_t,                        MPI_WCHAR);
+
+    MEL_COLLECTIVE(float,                        MPI_FLOAT);
+    MEL_COLLECTIVE(double,                        MPI_DOUBLE);
+    MEL_COLLECTIVE(long double,                    MPI_LONG_DOUBLE);
+
+    MEL_COLLECTIVE(int8_t,                        MPI_INT8_T);
+    MEL_COLLECTIVE(int16_t,                        MPI_INT16_T);
+    MEL_COLLECTIVE(int32_t,                        MPI_INT32_T);
+    MEL_COLLECTIVE(int64_t,                        MPI_INT64_T);
+
+    MEL_COLLECTIVE(uint8_t,                        MPI_UINT8_T);
+    MEL_COLLECTIVE(uint16_t,                    MPI_UINT16_T);
+    MEL_COLLECTIVE(uint32_t,                    MPI_UINT32_T);
+    MEL_COLLECTIVE(uint64_t,                    MPI_UINT64_T);
+
+#ifdef MEL_3
+    MEL_COLLECTIVE(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
+    MEL_COLLECTIVE(std::complex<double>,        MPI_CXX_DOUBLE_COMPLEX);
+    MEL_COLLECTIVE(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_COLLECTIVE(bool,                        MPI_CXX_BOOL);
+
+    MEL_3_COLLECTIVE(char,                        MPI_CHAR);
+    MEL_3_COLLECTIVE(wchar_t,                    MPI_WCHAR);
+
+    MEL_3_COLLECTIVE(float, MPI_FLOAT);
+    MEL_3_COLLECTIVE(double,                    MPI_DOUBLE);
+    MEL_3_COLLECTIVE(long double,                MPI_LONG_DOUBLE);
+
+    MEL_3_COLLECTIVE(int8_t,                    MPI_INT8_T);
+    MEL_3_COLLECTIVE(int16_t,                    MPI_INT16_T);
+    MEL_3_COLLECTIVE(int32_t,                    MPI_INT32_T);
+    MEL_3_COLLECTIVE(int64_t,                    MPI_INT64_T);
+
+    MEL_3_COLLECTIVE(uint8_t,                    MPI_UINT8_T);
+    MEL_3_COLLECTIVE(uint16_t,                    MPI_UINT16_T);
+    MEL_3_COLLECTIVE(uint32_t,                    MPI_UINT32_T);
+    MEL_3_COLLECTIVE(uint64_t,                    MPI_UINT64_T);
+
+    MEL_3_COLLECTIVE(std::complex<float>,        MPI_CXX_FLOAT_COMPLEX);
+    MEL_3_COLLECTIVE(std::complex<double>,        MPI_CXX_DOUBLE_COMPLEX);
+    MEL_3_COLLECTIVE(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_3_COLLECTIVE(bool,                        MPI_CXX_BOOL);
+#endif
+
+#undef MEL_COLLECTIVE
+#undef MEL_3_COLLECTIVE
+    /// \endcond
+
+    /**
+     * \ingroup COL
+     * Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     */
+    template<typename T>
+    inline void Bcast(T *ptr, const int num, const int root, const Comm &comm) {
+        Bcast(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), root, comm);
+    };
+
+#ifdef MEL_3
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */
+    template<typename T>
+    inline void Ibcast(T *ptr, const int num, const int root, const Comm &comm, Request &rq) {
+        Ibcast(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), root, comm, rq);
+    }; 
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     *
+     * \param[in,out] ptr			Pointer to the memory receive into
+     * \param[in] num				The number of elements to broadcast
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */
+    template<typename T>
+    inline Request Ibcast(T *ptr, const int num, const int root, const Comm &comm) {
+        return Ibcast(ptr, Datatype_count<T>(num), Datatype_select<T>(MEL::Datatype::CHAR), root, comm);
+    };
+
+#endif
+
+    /**
+     * \ingroup COL
+     * Broadcast the elements of an iterator range to all processes in comm, where all processes know how many elements to expect
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in,out] first			Iterator to the first element to broadcast or receive into
+     * \param[in] last				Iterator past the last element
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Bcast(const It first, const It last, const int root, const Comm &comm) {
+        Bcast(Iterator_ptr(first, last), Iterator_count(first, last), root, comm);
+    };
+
+    /**
+     * \ingroup COL
+     * Reduce the elements of an iterator range across all processes in comm, storing the result on all processes
+     *
+     * \warning Both ranges must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] sfirst			Iterator to the first element to reduce
+     * \param[in] slast				Iterator past the last element to reduce
+     * \param[out] rfirst			Iterator to the first element to receive into
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     */
+    template<typename It, typename Ot>
+    inline enable_if_iterator<It, enable_if_iterator<Ot>> Allreduce(const It sfirst, const It slast, const Ot rfirst, const Op &op, const Comm &comm) {
+        const int num = Iterator_count(sfirst, slast);
+        Allreduce(Iterator_ptr(sfirst, slast), Iterator_ptr(rfirst, rfirst + num), num, op, comm);
+    };
+
+#ifdef MEL_3
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast the elements of an iterator range to all processes in comm, where all processes know how many elements to expect
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in,out] first			Iterator to the first element to broadcast or receive into
+     * \param[in] last				Iterator past the last element
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \param[out] rq				A request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It> Ibcast(const It first, const It last, const int root, const Comm &comm, Request &rq) {
+        Ibcast(Iterator_ptr(first, last), Iterator_count(first, last), root, comm, rq);
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Broadcast the elements of an iterator range to all processes in comm, where all processes know how many elements to expect
+     *
+     * \warning The range must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in,out] first			Iterator to the first element to broadcast or receive into
+     * \param[in] last				Iterator past the last element
+     * \param[in] root				The rank of the process to send from
+     * \param[in] comm				The comm world to broadcast within
+     * \return						Returns a request object
+     */
+    template<typename It>
+    inline enable_if_iterator<It, Request> Ibcast(const It first, const It last, const int root, const Comm &comm) {
+        return Ibcast(Iterator_ptr(first, last), Iterator_count(first, last), root, comm);
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce the elements of an iterator range across all processes in comm, storing the result on all processes
+     *
+     * \warning Both ranges must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] sfirst			Iterator to the first element to reduce
+     * \param[in] slast				Iterator past the last element to reduce
+     * \param[out] rfirst			Iterator to the first element to receive into
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     * \param[out] rq				A request object
+     */
+    template<typename It, typename Ot>
+    inline enable_if_iterator<It, enable_if_iterator<Ot>> Iallreduce(const It sfirst, const It slast, const Ot rfirst, const Op &op, const Comm &comm, Request &rq) {
+        const int num = Iterator_count(sfirst, slast);
+        Iallreduce(Iterator_ptr(sfirst, slast), Iterator_ptr(rfirst, rfirst + num), num, op, comm, rq);
+    };
+
+    /**
+     * \ingroup COL
+     * Non-Blocking. Reduce the elements of an iterator range across all processes in comm, storing the result on all processes
+     *
+     * \warning Both ranges must be contiguous in memory, such as from a std::vector, std::array, std::basic_string or raw array
+     *
+     * \param[in] sfirst			Iterator to the first element to reduce
+     * \param[in] slast				Iterator past the last element to reduce
+     * \param[out] rfirst			Iterator to the first element to receive into
+     * \param[in] op				The operation to perform for the reduction
+     * \param[in] comm				The comm world to reduce within
+     * \return						Returns a request object
+     */
+    template<typename It, typename Ot>
+    inline enable_if_iterator<It, enable_if_iterator<Ot, Request>> Iallreduce(const It sfirst, const It slast, const Ot rfirst, const Op &op, const Comm &comm) {
+        const int num = Iterator_count(sfirst, slast);
+        return Iallreduce(Iterator_ptr(sfirst, slast), Iterator_ptr(rfirst, rfirst + num), num, op, comm);
+    };
+#endif
+
+    enum class LockType {
+        EXCLUSIVE = MPI_LOCK_EXCLUSIVE,
+        SHARED = MPI_LOCK_SHARED
+    };
+
+    struct Win {
+        static const Win WIN_NULL;
+
+        MPI_Win win;
+
+        Win() : win(MPI_WIN_NULL) {};
+        explicit Win(const MPI_Win &_w) : win(_w) {};
+        inline Win& operator=(const MPI_Win &_w) {
+            win = _w;
+            return *this;
+        };
+        explicit operator MPI_Win() const {
+            return win;
+        };
+
+        inline bool operator==(const Win &rhs) const {
+            return win == rhs.win;
+        };
+        inline bool operator!=(const Win &rhs) const {
+            return win != rhs.win;
+        };
+    };
+
+#ifdef MEL_IMPLEMENTATION
+    const Win Win::WIN_NULL = Win(MPI_WIN_NULL);
+#endif
+
+    /**
+     * \ingroup  Win
+     * Create a window error handler
+     *
+     * \see MPI_Win_create_errhandler
+     *
+     * \param[in] func	The function to use
+     * \return			Returns a handle to an error handler
+     */
+    inline ErrorHandler WinCreateErrorHandler(ErrorHandlerFunc func) {
+        MPI_Errhandler errHndl;
+        MEL_THROW( MPI_Win_create_errhandler((MPI_Win_errhandler_function*) func, &errHndl), "RMA::WinCreateErrorHandler" );
+        return ErrorHandler(errHndl);
+    };
+
+    /**
+     * \ingroup  Win
+     * Set the error handler for a window
+     *
+     * \see MPI_Win_set_errhandler
+     *
+     * \param[in] win		The file to attach to
+     * \param[in] errHndl	The handler to use
+     */
+    inline void WinSetErrorHandler(const Win &win, const ErrorHandler &errHndl) {
+        MEL_THROW( MPI_Win_set_errhandler((MPI_Win) win, (MPI_Errhandler) errHndl), "RMA::WinSetErrorHandler" );
+    };
+
+    /**
+     * \ingroup  Win
+     * Set the error handler for a window
+     *
+     * \param[in] win	The file to attach to
+     * \param[in] func	The function to use
+     */
+    inline void WinSetErrorHandler(const Win &win, ErrorHandlerFunc func) {
+        WinSetErrorHandler(win, WinCreateErrorHandler(func));
+    };
+
+    /**
+     * \ingroup  Win
+     * Get the error handler for a window
+     *
+     * \see MPI_Win_get_errhandler
+     *
+     * \param[in] win	The file to attach to
+     * \return			Returns a handle to the error handler
+     */
+    inline ErrorHandler WinGetErrorHandler(const Win &win) {
+        MPI_Errhandler errHndl;
+        MEL_THROW( MPI_Win_get_errhandler((MPI_Win) win, &errHndl), "RMA::WinGetErrorHandler");
+        return ErrorHandler(errHndl);
+    };
+
+    /**
+     * \ingroup  Win
+     * Create a window on memory allocated with MPI/MEL alloc functions
+     *
+     * \see MPI_Win_create, MPI_Win_set_errhandler
+     *
+     * \param[in] ptr			Pointer to the memory to be mapped
+     * \param[in] size			The number of elements to be mapped
+     * \param[in] disp_unit		The size of each element in bytes
+     * \param[in] comm			The comm world to map the window within
+     * \param[in] info			Hints for the implementation, such as no_locks or accumulate_ordering
+     * \return					Returns a handle to the window
+     */
+    inline Win WinCreate(void *ptr, const Aint size, const int disp_unit, const Comm &comm, const Info &info) {
+        MPI_Win win;                                                                        
+        MEL_THROW( MPI_Win_create(ptr, size * disp_unit, disp_unit, (MPI_Info) info, (MPI_Comm) comm, (MPI_Win*) &win), "RMA::WinCreate" );
+        MEL_THROW( MPI_Win_set_errhandler(win, MPI_ERRORS_RETURN), "RMA::WinCreate(SetErrorHandler)" );                                                                
+        return Win(win);
+    };
+
+    /**
+     * \ingroup  Win
+     * Create a window on memory allocated with MPI/MEL alloc functions
+     *
+     * \param[in] ptr			Pointer to the memory to be mapped
+     * \param[in] size			The number of elements to be mapped
+     * \param[in] disp_unit		The size of each element in bytes
+     * \param[in] comm			The comm world to map the window within
+     * \return					Returns a handle to the window
+     */
+    inline Win WinCreate(void *ptr, const Aint size, const int disp_unit, const Comm &comm) {
+        return WinCreate(ptr, size, disp_unit, comm, MEL::Info::INFO_NULL);
+    };
+    
+    /**
+     * \ingroup  Win
+     * Create a window on memory allocated with MPI/MEL alloc functions. Element size determined from template parameter
+     *
+     * \param[in] ptr			Pointer to the memory to be mapped
+     * \param[in] size			The number of elements to be mapped
+     * \param[in] comm			The comm world to map the window within
+     * \return					Returns a handle to the window
+     */
+    template<typename T> 
+    inline Win WinCreate(T *ptr, const Aint size, const Comm &comm) {
+        return WinCreate(ptr, size, sizeof(T), comm);
+    };
+
+    /**
+     * \ingroup  Win
+     * Create a window on memory allocated with MPI/MEL alloc functions. Element size determined from template parameter
+     *
+     * \param[in] ptr			Pointer to the memory to be mapped
+     * \param[in] size			The number of elements to be mapped
+     * \param[in] comm			The comm world to map the window within
+     * \param[in] info			Hints for the implementation
+     * \return					Returns a handle to the window
+     */
+    template<typename T> 
+    inline Win WinCreate(T *ptr, const Aint size, const Comm &comm, const Info &info) {
+        return WinCreate(ptr, size, sizeof(T), comm, info);
+    };
+
+#ifdef MEL_3
+
+    /**
+     * \ingroup  Win
+     * Create a window with no memory attached. Memory is exposed and withdrawn locally by each process with WinAttach / WinDetach
+     *
+     * \see MPI_Win_create_dynamic, MPI_Win_set_errhandler
+     *
+     * \param[in] comm			The comm world to map the window within
+     * \param[in] info			Hints for the implementation
+     * \return					Returns a handle to the window
+     */
+    inline Win WinCreateDynamic(const Comm &comm, const Info &info) {
+        MPI_Win win;
+        MEL_THROW( MPI_Win_create_dynamic((MPI_Info) info, (MPI_Comm) comm, (MPI_Win*) &win), "RMA::WinCreateDynamic" );
+        MEL_THROW( MPI_Win_set_errhandler(win, MPI_ERRORS_RETURN), "RMA::WinCreateDynamic(SetErrorHandler)" );
+        return Win(win);
+    };
+
+    /**
+     * \ingroup  Win
+     * Create a window with no memory attached
+     *
+     * \param[in] comm			The comm world to map the window within
+     * \return					Returns a handle to the window
+     */
+    inline Win WinCreateDynamic(const Comm &comm) {
+        return WinCreateDynamic(comm, MEL::Info::INFO_NULL);
+    };
+
+    /**
+     * \ingroup  Win
+     * Attach local memory to a dynamic window. Remote processes address it by the value returned from GetAddress
+     *
+     * \see MPI_Win_attach
+     *
+     * \param[in] win			The dynamic window to attach to
+     * \param[in] ptr			Pointer to the memory to be attached
+     * \param[in] size			The size of the memory in bytes
+     */
+    inline void WinAttach(const Win &win, void *ptr, const Aint size) {
+        MEL_THROW( MPI_Win_attach((MPI_Win) win, ptr, size), "RMA::WinAttach" );
+    };
+
+    /**
+     * \ingroup  Win
+     * Attach local memory to a dynamic window. Element size determined from template parameter
+     *
+     * \param[in] win			The dynamic window to attach to
+     * \param[in] ptr			Pointer to the memory to be attached
+     * \param[in] num			The number of elements to be attached
+     */
+    template<typename T>
+    inline void WinAttach(const Win &win, T *ptr, const Aint num) {
+        WinAttach(win, (void*) ptr, num * sizeof(T));
+    };
+
+    /**
+     * \ingroup  Win
+     * Detach previously attached local memory from a dynamic window
+     *
+     * \see MPI_Win_detach
+     *
+     * \param[in] win			The dynamic window to detach from
+     * \param[in] ptr			Pointer to the start of the attached memory
+     */
+    inline void WinDetach(const Win &win, const void *ptr) {
+        MEL_THROW( MPI_Win_detach((MPI_Win) win, ptr), "RMA::WinDetach" );
+    };
+
+    /**
+     * \ingroup  Win
+     * Get the absolute address of a location in memory. Used as the target displacement for dynamic windows
+     *
+     * \see MPI_Get_address
+     *
+     * \param[in] ptr			The location in memory
+     * \return					Returns the address
+     */
+    inline Aint GetAddress(const void *ptr) {
+        Aint addr;
+        MEL_THROW( MPI_Get_address(ptr, &addr), "RMA::GetAddress" );
+        return addr;
+    };
+
+#endif
+
+    /**
+     * \ingroup  Win
+     * Synchronize the RMA access epoch for win across all processes attached to it
+     *
+     * \see MPI_Win_fence
+     *
+     * \param[in] win			The window to synchronize
+     * \param[in] assert_tag	Program assertion
+     */
+    inline void WinFence(const Win &win, const int assert_tag) {
+        MEL_THROW( MPI_Win_fence(assert_tag, (MPI_Win) win), "RMA::WinFence" );
+        MEL_TRACE_EPOCH_END(win, -2, "RMA::Epoch::Fence");
+        if ((assert_tag & MPI_MODE_NOSUCCEED) == 0) { MEL_TRACE_EPOCH_BEGIN(win, -2); }
+    };
+    
+    /**
+     * \ingroup  Win
+     * Synchronize the RMA access epoch for win across all processes attached to it
+     *
+     * \param[in] win			The window to synchronize
+     */
+    inline void WinFence(const Win &win) {
+        WinFence(win, 0);
+    };
+
+    /**
+     * \ingroup  Win
+     * Get the lock on an RMA access epoch for a window
+     *
+     * \see MPI_Win_lock
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     * \param[in] assert_tag	Program assertion
+     * \param[in] lock_type		The mode to get the lock in
+     */
+    inline void WinLock(const Win &win, const int rank, const int assert_tag, const LockType lock_type) {
+        MEL_THROW( MPI_Win_lock((int) lock_type, rank, assert_tag, (MPI_Win) win), "RMA::WinLock" );
+        MEL_TRACE_EPOCH_BEGIN(win, rank);
+    };
+    
+    /**
+     * \ingroup  Win
+     * Get the lock on an RMA access epoch for a window
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     * \param[in] lock_type		The mode to get the lock in
+     */
+    inline void WinLock(const Win &win, const int rank, const LockType lock_type) {
+        WinLock(win, rank, 0, lock_type);
+    };
+
+    /**
+     * \ingroup  Win
+     * Get an exclusive lock on an RMA access epoch for a window
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     * \param[in] assert_tag	Program assertion
+     */
+    inline void WinLockExclusive(const Win &win, const int rank, const int assert_tag) {
+        WinLock(win, rank, assert_tag, LockType::EXCLUSIVE);
+    };
+    
+    /**
+     * \ingroup  Win
+     * Get an exclusive lock on an RMA access epoch for a window
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     */
+    inline void WinLockExclusive(const Win &win, const int rank) {
+        WinLockExclusive(win, rank, 0);
+    };
+
+    /**
+     * \ingroup  Win
+     * Get a shared lock on an RMA access epoch for a window
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     * \param[in] assert_tag	Program assertion
+     */
+    inline void WinLockShared(const Win &win, const int rank, const int assert_tag) {
+        WinLock(win, rank, assert_tag, LockType::SHARED);
+    };
+
+    /**
+     * \ingroup  Win
+     * Get a shared lock on an RMA access epoch for a window
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     */
+    inline void WinLockShared(const Win &win, const int rank) {
+        WinLockShared(win, rank, 0);
+    };
+
+    /**
+     * \ingroup  Win
+     * Release the lock on an RMA access epoch for a window
+     *
+     * \see MPI_Win_unlock
+     *
+     * \param[in] win			The window to lock
+     * \param[in] rank			The process rank to get the lock from
+     */
+    inline void WinUnlock(const Win &win, const int rank) {
+        MEL_THROW( MPI_Win_unlock(rank, (MPI_Win) win), "RMA::WinUnlock" );
+        MEL_TRACE_EPOCH_END(win, rank, "RMA::Epoch::Lock");
+    };
+
+    /**
+     * \ingroup  Win
+     * Put data into the mapped window of another process
+     *
+     * \see MPI_Put
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     */
+    inline void Put(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW( MPI_Put(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win), "RMA::Put" );
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process
+     *
+     * \see MPI_Accumulate
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     */
+    inline void Accumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW( MPI_Accumulate(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Op) op, (MPI_Win) win), "RMA::Accumulate" );
+    };
+
+    /**
+     * \ingroup  Win
+     * Get data from the mapped window of another process
+     *
+     * \see MPI_Get
+     *
+     * \param[out] origin_ptr		Pointer to the array to get
+     * \param[in] origin_num		The number of elements to get into the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
+     * \param[in] target_disp		Element displacement into the window to get data from
+     * \param[in] target_num		The number of elements to get from the window
+     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
+     * \param[in] target_rank		Rank of the process to get from
+     * \param[in] win				The window to get from
+     */
+    inline void Get(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_GET(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW( MPI_Get(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win), "RMA::Get" );
+    };
+
+#ifdef MEL_3
+    
+    /**
+     * \ingroup  Win
+     * Get the lock on an RMA access epoch for a window on all attached processes
+     *
+     * \see MPI_Win_lock_all
+     *
+     * \param[in] win			The window to lock
+     * \param[in] assert_tag	Program assertion
+     */
+    inline void WinLockAll(const Win &win, const int assert_tag) {
+        MEL_THROW(MPI_Win_lock_all(assert_tag, (MPI_Win) win), "RMA::WinLockAll");
+        MEL_TRACE_EPOCH_BEGIN(win, -1);
+    };
+
+    /**
+     * \ingroup  Win
+     * Get the lock on an RMA access epoch for a window on all attached processes
+     *
+     * \param[in] win			The window to lock
+     */
+    inline void WinLockAll(const Win &win) {
+        WinLockAll(win, 0);
+    };
+
+    /**
+     * \ingroup  Win
+     * Release the lock on an RMA access epoch for a window on all attached processes
+     *
+     * \see MPI_Win_unlock_all
+     *
+     * \param[in] win			The window to unlock
+     */
+    inline void WinUnlockAll(const Win &win) {
+        MEL_THROW(MPI_Win_unlock_all((MPI_Win) win), "RMA::WinUnlockAll");
+        MEL_TRACE_EPOCH_END(win, -1, "RMA::Epoch::LockAll");
+    };
+
+    /**
+     * \ingroup  Win
+     * Force all operations within an RMA access epoch for a window to finish
+     *
+     * \see MPI_Win_flush
+     *
+     * \param[in] win			The window to flush
+     * \param[in] rank			Rank to force synchronization with
+     */
+    inline void WinFlush(const Win &win, const int rank) {
+        MEL_THROW(MPI_Win_flush(rank, (MPI_Win) win), "RMA::WinFlush");
+    };
+    
+    /**
+     * \ingroup  Win
+     * Force all operations within an RMA access epoch for a window to finish for all attached processes
+     *
+     * \see MPI_Win_flush_all
+     *
+     * \param[in] win			The window to flush
+     */
+    inline void WinFlushAll(const Win &win) {
+        MEL_THROW(MPI_Win_flush_all((MPI_Win) win), "RMA::WinFlushAll");
+    };
+
+    /**
+     * \ingroup  Win
+     * Force all local operations within an RMA access epoch for a window to finish
+     *
+     * \see MPI_Win_flush_local
+     *
+     * \param[in] win			The window to flush
+     * \param[in] rank			Rank to force synchronization with
+     */
+    inline void WinFlushLocal(const Win &win, const int rank) {
+        MEL_THROW(MPI_Win_flush_local(rank, (MPI_Win) win), "RMA::WinFlushLocal");
+    };
+
+    /**
+     * \ingroup  Win
+     * Force all local operations within an RMA access epoch for a window to finish for all attached processes
+     *
+     * \see MPI_Win_flush_local_all
+     *
+     * \param[in] win			The window to flush
+     */
+    inline void WinFlushLocalAll(const Win &win) {
+        MEL_THROW(MPI_Win_flush_local_all((MPI_Win) win), "RMA::WinFlushLocalAll");
+    };
+
+    /**
+     * \ingroup  Win
+     * Synchronize the public and private copies of the window
+     *
+     * \see MPI_Win_sync
+     *
+     * \param[in] win			The window to synchronize
+     */
+    inline void WinSync(const Win &win) {
+        MEL_THROW(MPI_Win_sync((MPI_Win) win), "RMA::WinSync");
+    };
+
+    /**
+     * \ingroup  Win
+     * Put data into the mapped window of another process
+     *
+     * \see MPI_Rput
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     * \param[out] rq				A request object
+     */
+    inline void Rput(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win, Request &rq) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW(MPI_Rput(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Rput");
+    };
+
+    /**
+     * \ingroup  Win
+     * Put data into the mapped window of another process
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     * \return						Returns a request object
+     */
+    inline Request Rput(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
+        Request rq;
+        Rput(origin_ptr, origin_num, origin_datatype, target_disp, target_num, target_datatype, target_rank, win, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup  Win
+     * Get data from the mapped window of another process
+     *
+     * \see MPI_Rget
+     *
+     * \param[out] origin_ptr		Pointer to the array to get
+     * \param[in] origin_num		The number of elements to get into the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
+     * \param[in] target_disp		Element displacement into the window to get data from
+     * \param[in] target_num		The number of elements to get from the window
+     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
+     * \param[in] target_rank		Rank of the process to get from
+     * \param[in] win				The window to get from
+     * \param[out] rq				A request object
+     */
+    inline void Rget(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win, Request &rq) {
+        MEL_COMM_MATRIX_GET(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW(MPI_Rget(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Rget");
+    };
+    
+    /**
+     * \ingroup  Win
+     * Get data from the mapped window of another process
+     *
+     * \param[out] origin_ptr		Pointer to the array to get
+     * \param[in] origin_num		The number of elements to get into the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
+     * \param[in] target_disp		Element displacement into the window to get data from
+     * \param[in] target_num		The number of elements to get from the window
+     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
+     * \param[in] target_rank		Rank of the process to get from
+     * \param[in] win				The window to get from
+     * \return						Returns a request object
+     */
+    inline Request Rget(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
+        Request rq;
+        Rget(origin_ptr, origin_num, origin_datatype, target_disp, target_num, target_datatype, target_rank, win, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process
+     *
+     * \see MPI_Raccumulate
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     * \param[out] rq				A request object
+     */
+    inline void Raccumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win, Request &rq) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW(MPI_Raccumulate(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Op) op, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Raccumulate");
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process
+     *
+     * \param[in] origin_ptr		Pointer to the array to put
+     * \param[in] origin_num		The number of elements to put from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be put
+     * \param[in] target_disp		Element displacement into the window to put data into
+     * \param[in] target_num		The number of elements to put into the window
+     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to put into
+     * \param[in] win				The window to put into
+     * \return						Returns a request object
+     */
+    inline Request Raccumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win) {
+        Request rq;
+        Raccumulate(origin_ptr, origin_num, origin_datatype, target_disp, target_num, target_datatype, op, target_rank, win, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process, returning the contents of the target buffer before the operation was applied
+     *
+     * \see MPI_Get_accumulate
+     *
+     * \param[in] origin_ptr		Pointer to the array to accumulate
+     * \param[in] origin_num		The number of elements to accumulate from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be accumulated
+     * \param[out] result_ptr		Pointer to the array to receive the previous contents of the target
+     * \param[in] result_num		The number of elements to receive into the result array
+     * \param[in] result_datatype	The derived datatype of the elements in the result array
+     * \param[in] target_disp		Element displacement into the window to accumulate into
+     * \param[in] target_num		The number of elements to accumulate into the window
+     * \param[in] target_datatype	The derived datatype of the elements in the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to accumulate into
+     * \param[in] win				The window to accumulate into
+     */
+    inline void GetAccumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, void *result_ptr, int result_num, const Datatype &result_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW(MPI_Get_accumulate(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, result_ptr, result_num, (MPI_Datatype) result_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Op) op, (MPI_Win) win), "RMA::GetAccumulate");
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process, returning the contents of the target buffer before the operation was applied
+     *
+     * \see MPI_Rget_accumulate
+     *
+     * \param[in] origin_ptr		Pointer to the array to accumulate
+     * \param[in] origin_num		The number of elements to accumulate from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be accumulated
+     * \param[out] result_ptr		Pointer to the array to receive the previous contents of the target
+     * \param[in] result_num		The number of elements to receive into the result array
+     * \param[in] result_datatype	The derived datatype of the elements in the result array
+     * \param[in] target_disp		Element displacement into the window to accumulate into
+     * \param[in] target_num		The number of elements to accumulate into the window
+     * \param[in] target_datatype	The derived datatype of the elements in the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to accumulate into
+     * \param[in] win				The window to accumulate into
+     * \param[out] rq				A request object
+     */
+    inline void RgetAccumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, void *result_ptr, int result_num, const Datatype &result_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win, Request &rq) {
+        MEL_COMM_MATRIX_RMA(target_rank, origin_num, origin_datatype, win);
+        MEL_PROFILE_BYTES(origin_num, origin_datatype);
+        MEL_THROW(MPI_Rget_accumulate(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, result_ptr, result_num, (MPI_Datatype) result_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Op) op, (MPI_Win) win, (MPI_Request*) &rq), "RMA::RgetAccumulate");
+    };
+
+    /**
+     * \ingroup  Win
+     * Accumulate data into the mapped window of another process, returning the contents of the target buffer before the operation was applied
+     *
+     * \param[in] origin_ptr		Pointer to the array to accumulate
+     * \param[in] origin_num		The number of elements to accumulate from the local array
+     * \param[in] origin_datatype	The derived datatype of the elements to be accumulated
+     * \param[out] result_ptr		Pointer to the array to receive the previous contents of the target
+     * \param[in] result_num		The number of elements to receive into the result array
+     * \param[in] result_datatype	The derived datatype of the elements in the result array
+     * \param[in] target_disp		Element displacement into the window to accumulate into
+     * \param[in] target_num		The number of elements to accumulate into the window
+     * \param[in] target_datatype	The derived datatype of the elements in the window
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process to accumulate into
+     * \param[in] win				The window to accumulate into
+     * \return						Returns a request object
+     */
+    inline Request RgetAccumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, void *result_ptr, int result_num, const Datatype &result_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win) {
+        Request rq;
+        RgetAccumulate(origin_ptr, origin_num, origin_datatype, result_ptr, result_num, result_datatype, target_disp, target_num, target_datatype, op, target_rank, win, rq);
+        return rq;
+    };
+
+    /**
+     * \ingroup  Win
+     * Atomically apply an operation to a single element in the mapped window of another process, returning its previous value
+     *
+     * \see MPI_Fetch_and_op
+     *
+     * \param[in] origin_ptr		Pointer to the single element operand
+     * \param[out] result_ptr		Pointer to the single element to receive the previous value of the target
+     * \param[in] datatype			The predefined datatype of the element
+     * \param[in] target_disp		Element displacement into the window of the target element
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_rank		Rank of the process owning the target element
+     * \param[in] win				The window to operate on
+     */
+    inline void FetchAndOp(void *origin_ptr, void *result_ptr, const Datatype &datatype, const Aint target_disp, const Op &op, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_RMA(target_rank, 1, datatype, win);
+        MEL_THROW(MPI_Fetch_and_op(origin_ptr, result_ptr, (MPI_Datatype) datatype, target_rank, target_disp, (MPI_Op) op, (MPI_Win) win), "RMA::FetchAndOp");
+    };
+
+    /**
+     * \ingroup  Win
+     * Atomically replace a single element in the mapped window of another process if it is equal to compare, returning its previous value
+     *
+     * \see MPI_Compare_and_swap
+     *
+     * \param[in] origin_ptr		Pointer to the single element to swap in
+     * \param[in] compare_ptr		Pointer to the single element to compare against
+     * \param[out] result_ptr		Pointer to the single element to receive the previous value of the target
+     * \param[in] datatype			The predefined datatype of the element. Must be an integer, logical, or byte type
+     * \param[in] target_disp		Element displacement into the window of the target element
+     * \param[in] target_rank		Rank of the process owning the target element
+     * \param[in] win				The window to operate on
+     */
+    inline void CompareAndSwap(void *origin_ptr, void *compare_ptr, void *result_ptr, const Datatype &datatype, const Aint target_disp, const int target_rank, const Win &win) {
+        MEL_COMM_MATRIX_RMA(target_rank, 1, datatype, win);
+        MEL_THROW(MPI_Compare_and_swap(origin_ptr, compare_ptr, result_ptr, (MPI_Datatype) datatype, target_rank, target_disp, (MPI_Win) win), "RMA::CompareAndSwap");
+    };
+
+    /// \cond HIDE
+#define MEL_RMA_ATOMIC(T, D) inline T FetchAndOp_helper(const T &value, const Op &op, const Aint target_disp, const int target_rank, const Win &win) {                                            \
+        T result;                                                                                                                                                                    \
+        MEL_COMM_MATRIX_RMA(target_rank, 1, D, win);                                                                                                                                 \
+        MEL_THROW( MPI_Fetch_and_op(&value, &result, D, target_rank, target_disp, (MPI_Op) op, (MPI_Win) win), "RMA::FetchAndOp( " #T ", " #D " )" );                                \
+        MEL_THROW( MPI_Win_flush_local(target_rank, (MPI_Win) win), "RMA::WinFlushLocal" );                                                                                        \
+        return result;                                                                                                                                                                \
+    }                                                                                                                                                                                \
+    inline void GetAccumulate(const T *origin_ptr, T *result_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win) {                    \
+        MEL_COMM_MATRIX_RMA(target_rank, num, D, win);                                                                                                                                    \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                                                        \
+        MEL_THROW( MPI_Get_accumulate(origin_ptr, num, D, result_ptr, num, D, target_rank, target_disp, num, D, (MPI_Op) op, (MPI_Win) win), "RMA::GetAccumulate( " #T ", " #D " )" );    \
+    }                                                                                                                                                                                \
+    inline void RgetAccumulate(const T *origin_ptr, T *result_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win, Request &rq) {    \
+        MEL_COMM_MATRIX_RMA(target_rank, num, D, win);                                                                                                                               \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                                                   \
+        MEL_THROW( MPI_Rget_accumulate(origin_ptr, num, D, result_ptr, num, D, target_rank, target_disp, num, D, (MPI_Op) op, (MPI_Win) win, (MPI_Request*) &rq),                    \
+                   "RMA::RgetAccumulate( " #T ", " #D " )" );                                                                                                                        \
+    }                                                                                                                                                                                \
+    inline Request RgetAccumulate(const T *origin_ptr, T *result_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win) {                \
+        Request rq{};                                                                                                                                                                \
+        RgetAccumulate(origin_ptr, result_ptr, num, target_disp, op, target_rank, win, rq);                                                                                            \
+        return rq;                                                                                                                                                                    \
+    }                                                                                                                                                                                \
+    inline void Accumulate(const T *origin_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win) {                                        \
+        MEL_COMM_MATRIX_RMA(target_rank, num, D, win);                                                                                                                                 \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                                                     \
+        MEL_THROW( MPI_Accumulate(origin_ptr, num, D, target_rank, target_disp, num, D, (MPI_Op) op, (MPI_Win) win), "RMA::Accumulate( " #T ", " #D " )" );                            \
+    }                                                                                                                                                                                \
+    inline void Raccumulate(const T *origin_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win, Request &rq) {                        \
+        MEL_COMM_MATRIX_RMA(target_rank, num, D, win);                                                                                                                               \
+        MEL_PROFILE_BYTES(num, D);                                                                                                                                                   \
+        MEL_THROW( MPI_Raccumulate(origin_ptr, num, D, target_rank, target_disp, num, D, (MPI_Op) op, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Raccumulate( " #T ", " #D " )" );    \
+    }                                                                                                                                                                                \
+    inline Request Raccumulate(const T *origin_ptr, const int num, const Aint target_disp, const Op &op, const int target_rank, const Win &win) {                                    \
+        Request rq{};                                                                                                                                                                \
+        Raccumulate(origin_ptr, num, target_disp, op, target_rank, win, rq);                                                                                                        \
+        return rq;                                                                                                                                                                    \
+    }
+
+#define MEL_RMA_CAS(T, D) inline T CompareAndSwap_helper(const T &value, const T &compare, const Aint target_disp, const int target_rank, const Win &win) {                                    \
+        T result;                                                                                                                                                                    \
+        MEL_COMM_MATRIX_RMA(target_rank, 1, D, win);                                                                                                                                  \
+        MEL_THROW( MPI_Compare_and_swap(&value, &compare, &result, D, target_rank, target_disp, (MPI_Win) win), "RMA::CompareAndSwap( " #T ", " #D " )" );                            \
+        MEL_THROW( MPI_Win_flush_local(target_rank, (MPI_Win) win), "RMA::WinFlushLocal" );                                                                                        \
+        return result;                                                                                                                                                                \
+    }
+
+    MEL_RMA_ATOMIC(float,                        MPI_FLOAT);
+    MEL_RMA_ATOMIC(double,                        MPI_DOUBLE);
+    MEL_RMA_ATOMIC(long double,                    MPI_LONG_DOUBLE);
+
+    MEL_RMA_ATOMIC(int8_t,                        MPI_INT8_T);
+    MEL_RMA_ATOMIC(int16_t,                        MPI_INT16_T);
+    MEL_RMA_ATOMIC(int32_t,                        MPI_INT32_T);
+    MEL_RMA_ATOMIC(int64_t,                        MPI_INT64_T);
+
+    MEL_RMA_ATOMIC(uint8_t,                        MPI_UINT8_T);
+    MEL_RMA_ATOMIC(uint16_t,                    MPI_UINT16_T);
+    MEL_RMA_ATOMIC(uint32_t,                    MPI_UINT32_T);
+    MEL_RMA_ATOMIC(uint64_t,                    MPI_UINT64_T);
+
+    MEL_RMA_ATOMIC(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
+    MEL_RMA_ATOMIC(std::complex<double>,        MPI_CXX_DOUBLE_COMPLEX);
+    MEL_RMA_ATOMIC(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
+    MEL_RMA_ATOMIC(bool,                        MPI_CXX_BOOL);
+
+    // MPI_Compare_and_swap is only defined for integer, logical and byte types
+    MEL_RMA_CAS(int8_t,                            MPI_INT8_T);
+    MEL_RMA_CAS(int16_t,                        MPI_INT16_T);
+    MEL_RMA_CAS(int32_t,                        MPI_INT32_T);
+    MEL_RMA_CAS(int64_t,                        MPI_INT64_T);
+
+    MEL_RMA_CAS(uint8_t,                        MPI_UINT8_T);
+    MEL_RMA_CAS(uint16_t,                        MPI_UINT16_T);
+    MEL_RMA_CAS(uint32_t,                        MPI_UINT32_T);
+    MEL_RMA_CAS(uint64_t,                        MPI_UINT64_T);
+
+    MEL_RMA_CAS(bool,                            MPI_CXX_BOOL);
+
+#undef MEL_RMA_ATOMIC
+#undef MEL_RMA_CAS
+    /// \endcond
+
+    /**
+     * \ingroup  Win
+     * Atomically apply an operation to a single element in the mapped window of another process, returning its previous value.
+     * The operation is completed locally with MPI_Win_flush_local before returning, so this must be called inside a passive 
+     * target epoch (WinLock / WinLockAll). Defined for the predefined integer, floating point, complex and logical types
+     *
+     * \see MPI_Fetch_and_op
+     *
+     * \param[in] value			The operand
+     * \param[in] op				The MPI operation to use
+     * \param[in] target_disp		Element displacement into the window of the target element
+     * \param[in] target_rank		Rank of the process owning the target element
+     * \param[in] win				The window to operate on
+     * \return					Returns the previous value of the target element
+     */
+    template<typename T>
+    inline T FetchAndOp(const T &value, const Op &op, const Aint target_disp, const int target_rank, const Win &win) {
+        return FetchAndOp_helper(value, op, target_disp, target_rank, win);
+    };
+
+    /**
+     * \ingroup  Win
+     * Atomically replace a single element in the mapped window of another process if it is equal to compare, returning its 
+     * previous value. The operation is completed locally with MPI_Win_flush_local before returning, so this must be called 
+     * inside a passive target epoch (WinLock / WinLockAll). Defined for the predefined integer and logical types
+     *
+     * \see MPI_Compare_and_swap
+     *
+     * \param[in] value			The element to swap in
+     * \param[in] compare			The element to compare against
+     * \param[in] target_disp		Element displacement into the window of the target element
+     * \param[in] target_rank		Rank of the process owning the target element
+     * \param[in] win				The window to operate on
+     * \return					Returns the previous value of the target element
+     */
+    template<typename T>
+    inline T CompareAndSwap(const T &value, const T &compare, const Aint target_disp, const int target_rank, const Win &win) {
+        return CompareAndSwap_helper(value, compare, target_disp, target_rank, win);
+    };
+    
+#endif
+    
+    /**
+     * \ingroup  Win
+     * Free an RMA window
+     *
+     * \see MPI_Win_free
+     *
+     * \param[in] win			The window to free
+     */
+    inline void WinFree(Win &win) {
+        if (win != MEL::Win::WIN_NULL) {
+            MEL_COMM_MATRIX_FORGET_WIN(win);
+            MEL_THROW( MPI_Win_free((MPI_Win*) &win), "RMA::FreeWin" );                                                                
+        }
+    };    
+
+    /**
+     * \ingroup  Win
+     * Free a std::vector of RMA window handles
+     *
+     * \param[in] wins			A std::vector of windows to free
+     */
+    inline void WinFree(std::vector<Win> &wins) {
+        for (auto &w : wins) WinFree(w);
+    };
+
+    /**
+     * \ingroup  Win
+     * Free a varadic set of RMA windows
+     *
+     * \param[in] d0			The first window to free
+     * \param[in] d1			The second window to free
+     * \param[in] args			The remaining windows to free
+     */
+    template<typename T0, typename T1, typename ...Args>
+    inline void WinFree(T0 &d0, T1 &d1, Args &&...args) {
+        WinFree(d0);
+        WinFree(d1, args...);
+    };
+
+    /// \cond HIDE
+    struct Mutex {
+        /// Members
+        unsigned char *val; 
+        bool locked;
+        int rank, size, root;
+        Comm        comm;
+        Win            win;
+    
+        Mutex() : val(nullptr), locked(false), rank(0), size(0), root(0),
+                      comm(MEL::Comm::COMM_NULL), win(MEL::Win::WIN_NULL) {};
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Mutex
+     * Create a MEL::Mutex across a comm world
      *
-     * \see MPI_Iallreduce
+     * \param[in] rank		The rank of the calling process
+     * \param[in] size		The size of the comm world
+     * \param[in] root		The rank of the process who will own the mutex
+     * \param[in] comm		The comm world to share the mutex across
+     */
+    inline Mutex MutexCreate(const int rank, const int size, const int root, const Comm &comm) {
+        MEL::Barrier(comm);
+        Mutex mutex;
+        mutex.locked = false;
+        mutex.rank = rank;
+        mutex.size = size;
+        mutex.root = root;
+        mutex.comm = comm;
+
+        if (rank == root) {
+            /// Allocate and expose
+            mutex.val = MEL::MemAlloc<unsigned char>(size);
+            memset(mutex.val, 0, size);
+            mutex.win = MEL::WinCreate(mutex.val, size, comm);
+        }
+        else {
+            /// Indecent exposure
+            mutex.val = nullptr;
+            mutex.win = MEL::WinCreate(mutex.val, 0, comm);
+        }
+
+        return mutex;
+    };
+
+    /**
+     * \ingroup Mutex
+     * Create a MEL::Mutex across a comm world
+     *
+     * \param[in] root		The rank of the process who will own the mutex
+     * \param[in] comm		The comm world to share the mutex across
+     */
+    inline Mutex MutexCreate(const int root, const Comm &comm) {
+        return MutexCreate(CommRank(comm), CommSize(comm), root, comm);
+    };
+
+    /**
+     * \ingroup Mutex
+     * Free a MEL::Mutex
+     *
+     * \param[in] mutex		The mutex to free
+     */
+    inline void MutexFree(Mutex &mutex) {
+        MEL::Barrier(mutex.comm);
+        MEL::WinFree(mutex.win);
+        MEL::MemFree(mutex.val);
+    };
+
+    /**
+     * \ingroup Mutex
+     * Get the exclusive lock on a MEL::Mutex
+     *
+     * \param[in] mutex		The mutex to lock
+     */
+    inline void MutexLock(Mutex &mutex) {
+        if (mutex.locked) return;
+        MEL_PROFILE_SCOPE("Mutex::Lock", -1);
+
+        unsigned char *waitlist = MEL::MemAlloc<unsigned char>(mutex.size);
+
+        /// Declare our intent to lock and sync waitlist
+        unsigned char lock = 1;
+        MEL::WinLockExclusive(mutex.win, mutex.root);
+        MEL::Put(&lock,       1,           MEL::Datatype::UNSIGNED_CHAR, mutex.rank, 1,             MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
+        MEL::Get(waitlist, mutex.size, MEL::Datatype::UNSIGNED_CHAR, 0,             mutex.size, MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
+        MEL::WinUnlock(mutex.win, mutex.root);
+
+        /// Is there a conflict?
+        for (int i = 0; i < mutex.size; i++) {
+            if (i != mutex.rank && waitlist[i] != 0) {
+                /// If at least one conflict exists wait for a message to say everything is groovy
+                MEL::Recv(&lock, 0, MEL::Datatype::UNSIGNED_CHAR, MEL::ANY_SOURCE, 99, mutex.comm);
+                break;
+            }
+        }
+
+        /// Clean up for if we got the lock without conflict
+        MEL::MemFree(waitlist);
+
+        /// We have the lock
+        mutex.locked = true;
+        MEL_TRACE_EPOCH_BEGIN(mutex.win, -3);
+    };
+
+    /**
+     * \ingroup Mutex
+     * Test if the mutex is currently locked
+     *
+     * \param[in] mutex		The mutex to lock
+     */
+    inline bool MutexTest(const Mutex &mutex) {
+        return mutex.locked;
+    };
+
+    /**
+     * \ingroup Mutex
+     * Release the exclusive lock on a MEL::Mutex
+     *
+     * \param[in] mutex		The mutex to lock
+     */
+    inline void MutexUnlock(Mutex &mutex) {
+        if (!mutex.locked) return;
+        MEL_TRACE_EPOCH_END(mutex.win, -3, "Mutex::Held");
+
+        unsigned char *waitlist = MEL::MemAlloc<unsigned char>(mutex.size);
+        mutex.locked = 0;
+
+        /// Declare we are done and sync waitlist
+        unsigned char lock = 0;
+        MEL::WinLockExclusive(mutex.win, mutex.root);
+        MEL::Put(&lock,       1,           MEL::Datatype::UNSIGNED_CHAR, mutex.rank, 1,             MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
+        MEL::Get(waitlist, mutex.size, MEL::Datatype::UNSIGNED_CHAR, 0,             mutex.size, MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
+        MEL::WinUnlock(mutex.win, mutex.root);
+
+        /// Starting at a random process, scan for a intent to lock 
+        const int r = rand() % mutex.size;
+        for (int k = 0; k < mutex.size; k++) {
+            const int i = (mutex.rank + k + r) % mutex.size;
+            if (i != mutex.rank && waitlist[i] == 1) {
+                /// If a process is waiting for the lock, send them a message
+                MEL::Send(&lock, 0, MEL::Datatype::UNSIGNED_CHAR, i, 99, mutex.comm);
+                break;
+            }
+        }
+
+        /// Clean up for if no one else wanted the lock
+        MEL::MemFree(waitlist);
+    };
+
+    /// \cond HIDE
+    template<typename T>
+    struct Shared {
+        /// Members
+        Mutex mutex;
+        Win win;
+        Datatype typeData;
+        T *ptr;
+        int len;
+
+        Shared() : ptr(nullptr), len(0), mutex(), win(MEL::Win::WIN_NULL), typeData(MEL::Datatype::DATATYPE_NULL) {};
+        
+        inline bool is_locked() const {
+            return MEL::MutexTest(mutex);
+        };
+
+        inline T& operator[](const int i) {
+            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator[] We do not have the lock!");
+            return ptr[i];
+        };
+
+        inline T* operator->() {
+            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator-> We do not have the lock!");
+            return ptr;
+        };
+
+        inline operator T*() {
+            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator (T*) We do not have the lock!");
+            return ptr;
+        };
+
+        inline T& operator*() {
+            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator* We do not have the lock!");
+            return *ptr;
+        };
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Shared
+     * Create a MEL::Shared array across a comm world
+     *
+     * \param[in] len		The number of elements to allocate
+     * \param[in] rank		The rank of the calling process
+     * \param[in] size		The size of the comm world
+     * \param[in] root		The rank of the process who will own the shared array
+     * \param[in] comm		The comm world to share the array across
+     */
+    template<typename T>
+    inline Shared<T> SharedCreate(const int len, const int rank, const int size, const int root, const Comm &comm) {
+        MEL::Barrier(comm);
+        Shared<T> shared;
+        shared.len = len;
+        shared.mutex = MEL::MutexCreate(rank, size, root, comm);
+
+        shared.ptr = MEL::MemAlloc<T>(len);
+        memset(shared.ptr, 0, sizeof(T) * len);
+
+        if (rank == root) {
+            shared.win = MEL::WinCreate(shared.ptr, len, comm);
+        }
+        else {
+            shared.win = MEL::WinCreate(shared.ptr, 0, comm);
+        }
+
+        shared.typeData = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, sizeof(T));
+        return shared;
+    };
+
+    /**
+     * \ingroup Shared
+     * Create a MEL::Shared array across a comm world
+     *
+     * \param[in] len		The number of elements to allocate
+     * \param[in] root		The rank of the process who will own the shared array
+     * \param[in] comm		The comm world to share the array across
+     */
+    template<typename T>
+    inline Shared<T> SharedCreate(const int len, const int root, const Comm &comm) {
+        return SharedCreate<T>(len, CommRank(comm), CommSize(comm), root, comm);
+    };
+
+    /**
+     * \ingroup Shared
+     * Free a MEL::Shared array
+     *
+     * \param[in] shared	The shared array to free
+     */
+    template<typename T>
+    inline void SharedFree(Shared<T> &shared) {
+        MEL::Barrier(shared.mutex.comm);
+        MEL::WinFree(shared.win);
+        MEL::MemFree(shared.ptr);
+        MEL::MutexFree(shared.mutex);
+        MEL::TypeFree(shared.typeData);
+    };
+
+    /**
+     * \ingroup Shared
+     * Test if the shared array is currently locked
+     *
+     * \param[in] shared	The shared array to test
+     */
+    template<typename T>
+    inline bool SharedTest(const Shared<T> &shared) {
+        return shared.is_locked();
+    };
+
+    /**
+     * \ingroup Shared
+     * Get the lock on the shared array without synchronizing the data. Useful for if you only intend to write to the array
      *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] comm				The comm world to reduce within
-     * \param[out] rq				A request object
+     * \param[in] shared	The shared array to lock
      */
-    inline void Iallreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm, Request &rq) {
-        MEL_THROW( MPI_Iallreduce(sptr, rptr, num, (MPI_Datatype) datatype, (MPI_Op) op, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallreduce" );                            
-    }; 
+    template<typename T>
+    inline void SharedLock_noget(Shared<T> &shared) {
+        SharedLock_noget(shared, 0, shared.len - 1);
+    };
     
     /**
-     * \ingroup COL
-     * Non-Blocking. Reduce an array of known length across all processes in comm using the given operation, and distribute the result to all processes
+     * \ingroup Shared
+     * Get the lock on the shared array without synchronizing the data. Useful for if you only intend to write to the array
      *
-     * \param[in] sptr				Pointer to num elements to send
-     * \param[out] rptr				Pointer to the receive buffer
-     * \param[in] num				The number of elements in the array
-     * \param[in] datatype			The derived datatype of the elements to reduce
-     * \param[in] op				The operation to perform for the reduction
-     * \param[in] comm				The comm world to reduce within
-     * \return						Returns a request object
-     */                                                                                                                                                       
-    inline Request Iallreduce(void *sptr, void *rptr, const int num, const Datatype &datatype, const Op &op, const Comm &comm) {
-        Request rq{};                                                                                                                                        
-        Iallreduce(sptr, rptr, num, datatype, op, comm, rq);                                                                                                    
-        return rq;                                                                                                                                            
+     * \param[in] shared	The shared array to lock
+     * \param[in] start		The start index to lock
+     * \param[in] end		The end index to lock
+     */
+    template<typename T>
+    inline void SharedLock_noget(Shared<T> &shared, const int start, const int end) {
+        MEL::MutexLock(shared.mutex); // , start, end
     };
-#endif
 
-    /// \cond HIDE
-#define MEL_COLLECTIVE(T, D) inline void Bcast(T *ptr, const int num, const int root, const Comm &comm) {                                                    \
-        MEL_THROW( MPI_Bcast(ptr, num, D, root, (MPI_Comm) comm), "Comm::Bcast( " #T ", " #D " )" );                                                        \
-    }                                                                                                                                                        \
-    /* Scatter / Scatterv */                                                                                                                                \
-    inline void Scatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                                \
-        MEL_THROW( MPI_Scatter(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Scatter( " #T ", " #D " )" );                                    \
-    }                                                                                                                                                        \
-    inline void Scatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm) {                            \
-        MEL_THROW( MPI_Scatterv(sptr, snum, displs, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Scatterv( " #T ", " #D " )" );                            \
-    }                                                                                                                                                        \
-    /* Gather / Gatherv */                                                                                                                                    \
-    inline void Gather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                                \
-        MEL_THROW( MPI_Gather(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm), "Comm::Gather( " #T ", " #D " )" );                                        \
-    }                                                                                                                                                        \
-    inline void Gatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm) {                            \
-        MEL_THROW( MPI_Gatherv(sptr, snum, D, rptr, rnum, displs, D, root, (MPI_Comm) comm), "Comm::Gatherv( " #T ", " #D " )" );                            \
-    }                                                                                                                                                        \
-    /* Allgather / Allgatherv */                                                                                                                            \
-    inline void Allgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                                \
-        MEL_THROW( MPI_Allgather(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm), "Comm::Allgather( " #T ", " #D " )" );                                        \
-    }                                                                                                                                                        \
-    inline void Allgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm) {                                            \
-        MEL_THROW( MPI_Allgatherv(sptr, snum, D, rptr, rnum, displ, D, (MPI_Comm) comm), "Comm::Allgatherv( " #T ", " #D " )" );                            \
-    }                                                                                                                                                        \
-    /* Alltoall / Alltoallv */                                                                                                                                \
-    inline void Alltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                                \
-        MEL_THROW( MPI_Alltoall(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm), "Comm::Alltoall( " #T ", " #D " )" );                                        \
-    }                                                                                                                                                        \
-    inline void Alltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm) {                        \
-        MEL_THROW( MPI_Alltoallv(sptr, snum, sdispl, D, rptr, rnum, rdispl, D, (MPI_Comm) comm), "Comm::Alltoallv( " #T ", " #D " )" );                        \
-    }                                                                                                                                                        \
-    /* Reduce / Allreduce */                                                                                                                                \
-    inline void Reduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm) {                                                    \
-        MEL_THROW( MPI_Reduce(sptr, rptr, num, D, (MPI_Op) op, root, (MPI_Comm) comm), "Comm::Reduce( " #T ", " #D " )" );                                    \
-    }                                                                                                                                                        \
-    inline void Allreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                                \
-        MEL_THROW( MPI_Allreduce(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm), "Comm::Allreduce( " #T ", " #D " )" );                                    \
-    }                                                                                                                                                        
+    /**
+     * \ingroup Shared
+     * Get the lock on the shared array and synchronize the data
+     *
+     * \param[in] shared	The shared array to lock
+     */
+    template<typename T>
+    inline void SharedLock(Shared<T> &shared) {
+        SharedLock(shared, 0, shared.len - 1);
+    };
 
-#define MEL_3_COLLECTIVE(T, D) inline void Ibcast(T *ptr, const int num, const int root, const Comm &comm, Request &rq) {                                    \
-        MEL_THROW( MPI_Ibcast(ptr, num, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ibcast( " #T ", " #D " )" );                                    \
-    }                                                                                                                                                        \
-    inline Request Ibcast(T *ptr, const int num, const int root, const Comm &comm) {                                                                        \
-        Request rq{};                                                                                                                                        \
-        Ibcast(ptr, num, root, comm, rq);                                                                                                                    \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    /* Scatter / Scatterv */                                                                                                                                \
-    inline void Iscatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {                                    \
-        MEL_THROW( MPI_Iscatter(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatter( " #T ", " #D " )" );                \
-    }                                                                                                                                                        \
-    inline Request Iscatter(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                            \
-        Request rq{};                                                                                                                                        \
-        Iscatter(sptr, snum, rptr, rnum, root, comm, rq);                                                                                                    \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    inline void Iscatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {            \
-        MEL_THROW( MPI_Iscatterv(sptr, snum, displs, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iscatterv( " #T ", " #D " )" );    \
-    }                                                                                                                                                        \
-    inline Request Iscatterv(T *sptr, const int *snum, const int *displs, T *rptr, const int rnum, const int root, const Comm &comm) {                        \
-        Request rq{};                                                                                                                                        \
-        Iscatterv(sptr, snum, displs, rptr, rnum, root, comm, rq);                                                                                            \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    /* Gather / Gatherv */                                                                                                                                    \
-    inline void Igather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm, Request &rq) {                                    \
-        MEL_THROW( MPI_Igather(sptr, snum, D, rptr, rnum, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igather( " #T ", " #D " )" );                \
-    }                                                                                                                                                        \
-    inline Request Igather(T *sptr, const int snum, T *rptr, const int rnum, const int root, const Comm &comm) {                                            \
-        Request rq{};                                                                                                                                        \
-        Igather(sptr, snum, rptr, rnum, root, comm, rq);                                                                                                    \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    inline void Igatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm, Request &rq) {                \
-        MEL_THROW( MPI_Igatherv(sptr, snum, D, rptr, rnum, displs, D, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Igatherv( " #T ", " #D " )" );        \
-    }                                                                                                                                                        \
-    inline Request Igatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displs, const int root, const Comm &comm) {                        \
-        Request rq{};                                                                                                                                        \
-        Igatherv(sptr, snum, rptr, rnum, displs, root, comm, rq);                                                                                            \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    /* Allgather / Allgatherv */                                                                                                                            \
-    inline void Iallgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm, Request &rq) {                                                \
-        MEL_THROW( MPI_Iallgather(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgather( " #T ", " #D " )" );                \
-    }                                                                                                                                                        \
-    inline Request Iallgather(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                            \
-        Request rq{};                                                                                                                                        \
-        Iallgather(sptr, snum, rptr, rnum, comm, rq);                                                                                                        \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    inline void Iallgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm, Request &rq) {                            \
-        MEL_THROW( MPI_Iallgatherv(sptr, snum, D, rptr, rnum, displ, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallgatherv( " #T ", " #D " )" );        \
-    }                                                                                                                                                        \
-    inline Request Iallgatherv(T *sptr, const int snum, T *rptr, const int *rnum, const int *displ, const Comm &comm) {                                        \
-        Request rq{};                                                                                                                                        \
-        Iallgatherv(sptr, snum, rptr, rnum, displ, comm, rq);                                                                                                \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    /* Alltoall / Alltoallv */                                                                                                                                \
-    inline void Ialltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm, Request &rq) {                                                \
-        MEL_THROW( MPI_Ialltoall(sptr, snum, D, rptr, rnum, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoall( " #T ", " #D " )" );                    \
-    }                                                                                                                                                        \
-    inline Request Ialltoall(T *sptr, const int snum, T *rptr, const int rnum, const Comm &comm) {                                                            \
-        Request rq{};                                                                                                                                        \
-        Ialltoall(sptr, snum, rptr, rnum, comm, rq);                                                                                                        \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    inline void Ialltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm, Request &rq) {        \
-        MEL_THROW( MPI_Ialltoallv(sptr, snum, sdispl, D, rptr, rnum, rdispl, D, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ialltoallv( " #T ", " #D " )" );    \
-    }                                                                                                                                                        \
-    inline Request Ialltoallv(T *sptr, const int *snum, const int *sdispl, T *rptr, const int *rnum, const int *rdispl, const Comm &comm) {                    \
-        Request rq{};                                                                                                                                        \
-        Ialltoallv(sptr, snum, sdispl, rptr, rnum, rdispl, comm, rq);                                                                                        \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    /* Reduce / Allreduce */                                                                                                                                \
-    inline void Ireduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm, Request &rq) {                                        \
-        MEL_THROW( MPI_Ireduce(sptr, rptr, num, D, (MPI_Op) op, root, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Ireduce( " #T ", " #D " )" );            \
-    }                                                                                                                                                        \
-    inline Request Ireduce(T *sptr, T *rptr, const int num, const Op &op, const int root, const Comm &comm) {                                                \
-        Request rq{};                                                                                                                                        \
-        Ireduce(sptr, rptr, num, op, root, comm, rq);                                                                                                        \
-        return rq;                                                                                                                                            \
-    }                                                                                                                                                        \
-    inline void Iallreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm, Request &rq) {                                                    \
-        MEL_THROW( MPI_Iallreduce(sptr, rptr, num, D, (MPI_Op) op, (MPI_Comm) comm, (MPI_Request*) &rq), "Comm::Iallreduce( " #T ", " #D " )" );            \
-    }                                                                                                                                                        \
-    inline Request Iallreduce(T *sptr, T *rptr, const int num, const Op &op, const Comm &comm) {                                                            \
-        Request rq{};                                                                                                                                        \
-        Iallreduce(sptr, rptr, num, op, comm, rq);                                                                                                            \
-        return rq;                                                                                                                                            \
-    }
+    /**
+     * \ingroup Shared
+     * Get the lock on the shared array and synchronize the data
+     *
+     * \param[in] shared	The shared array to lock
+     * \param[in] start		The start index to lock
+     * \param[in] end		The end index to lock
+     */
+    template<typename T>
+    inline void SharedLock(Shared<T> &shared, const int start, const int end) {
+        SharedLock_noget(shared, start, end);
 
-    MEL_COLLECTIVE(char,                        MPI_CHAR);
-    MEL_COLLECTIVE(wchar_t,                        MPI_WCHAR);
+        if (shared.mutex.rank != shared.mutex.root) {
+            const int num = (end - start) + 1;
+            MEL::WinLockExclusive(shared.win, shared.mutex.root);
+            MEL::Get(shared.ptr + (start), num, shared.typeData, start, num, shared.typeData, shared.mutex.root, shared.win);
+            MEL::WinUnlock(shared.win, shared.mutex.root);
+        }
+    };
 
-    MEL_COLLECTIVE(float,                        MPI_FLOAT);
-    MEL_COLLECTIVE(double,                        MPI_DOUBLE);
-    MEL_COLLECTIVE(long double,                    MPI_LONG_DOUBLE);
+    /**
+     * \ingroup Shared
+     * Release the lock on the shared array without synchronizing the data. Useful for if you only read from the array
+     * 
+     * \param[in] shared	The shared array to unlock
+     */
+    template<typename T>
+    inline void SharedUnlock_noput(Shared<T> &shared) {
+        SharedUnlock_noput(shared, 0, shared.len - 1);
+    };
+    
+    /**
+     * \ingroup Shared
+     * Release the lock on the shared array without synchronizing the data. Useful for if you only read from the array
+     * 
+     * \param[in] shared	The shared array to unlock
+     * \param[in] start		The start index to unlock
+     * \param[in] end		The end index to unlock
+     */
+    template<typename T>
+    inline void SharedUnlock_noput(Shared<T> &shared, const int start, const int end) {
+        MEL::MutexUnlock(shared.mutex); // , start, end
+    };
 
-    MEL_COLLECTIVE(int8_t,                        MPI_INT8_T);
-    MEL_COLLECTIVE(int16_t,                        MPI_INT16_T);
-    MEL_COLLECTIVE(int32_t,                        MPI_INT32_T);
-    MEL_COLLECTIVE(int64_t,                        MPI_INT64_T);
+    /**
+     * \ingroup Shared
+     * Release the lock on the shared array and synchronize the data
+     * 
+     * \param[in] shared	The shared array to unlock
+     */
+    template<typename T>
+    inline void SharedUnlock(Shared<T> &shared) {
+        SharedUnlock(shared, 0, shared.len - 1);
+    };
+
+    /**
+     * \ingroup Shared
+     * Release the lock on the shared array and synchronize the data
+     * 
+     * \param[in] shared	The shared array to unlock
+     * \param[in] start		The start index to unlock
+     * \param[in] end		The end index to unlock
+     */
+    template<typename T>
+    inline void SharedUnlock(Shared<T> &shared, const int start, const int end) {
+        if (shared.mutex.rank != shared.mutex.root) {
+            const int num = (end - start) + 1;
+            MEL::WinLockExclusive(shared.win, shared.mutex.root);
+            MEL::Put(shared.ptr + (start), num, shared.typeData, start, num, shared.typeData, shared.mutex.root, shared.win);
+            MEL::WinUnlock(shared.win, shared.mutex.root);
+        }
 
-    MEL_COLLECTIVE(uint8_t,                        MPI_UINT8_T);
-    MEL_COLLECTIVE(uint16_t,                    MPI_UINT16_T);
-    MEL_COLLECTIVE(uint32_t,                    MPI_UINT32_T);
-    MEL_COLLECTIVE(uint64_t,                    MPI_UINT64_T);
+        SharedUnlock_noput(shared, start, end);
+    };
 
 #ifdef MEL_3
-    MEL_COLLECTIVE(std::complex<float>,            MPI_CXX_FLOAT_COMPLEX);
-    MEL_COLLECTIVE(std::complex<double>,        MPI_CXX_DOUBLE_COMPLEX);
-    MEL_COLLECTIVE(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
-    MEL_COLLECTIVE(bool,                        MPI_CXX_BOOL);
 
-    MEL_3_COLLECTIVE(char,                        MPI_CHAR);
-    MEL_3_COLLECTIVE(wchar_t,                    MPI_WCHAR);
+    /// \cond HIDE
+    template<typename T>
+    struct SharedVector {
+        /// Members
+        Win win, hdrWin;
+        Datatype typeData;
+        Aint *hdr;
+        T *ptr;
+        int len, cap, rank;
+        Comm comm;
 
-    MEL_3_COLLECTIVE(float, MPI_FLOAT);
-    MEL_3_COLLECTIVE(double,                    MPI_DOUBLE);
-    MEL_3_COLLECTIVE(long double,                MPI_LONG_DOUBLE);
+        SharedVector() : win(MEL::Win::WIN_NULL), hdrWin(MEL::Win::WIN_NULL), typeData(MEL::Datatype::DATATYPE_NULL), 
+                         hdr(nullptr), ptr(nullptr), len(0), cap(0), rank(0), comm(MEL::Comm::COMM_NULL) {};
 
-    MEL_3_COLLECTIVE(int8_t,                    MPI_INT8_T);
-    MEL_3_COLLECTIVE(int16_t,                    MPI_INT16_T);
-    MEL_3_COLLECTIVE(int32_t,                    MPI_INT32_T);
-    MEL_3_COLLECTIVE(int64_t,                    MPI_INT64_T);
+        inline int size() const {
+            return len;
+        };
 
-    MEL_3_COLLECTIVE(uint8_t,                    MPI_UINT8_T);
-    MEL_3_COLLECTIVE(uint16_t,                    MPI_UINT16_T);
-    MEL_3_COLLECTIVE(uint32_t,                    MPI_UINT32_T);
-    MEL_3_COLLECTIVE(uint64_t,                    MPI_UINT64_T);
+        inline T& operator[](const int i) {
+            return ptr[i];
+        };
 
-    MEL_3_COLLECTIVE(std::complex<float>,        MPI_CXX_FLOAT_COMPLEX);
-    MEL_3_COLLECTIVE(std::complex<double>,        MPI_CXX_DOUBLE_COMPLEX);
-    MEL_3_COLLECTIVE(std::complex<long double>,    MPI_CXX_LONG_DOUBLE_COMPLEX);
-    MEL_3_COLLECTIVE(bool,                        MPI_CXX_BOOL);
-#endif
+        inline const T& operator[](const int i) const {
+            return ptr[i];
+        };
+    };
 
-#undef MEL_COLLECTIVE
-#undef MEL_3_COLLECTIVE
+    /// Publish the address and length of the local segment to the other processes
+    template<typename T>
+    inline void SharedVector_publish(SharedVector<T> &shared) {
+        MEL::WinLockExclusive(shared.hdrWin, shared.rank);
+        shared.hdr[0] = MEL::GetAddress(shared.ptr);
+        shared.hdr[1] = shared.len;
+        MEL::WinUnlock(shared.hdrWin, shared.rank);
+    };
+
+    /// Read the address and length of a remote segment. The caller must hold a lock on hdrWin at rank
+    template<typename T>
+    inline void SharedVector_header(SharedVector<T> &shared, const int rank, Aint *hdr) {
+        MEL::Get(hdr, 2, MEL::Datatype::AINT, 0, 2, MEL::Datatype::AINT, rank, shared.hdrWin);
+        MEL::WinFlush(shared.hdrWin, rank);
+    };
     /// \endcond
 
     /**
-     * \ingroup COL
-     * Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     * \ingroup Shared
+     * Create a MEL::SharedVector across a comm world. Each process owns a local segment which it can grow 
+     * without any collective communication, and which other processes can read and write through RMA
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
+     * \param[in] capacity	The number of elements to reserve in the local segment
+     * \param[in] comm		The comm world to share the vector across
+     * \return				Returns the shared vector
      */
     template<typename T>
-    inline void Bcast(T *ptr, const int num, const int root, const Comm &comm) {
-        Bcast(ptr, num * sizeof(T), MEL::Datatype::CHAR, root, comm);
-    };
+    inline SharedVector<T> SharedVectorCreate(const int capacity, const Comm &comm) {
+        SharedVector<T> shared;
+        shared.comm = comm;
+        shared.rank = MEL::CommRank(comm);
+        shared.len  = 0;
+        shared.cap  = (capacity > 0) ? capacity : 1;
+
+        shared.ptr = MEL::MemAlloc<T>(shared.cap);
+        shared.win = MEL::WinCreateDynamic(comm);
+        MEL::WinAttach(shared.win, shared.ptr, shared.cap);
+
+        shared.hdr = MEL::MemAlloc<Aint>(2);
+        shared.hdr[0] = MEL::GetAddress(shared.ptr);
+        shared.hdr[1] = 0;
+        shared.hdrWin = MEL::WinCreate(shared.hdr, 2, comm);
 
-#ifdef MEL_3
+        shared.typeData = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, sizeof(T));
+        MEL::Barrier(comm);
+        return shared;
+    };
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     * \ingroup Shared
+     * Create a MEL::SharedVector across a comm world
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
-     * \param[out] rq				A request object
+     * \param[in] comm		The comm world to share the vector across
+     * \return				Returns the shared vector
      */
     template<typename T>
-    inline void Ibcast(T *ptr, const int num, const int root, const Comm &comm, Request &rq) {
-        Ibcast(ptr, num * sizeof(T), MEL::Datatype::CHAR, root, comm, rq);
-    }; 
+    inline SharedVector<T> SharedVectorCreate(const Comm &comm) {
+        return SharedVectorCreate<T>(1, comm);
+    };
 
     /**
-     * \ingroup COL
-     * Non-Blocking. Broadcast an array to all processes in comm, where all processes know how many elements to expect
+     * \ingroup Shared
+     * Free a MEL::SharedVector. Collective across the comm world the vector was created in
      *
-     * \param[in,out] ptr			Pointer to the memory receive into
-     * \param[in] num				The number of elements to broadcast
-     * \param[in] root				The rank of the process to send from
-     * \param[in] comm				The comm world to broadcast within
-     * \return						Returns a request object
+     * \param[in] shared	The shared vector to free
      */
     template<typename T>
-    inline Request Ibcast(T *ptr, const int num, const int root, const Comm &comm) {
-        return Ibcast(ptr, num * sizeof(T), MEL::Datatype::CHAR, root, comm);
-    };
-
-#endif
-
-    enum class LockType {
-        EXCLUSIVE = MPI_LOCK_EXCLUSIVE,
-        SHARED = MPI_LOCK_SHARED
+    inline void SharedVectorFree(SharedVector<T> &shared) {
+        MEL::Barrier(shared.comm);
+        MEL::WinDetach(shared.win, shared.ptr);
+        MEL::WinFree(shared.win, shared.hdrWin);
+        MEL::MemFree(shared.ptr, shared.hdr);
+        MEL::TypeFree(shared.typeData);
+        shared.len = shared.cap = 0;
     };
 
-    struct Win {
-        static const Win WIN_NULL;
-
-        MPI_Win win;
+    /**
+     * \ingroup Shared
+     * Grow the capacity of the local segment of a MEL::SharedVector. Only the calling process takes part. 
+     * Remote accesses in progress complete before the segment is copied, and later ones use the new segment
+     *
+     * \param[in] shared	The shared vector to grow
+     * \param[in] capacity	The number of elements to reserve
+     */
+    template<typename T>
+    inline void SharedVectorReserve(SharedVector<T> &shared, const int capacity) {
+        if (capacity <= shared.cap) return;
 
-        Win() : win(MPI_WIN_NULL) {};
-        explicit Win(const MPI_Win &_w) : win(_w) {};
-        inline Win& operator=(const MPI_Win &_w) {
-            win = _w;
-            return *this;
-        };
-        explicit operator MPI_Win() const {
-            return win;
-        };
+        /// Remote accesses hold a shared lock on the header while using the segment, so holding it exclusively
+        /// waits for those in progress and keeps new ones out until the copy is published
+        MEL::WinLockExclusive(shared.hdrWin, shared.rank);
+        T *old = shared.ptr;
+        shared.ptr = MEL::MemAlloc<T>(capacity);
+        std::memcpy(shared.ptr, old, sizeof(T) * shared.len);
+        MEL::WinAttach(shared.win, shared.ptr, capacity);
+        shared.cap = capacity;
+        shared.hdr[0] = MEL::GetAddress(shared.ptr);
+        shared.hdr[1] = shared.len;
+        MEL::WinUnlock(shared.hdrWin, shared.rank);
 
-        inline bool operator==(const Win &rhs) const {
-            return win == rhs.win;
-        };
-        inline bool operator!=(const Win &rhs) const {
-            return win != rhs.win;
-        };
+        MEL::WinDetach(shared.win, old);
+        MEL::MemFree(old);
     };
 
-#ifdef MEL_IMPLEMENTATION
-    const Win Win::WIN_NULL = Win(MPI_WIN_NULL);
-#endif
-
     /**
-     * \ingroup  Win
-     * Create a window error handler
-     *
-     * \see MPI_Win_create_errhandler
+     * \ingroup Shared
+     * Resize the local segment of a MEL::SharedVector. Only the calling process takes part
      *
-     * \param[in] func	The function to use
-     * \return			Returns a handle to an error handler
+     * \param[in] shared	The shared vector to resize
+     * \param[in] len		The new number of elements in the local segment
      */
-    inline ErrorHandler WinCreateErrorHandler(ErrorHandlerFunc func) {
-        MPI_Errhandler errHndl;
-        MEL_THROW( MPI_Win_create_errhandler((MPI_Win_errhandler_function*) func, &errHndl), "RMA::WinCreateErrorHandler" );
-        return ErrorHandler(errHndl);
+    template<typename T>
+    inline void SharedVectorResize(SharedVector<T> &shared, const int len) {
+        if (len > shared.cap) SharedVectorReserve(shared, std::max(len, shared.cap * 2));
+        shared.len = len;
+        SharedVector_publish(shared);
     };
 
     /**
-     * \ingroup  Win
-     * Set the error handler for a window
-     *
-     * \see MPI_Win_set_errhandler
+     * \ingroup Shared
+     * Append an element to the local segment of a MEL::SharedVector. Only the calling process takes part
      *
-     * \param[in] win		The file to attach to
-     * \param[in] errHndl	The handler to use
+     * \param[in] shared	The shared vector to append to
+     * \param[in] value		The element to append
      */
-    inline void WinSetErrorHandler(const Win &win, const ErrorHandler &errHndl) {
-        MEL_THROW( MPI_Win_set_errhandler((MPI_Win) win, (MPI_Errhandler) errHndl), "RMA::WinSetErrorHandler" );
+    template<typename T>
+    inline void SharedVectorPushBack(SharedVector<T> &shared, const T &value) {
+        if (shared.len == shared.cap) SharedVectorReserve(shared, shared.cap * 2);
+        shared.ptr[shared.len++] = value;
+        SharedVector_publish(shared);
     };
 
     /**
-     * \ingroup  Win
-     * Set the error handler for a window
+     * \ingroup Shared
+     * Get the number of elements in the segment of a MEL::SharedVector owned by the given process
      *
-     * \param[in] win	The file to attach to
-     * \param[in] func	The function to use
+     * \param[in] shared	The shared vector to query
+     * \param[in] rank		The rank of the process who owns the segment
+     * \return				Returns the number of elements
      */
-    inline void WinSetErrorHandler(const Win &win, ErrorHandlerFunc func) {
-        WinSetErrorHandler(win, WinCreateErrorHandler(func));
+    template<typename T>
+    inline int SharedVectorSize(SharedVector<T> &shared, const int rank) {
+        if (rank == shared.rank) return shared.len;
+
+        Aint hdr[2];
+        MEL::WinLockShared(shared.hdrWin, rank);
+        SharedVector_header(shared, rank, hdr);
+        MEL::WinUnlock(shared.hdrWin, rank);
+        return (int) hdr[1];
     };
 
     /**
-     * \ingroup  Win
-     * Get the error handler for a window
-     *
-     * \see MPI_Win_get_errhandler
+     * \ingroup Shared
+     * Get a range of elements from the segment of a MEL::SharedVector owned by the given process
      *
-     * \param[in] win	The file to attach to
-     * \return			Returns a handle to the error handler
+     * \param[in] shared	The shared vector to read from
+     * \param[in] rank		The rank of the process who owns the segment
+     * \param[in] start		The index of the first element to get
+     * \param[in] num		The number of elements to get
+     * \param[out] dst		Pointer to an array of at least num elements to get into
      */
-    inline ErrorHandler WinGetErrorHandler(const Win &win) {
-        MPI_Errhandler errHndl;
-        MEL_THROW( MPI_Win_get_errhandler((MPI_Win) win, &errHndl), "RMA::WinGetErrorHandler");
-        return ErrorHandler(errHndl);
+    template<typename T>
+    inline void SharedVectorGet(SharedVector<T> &shared, const int rank, const int start, const int num, T *dst) {
+        Aint hdr[2];
+        MEL::WinLockShared(shared.hdrWin, rank);
+        SharedVector_header(shared, rank, hdr);
+        if (start < 0 || (start + num) > hdr[1]) MEL::Abort(-1, "RMA::SharedVectorGet Index out of range!");
+
+        MEL::WinLockShared(shared.win, rank);
+        MEL::Get(dst, num, shared.typeData, hdr[0] + (Aint) (start * sizeof(T)), num, shared.typeData, rank, shared.win);
+        MEL::WinUnlock(shared.win, rank);
+        MEL::WinUnlock(shared.hdrWin, rank);
     };
 
     /**
-     * \ingroup  Win
-     * Create a window on memory allocated with MPI/MEL alloc functions
-     *
-     * \see MPI_Win_create, MPI_Win_set_errhandler
+     * \ingroup Shared
+     * Get the whole segment of a MEL::SharedVector owned by the given process
      *
-     * \param[in] ptr			Pointer to the memory to be mapped
-     * \param[in] size			The number of elements to be mapped
-     * \param[in] disp_unit		The size of each element in bytes
-     * \param[in] comm			The comm world to map the window within
-     * \return					Returns a handle to the window
+     * \param[in] shared	The shared vector to read from
+     * \param[in] rank		The rank of the process who owns the segment
+     * \return				Returns a std::vector containing a copy of the segment
      */
-    inline Win WinCreate(void *ptr, const Aint size, const int disp_unit, const Comm &comm) {
-        MPI_Win win;                                                                        
-        MEL_THROW( MPI_Win_create(ptr, size * disp_unit, disp_unit, MPI_INFO_NULL, (MPI_Comm) comm, (MPI_Win*) &win), "RMA::WinCreate" );
-        MEL_THROW( MPI_Win_set_errhandler(win, MPI_ERRORS_RETURN), "RMA::WinCreate(SetErrorHandler)" );                                                                
-        return Win(win);
+    template<typename T>
+    inline std::vector<T> SharedVectorGet(SharedVector<T> &shared, const int rank) {
+        Aint hdr[2];
+        MEL::WinLockShared(shared.hdrWin, rank);
+        SharedVector_header(shared, rank, hdr);
+
+        std::vector<T> dst(hdr[1]);
+        if (hdr[1] == 0) {
+            MEL::WinUnlock(shared.hdrWin, rank);
+            return dst;
+        }
+
+        MEL::WinLockShared(shared.win, rank);
+        MEL::Get(dst.data(), (int) hdr[1], shared.typeData, hdr[0], (int) hdr[1], shared.typeData, rank, shared.win);
+        MEL::WinUnlock(shared.win, rank);
+        MEL::WinUnlock(shared.hdrWin, rank);
+        return dst;
     };
-    
+
     /**
-     * \ingroup  Win
-     * Create a window on memory allocated with MPI/MEL alloc functions. Element size determined from template parameter
+     * \ingroup Shared
+     * Put a range of elements into the segment of a MEL::SharedVector owned by the given process. The range must already exist in the segment
      *
-     * \param[in] ptr			Pointer to the memory to be mapped
-     * \param[in] size			The number of elements to be mapped
-     * \param[in] comm			The comm world to map the window within
-     * \return					Returns a handle to the window
+     * \param[in] shared	The shared vector to write to
+     * \param[in] rank		The rank of the process who owns the segment
+     * \param[in] start		The index of the first element to put
+     * \param[in] num		The number of elements to put
+     * \param[in] src		Pointer to an array of num elements to put
      */
-    template<typename T> 
-    inline Win WinCreate(T *ptr, const Aint size, const Comm &comm) {
-        return WinCreate(ptr, size, sizeof(T), comm);
+    template<typename T>
+    inline void SharedVectorPut(SharedVector<T> &shared, const int rank, const int start, const int num, const T *src) {
+        Aint hdr[2];
+        MEL::WinLockShared(shared.hdrWin, rank);
+        SharedVector_header(shared, rank, hdr);
+        if (start < 0 || (start + num) > hdr[1]) MEL::Abort(-1, "RMA::SharedVectorPut Index out of range!");
+
+        MEL::WinLockExclusive(shared.win, rank);
+        MEL::Put((void*) src, num, shared.typeData, hdr[0] + (Aint) (start * sizeof(T)), num, shared.typeData, rank, shared.win);
+        MEL::WinUnlock(shared.win, rank);
+        MEL::WinUnlock(shared.hdrWin, rank);
+    };
+
+#endif
+
+#ifdef MEL_3
+
+    /// \cond HIDE
+    template<typename K, typename V, typename HASH = std::hash<K>>
+    struct DistributedHashMap {
+        /// Slot states
+        enum { EMPTY = 0, BUSY = 1, FULL = 2 };
+
+        /// Maximum number of consecutive slots fetched by a single Get when probing
+        enum { PROBE_RUN = 4 };
+
+        struct Slot {
+            int64_t state;
+            K key;
+            V value;
+        };
+
+        /// Members
+        Win win;
+        Slot *ptr;
+        int capacity, rank, size;
+        Comm comm;
+        HASH hash;
+
+        DistributedHashMap() : win(MEL::Win::WIN_NULL), ptr(nullptr), capacity(0), rank(0), size(0), comm(MEL::Comm::COMM_NULL) {};
+
+        /// Mix the user hash so identity hashes (e.g. std::hash<int>) spread evenly over ranks and slots
+        inline uint64_t mix(const K &key) const {
+            uint64_t h = (uint64_t) hash(key);
+            h ^= h >> 33; h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        };
+
+        inline int owner(const uint64_t h) const {
+            return (int) (h % (uint64_t) size);
+        };
+
+        inline int slot(const uint64_t h) const {
+            return (int) ((h / (uint64_t) size) % (uint64_t) capacity);
+        };
+
+        inline static Aint disp(const int s) {
+            return (Aint) s * (Aint) sizeof(Slot);
+        };
+
+        /// Slots hold an int64_t so their size and the offset of the key are whole words
+        enum { WORDS = sizeof(Slot) / sizeof(int64_t), KEY_WORD = offsetof(Slot, key) / sizeof(int64_t) };
     };
 
+    /// Every access to slot memory is an int64_t accumulate, as concurrent RMA accesses to the same location are only 
+    /// defined when they are all accumulates of the same predefined datatype
+    template<typename K, typename V, typename HASH>
+    inline void DistributedHashMap_read(DistributedHashMap<K, V, HASH> &map, void *dst, const int words, const Aint disp, const int owner) {
+        MEL::GetAccumulate(nullptr, 0, MEL::Datatype::INT64_T, dst, words, MEL::Datatype::INT64_T, disp, words, MEL::Datatype::INT64_T, MEL::Op::NO_OP, owner, map.win);
+    };
+
+    template<typename K, typename V, typename HASH>
+    inline void DistributedHashMap_write(DistributedHashMap<K, V, HASH> &map, const void *src, const int words, const Aint disp, const int owner) {
+        MEL::Accumulate((void*) src, words, MEL::Datatype::INT64_T, disp, words, MEL::Datatype::INT64_T, MEL::Op::REPLACE, owner, map.win);
+    };
+    /// \endcond
+
     /**
-     * \ingroup  Win
-     * Synchronize the RMA access epoch for win across all processes attached to it
-     *
-     * \see MPI_Win_fence
+     * \ingroup HashMap
+     * Create a MEL::DistributedHashMap across a comm world. Keys are hashed to an owning process, and each process 
+     * exposes a fixed size open addressing table through an RMA window. Keys and values must be trivially copyable and default constructible
      *
-     * \param[in] win			The window to synchronize
-     * \param[in] assert_tag	Program assertion
+     * \param[in] capacity	The number of slots in the table owned by each process
+     * \param[in] comm		The comm world to share the map across
+     * \return				Returns the distributed hash map
      */
-    inline void WinFence(const Win &win, const int assert_tag) {
-        MEL_THROW( MPI_Win_fence(assert_tag, (MPI_Win) win), "RMA::WinFence" );
+    template<typename K, typename V, typename HASH = std::hash<K>>
+    inline DistributedHashMap<K, V, HASH> DistributedHashMapCreate(const int capacity, const Comm &comm) {
+        typedef typename DistributedHashMap<K, V, HASH>::Slot Slot;
+        static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value, "MEL::DistributedHashMap keys and values must be trivially copyable");
+
+        DistributedHashMap<K, V, HASH> map;
+        map.comm     = comm;
+        map.rank     = MEL::CommRank(comm);
+        map.size     = MEL::CommSize(comm);
+        map.capacity = (capacity > 0) ? capacity : 1;
+
+        map.ptr = MEL::MemAlloc<Slot>(map.capacity);
+        std::memset(map.ptr, 0, sizeof(Slot) * map.capacity);
+        map.win = MEL::WinCreate(map.ptr, map.capacity * sizeof(Slot), 1, comm);
+
+        /// The map lives in a single passive target epoch until it is freed
+        MEL::WinLockAll(map.win);
+        MEL::Barrier(comm);
+        return map;
     };
-    
+
     /**
-     * \ingroup  Win
-     * Synchronize the RMA access epoch for win across all processes attached to it
+     * \ingroup HashMap
+     * Free a MEL::DistributedHashMap. Collective across the comm world the map was created in
      *
-     * \param[in] win			The window to synchronize
+     * \param[in] map		The map to free
      */
-    inline void WinFence(const Win &win) {
-        WinFence(win, 0);
+    template<typename K, typename V, typename HASH>
+    inline void DistributedHashMapFree(DistributedHashMap<K, V, HASH> &map) {
+        MEL::WinUnlockAll(map.win);
+        MEL::Barrier(map.comm);
+        MEL::WinFree(map.win);
+        MEL::MemFree(map.ptr);
+        map.capacity = 0;
     };
 
     /**
-     * \ingroup  Win
-     * Get the lock on an RMA access epoch for a window
-     *
-     * \see MPI_Win_lock
+     * \ingroup HashMap
+     * Insert or update a key in a MEL::DistributedHashMap. Empty slots are claimed with CompareAndSwap so concurrent 
+     * inserts never produce duplicate keys. Concurrent updates of the same key are resolved last writer wins
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
-     * \param[in] assert_tag	Program assertion
-     * \param[in] lock_type		The mode to get the lock in
+     * \param[in] map		The map to insert into
+     * \param[in] key		The key to insert
+     * \param[in] value		The value to associate with the key
+     * \return				Returns false if the table on the owning process is full
      */
-    inline void WinLock(const Win &win, const int rank, const int assert_tag, const LockType lock_type) {
-        MEL_THROW( MPI_Win_lock((int) lock_type, rank, assert_tag, (MPI_Win) win), "RMA::WinLock" );
+    template<typename K, typename V, typename HASH>
+    inline bool DistributedHashMapInsert(DistributedHashMap<K, V, HASH> &map, const K &key, const V &value) {
+        typedef DistributedHashMap<K, V, HASH> Map;
+        typedef typename Map::Slot Slot;
+
+        const uint64_t h  = map.mix(key);
+        const int owner   = map.owner(h),
+                  start   = map.slot(h),
+                  words   = Map::WORDS - Map::KEY_WORD;
+
+        /// The key and value are always written together as the words following the state
+        Slot local;
+        std::memset((void*) &local, 0, sizeof(Slot));
+        local.key   = key;
+        local.value = value;
+        const int64_t *src = ((const int64_t*) &local) + Map::KEY_WORD;
+        
+        for (int probe = 0; probe < map.capacity; ++probe) {
+            const Aint disp = Map::disp((start + probe) % map.capacity),
+                       body = disp + Map::KEY_WORD * sizeof(int64_t);
+
+            /// Try to claim the slot
+            int64_t state = MEL::CompareAndSwap((int64_t) Map::BUSY, (int64_t) Map::EMPTY, disp, owner, map.win);
+            if (state == Map::EMPTY) {
+                DistributedHashMap_write(map, src, words, body, owner);
+                MEL::WinFlush(map.win, owner);
+
+                /// Publish the slot only once the key and value are in place
+                MEL::FetchAndOp((int64_t) Map::FULL, MEL::Op::REPLACE, disp, owner, map.win);
+                MEL::WinFlush(map.win, owner);
+                return true;
+            }
+
+            /// Another process is filling this slot, wait for it to publish the key. Back off between polls so the
+            /// owner's own accumulates are not starved by a stream of remote ones
+            for (int backoff = 1; state == Map::BUSY; backoff = std::min(backoff * 2, 1024)) {
+                std::this_thread::sleep_for(std::chrono::microseconds(backoff));
+                state = MEL::FetchAndOp((int64_t) 0, MEL::Op::NO_OP, disp, owner, map.win);
+            }
+            
+            Slot other;
+            DistributedHashMap_read(map, ((int64_t*) &other) + Map::KEY_WORD, words, body, owner);
+            MEL::WinFlush(map.win, owner);
+            
+            if (other.key == key) {
+                DistributedHashMap_write(map, src, words, body, owner);
+                MEL::WinFlush(map.win, owner);
+                return true;
+            }
+        }
+        return false;
     };
-    
+
     /**
-     * \ingroup  Win
-     * Get the lock on an RMA access epoch for a window
+     * \ingroup HashMap
+     * Look up a batch of keys in a MEL::DistributedHashMap. Probe runs for all keys are fetched with atomic no-op GetAccumulates, 
+     * grouped by owning process so that each round of probing costs a single flush per target rank rather than one round trip 
+     * per key. Lookups may run concurrently with inserts and see either the old or the new value of a key being updated
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
-     * \param[in] lock_type		The mode to get the lock in
+     * \param[in] map		The map to search
+     * \param[in] keys		The keys to look up
+     * \param[out] values	Resized to keys.size(). Holds the value of each key that was found
+     * \param[out] found	Resized to keys.size(). Set true for each key that was found
+     * \return				Returns the number of keys found
      */
-    inline void WinLock(const Win &win, const int rank, const LockType lock_type) {
-        WinLock(win, rank, 0, lock_type);
+    template<typename K, typename V, typename HASH>
+    inline int DistributedHashMapFind(DistributedHashMap<K, V, HASH> &map, const std::vector<K> &keys, std::vector<V> &values, std::vector<bool> &found) {
+        typedef DistributedHashMap<K, V, HASH> Map;
+        typedef typename Map::Slot Slot;
+
+        const int n   = keys.size(),
+                  run = std::min((int) Map::PROBE_RUN, map.capacity);
+        values.resize(n);
+        found.assign(n, false);
+
+        std::vector<int> owner(n), start(n), probed(n, 0), fetched(n), active(n);
+        for (int i = 0; i < n; ++i) {
+            const uint64_t h = map.mix(keys[i]);
+            owner[i]  = map.owner(h);
+            start[i]  = map.slot(h);
+            active[i] = i;
+        }
+        std::sort(active.begin(), active.end(), [&owner](const int a, const int b) { return owner[a] < owner[b]; });
+
+        std::vector<Slot> buffer(n * run);
+        int numFound = 0;
+        while (!active.empty()) {
+            /// Issue one contiguous read per key, then complete them with one flush per target rank
+            for (const int i : active) {
+                const int s = (start[i] + probed[i]) % map.capacity;
+                fetched[i]  = std::min(run, map.capacity - s);
+                DistributedHashMap_read(map, &buffer[i * run], fetched[i] * Map::WORDS, Map::disp(s), owner[i]);
+            }
+            for (int k = 0; k < (int) active.size(); ++k) {
+                if (k == 0 || owner[active[k]] != owner[active[k - 1]]) MEL::WinFlush(map.win, owner[active[k]]);
+            }
+
+            /// Keys that hit neither a match nor an empty slot keep probing in the next round
+            int remaining = 0;
+            for (const int i : active) {
+                bool done = false;
+                for (int j = 0; j < fetched[i] && !done; ++j) {
+                    const Slot &slot = buffer[i * run + j];
+                    if (slot.state == Map::EMPTY) {
+                        done = true;
+                    }
+                    else if (slot.state == Map::FULL && slot.key == keys[i]) {
+                        values[i] = slot.value;
+                        found[i]  = true;
+                        ++numFound;
+                        done = true;
+                    }
+                }
+                probed[i] += fetched[i];
+                if (!done && probed[i] < map.capacity) active[remaining++] = i;
+            }
+            active.resize(remaining);
+        }
+        return numFound;
     };
 
     /**
-     * \ingroup  Win
-     * Get an exclusive lock on an RMA access epoch for a window
+     * \ingroup HashMap
+     * Look up a key in a MEL::DistributedHashMap
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
-     * \param[in] assert_tag	Program assertion
+     * \param[in] map		The map to search
+     * \param[in] key		The key to look up
+     * \param[out] value	The value associated with the key, if found
+     * \return				Returns true if the key was found
      */
-    inline void WinLockExclusive(const Win &win, const int rank, const int assert_tag) {
-        WinLock(win, rank, assert_tag, LockType::EXCLUSIVE);
+    template<typename K, typename V, typename HASH>
+    inline bool DistributedHashMapFind(DistributedHashMap<K, V, HASH> &map, const K &key, V &value) {
+        std::vector<K> keys(1, key);
+        std::vector<V> values;
+        std::vector<bool> found;
+        DistributedHashMapFind(map, keys, values, found);
+        if (found[0]) value = values[0];
+        return found[0];
     };
-    
+
     /**
-     * \ingroup  Win
-     * Get an exclusive lock on an RMA access epoch for a window
+     * \ingroup HashMap
+     * Count the keys stored in a MEL::DistributedHashMap. Collective across the comm world the map was created in
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
+     * \param[in] map		The map to count
+     * \return				Returns the number of keys stored across all processes
      */
-    inline void WinLockExclusive(const Win &win, const int rank) {
-        WinLockExclusive(win, rank, 0);
+    template<typename K, typename V, typename HASH>
+    inline int DistributedHashMapSize(DistributedHashMap<K, V, HASH> &map) {
+        typedef DistributedHashMap<K, V, HASH> Map;
+        MEL::Barrier(map.comm);
+        MEL::WinSync(map.win);
+
+        int local = 0;
+        for (int i = 0; i < map.capacity; ++i) 
+            if (map.ptr[i].state == Map::FULL) ++local;
+        
+        int global = 0;
+        MEL::Allreduce(&local, &global, 1, MEL::Datatype::INT, MEL::Op::SUM, map.comm);
+        return global;
+    };
+
+#endif
+
+    /// \cond HIDE
+    /// Collective termination for message engines that count the messages they send to each process. Rounds of flush, 
+    /// then progress until every message sent to this process in the round has been received, repeat until no process 
+    /// sent or buffered anything new while draining
+    template<typename FLUSH, typename PROGRESS, typename BUFFERED>
+    inline void Quiesce_helper(std::vector<int> &sentTo, const int &received, const int rank, const Comm &comm, FLUSH flush, PROGRESS progress, BUFFERED buffered) {
+        std::vector<int> expected(sentTo.size());
+        while (true) {
+            flush();
+
+            int sent = 0;
+            for (const int n : sentTo) sent += n;
+            MEL::Allreduce(&sentTo[0], &expected[0], sentTo.size(), MEL::Datatype::INT, MEL::Op::SUM, comm);
+            while (received < expected[rank]) progress();
+
+            /// Handlers may have produced new messages while we drained, keep going until no process has any
+            int more = buffered() - sent;
+            for (const int n : sentTo) more += n;
+            
+            int global = 0;
+            MEL::Allreduce(&more, &global, 1, MEL::Datatype::INT, MEL::Op::SUM, comm);
+            if (global == 0) break;
+        }
+    };
+
+    struct Aggregator {
+        typedef std::function<void(const int, const char*, const int)> Handler;
+
+        struct Pending {
+            Request rq;
+            std::vector<char> data;
+        };
+
+        /// Members
+        Comm comm;
+        int rank, size, tag, sizeThreshold, received;
+        double timeThreshold;
+        std::vector<std::vector<char>> buffers, spare;
+        std::vector<double> bufferTime;
+        std::vector<int> sentTo;
+        std::vector<Pending> pending;
+        std::vector<Handler> handlers;
+
+        Aggregator() : comm(MEL::Comm::COMM_NULL), rank(0), size(0), tag(0), sizeThreshold(0), received(0), timeThreshold(-1.) {};
     };
+    /// \endcond
 
     /**
-     * \ingroup  Win
-     * Get a shared lock on an RMA access epoch for a window
+     * \ingroup Aggregate
+     * Create a MEL::Aggregator across a comm world. Small messages pushed to a destination are packed into a single buffer 
+     * which is sent once it reaches sizeThreshold bytes, once its oldest message is older than timeThreshold seconds, or on an explicit flush
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
-     * \param[in] assert_tag	Program assertion
+     * \param[in] tag				The tag used for all aggregated messages. Must not be used for any other traffic on comm
+     * \param[in] sizeThreshold		The number of buffered bytes per destination that triggers a send
+     * \param[in] timeThreshold		The age in seconds of a buffer that triggers a send during AggregatorProgress. Negative to disable
+     * \param[in] comm				The comm world to aggregate messages within
+     * \return						Returns the aggregator
      */
-    inline void WinLockShared(const Win &win, const int rank, const int assert_tag) {
-        WinLock(win, rank, assert_tag, LockType::SHARED);
+    inline Aggregator AggregatorCreate(const int tag, const int sizeThreshold, const double timeThreshold, const Comm &comm) {
+        Aggregator agg;
+        agg.comm          = comm;
+        agg.rank          = MEL::CommRank(comm);
+        agg.size          = MEL::CommSize(comm);
+        agg.tag           = tag;
+        agg.sizeThreshold = sizeThreshold;
+        agg.timeThreshold = timeThreshold;
+        agg.buffers.resize(agg.size);
+        agg.bufferTime.resize(agg.size, 0.);
+        agg.sentTo.resize(agg.size, 0);
+        return agg;
     };
 
     /**
-     * \ingroup  Win
-     * Get a shared lock on an RMA access epoch for a window
+     * \ingroup Aggregate
+     * Create a MEL::Aggregator across a comm world with a 64KB size threshold and a 1ms time threshold
      *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
+     * \param[in] tag				The tag used for all aggregated messages. Must not be used for any other traffic on comm
+     * \param[in] comm				The comm world to aggregate messages within
+     * \return						Returns the aggregator
      */
-    inline void WinLockShared(const Win &win, const int rank) {
-        WinLockShared(win, rank, 0);
+    inline Aggregator AggregatorCreate(const int tag, const Comm &comm) {
+        return AggregatorCreate(tag, 1 << 16, 1e-3, comm);
     };
 
     /**
-     * \ingroup  Win
-     * Release the lock on an RMA access epoch for a window
+     * \ingroup Aggregate
+     * Register a handler to be called for each message delivered with the returned id. 
+     * Handlers must be registered in the same order on every process
      *
-     * \see MPI_Win_unlock
-     *
-     * \param[in] win			The window to lock
-     * \param[in] rank			The process rank to get the lock from
+     * \param[in] agg				The aggregator to register with
+     * \param[in] handler			Function taking the source rank, a pointer to the message bytes, and the number of bytes
+     * \return						Returns the handler id
      */
-    inline void WinUnlock(const Win &win, const int rank) {
-        MEL_THROW( MPI_Win_unlock(rank, (MPI_Win) win), "RMA::WinUnlock" );
+    inline int AggregatorRegister(Aggregator &agg, const Aggregator::Handler &handler) {
+        agg.handlers.push_back(handler);
+        return agg.handlers.size() - 1;
     };
 
     /**
-     * \ingroup  Win
-     * Put data into the mapped window of another process
+     * \ingroup Aggregate
+     * Register a handler to be called for each message delivered with the returned id. Messages are unpacked as an array of T
+     * and the handler is called once per element. Handlers must be registered in the same order on every process
      *
-     * \see MPI_Put
-     *
-     * \param[in] origin_ptr		Pointer to the array to put
-     * \param[in] origin_num		The number of elements to put from the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be put
-     * \param[in] target_disp		Element displacement into the window to put data into
-     * \param[in] target_num		The number of elements to put into the window
-     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
-     * \param[in] target_rank		Rank of the process to put into
-     * \param[in] win				The window to put into
+     * \param[in] agg				The aggregator to register with
+     * \param[in] func				Function taking the source rank and an element
+     * \return						Returns the handler id
      */
-    inline void Put(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
-        MEL_THROW( MPI_Put(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win), "RMA::Put" );
+    template<typename T>
+    inline int AggregatorRegister(Aggregator &agg, const std::function<void(const int, const T&)> &func) {
+        return AggregatorRegister(agg, [func](const int src, const char *ptr, const int len) {
+            T val;
+            for (int i = 0; i + (int) sizeof(T) <= len; i += sizeof(T)) {
+                std::memcpy(&val, ptr + i, sizeof(T));
+                func(src, val);
+            }
+        });
     };
 
     /**
-     * \ingroup  Win
-     * Accumulate data into the mapped window of another process
+     * \ingroup Aggregate
+     * Send the buffered messages for a destination, if there are any
      *
-     * \see MPI_Accumulate
-     *
-     * \param[in] origin_ptr		Pointer to the array to put
-     * \param[in] origin_num		The number of elements to put from the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be put
-     * \param[in] target_disp		Element displacement into the window to put data into
-     * \param[in] target_num		The number of elements to put into the window
-     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
-     * \param[in] op				The MPI operation to use
-     * \param[in] target_rank		Rank of the process to put into
-     * \param[in] win				The window to put into
+     * \param[in] agg				The aggregator to flush
+     * \param[in] dst				The rank of the destination to flush
      */
-    inline void Accumulate(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const Op &op, const int target_rank, const Win &win) {
-        MEL_THROW( MPI_Accumulate(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Op) op, (MPI_Win) win), "RMA::Accumulate" );
+    inline void AggregatorFlush(Aggregator &agg, const int dst) {
+        std::vector<char> &buf = agg.buffers[dst];
+        if (buf.empty()) return;
+
+        Aggregator::Pending p;
+        p.data.swap(buf);
+        MEL::Isend(&p.data[0], p.data.size(), MEL::Datatype::CHAR, dst, agg.tag, agg.comm, p.rq);
+        agg.pending.push_back(std::move(p));
+        ++agg.sentTo[dst];
+
+        /// Reuse the storage of a completed send if we have one
+        if (!agg.spare.empty()) {
+            buf.swap(agg.spare.back());
+            agg.spare.pop_back();
+        }
     };
 
     /**
-     * \ingroup  Win
-     * Get data from the mapped window of another process
-     *
-     * \see MPI_Get
+     * \ingroup Aggregate
+     * Send the buffered messages for all destinations
      *
-     * \param[out] origin_ptr		Pointer to the array to get
-     * \param[in] origin_num		The number of elements to get into the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
-     * \param[in] target_disp		Element displacement into the window to get data from
-     * \param[in] target_num		The number of elements to get from the window
-     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
-     * \param[in] target_rank		Rank of the process to get from
-     * \param[in] win				The window to get from
+     * \param[in] agg				The aggregator to flush
      */
-    inline void Get(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
-        MEL_THROW( MPI_Get(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win), "RMA::Get" );
+    inline void AggregatorFlush(Aggregator &agg) {
+        for (int dst = 0; dst < agg.size; ++dst) AggregatorFlush(agg, dst);
     };
 
-#ifdef MEL_3
-    
     /**
-     * \ingroup  Win
-     * Get the lock on an RMA access epoch for a window on all attached processes
-     *
-     * \see MPI_Win_lock_all
+     * \ingroup Aggregate
+     * Buffer a message for a destination, sending the buffer if it has reached the size threshold
      *
-     * \param[in] win			The window to lock
-     * \param[in] assert_tag	Program assertion
+     * \param[in] agg				The aggregator to push to
+     * \param[in] dst				The rank of the destination
+     * \param[in] handler			The id of the handler to deliver the message to
+     * \param[in] ptr				Pointer to the message bytes
+     * \param[in] len				The number of bytes in the message
      */
-    inline void WinLockAll(const Win &win, const int assert_tag) {
-        MEL_THROW(MPI_Win_lock_all(assert_tag, (MPI_Win) win), "RMA::WinLockAll");
+    inline void AggregatorPush(Aggregator &agg, const int dst, const int handler, const void *ptr, const int len) {
+        std::vector<char> &buf = agg.buffers[dst];
+        if (buf.empty()) agg.bufferTime[dst] = MEL::Wtime();
+
+        const int hdr[2] = { handler, len };
+        const size_t off = buf.size();
+        buf.resize(off + sizeof(hdr) + len);
+        std::memcpy(&buf[off], hdr, sizeof(hdr));
+        if (len > 0) std::memcpy(&buf[off + sizeof(hdr)], ptr, len);
+
+        if ((int) buf.size() >= agg.sizeThreshold) AggregatorFlush(agg, dst);
     };
 
     /**
-     * \ingroup  Win
-     * Get the lock on an RMA access epoch for a window on all attached processes
+     * \ingroup Aggregate
+     * Buffer a single element for a destination, sending the buffer if it has reached the size threshold
      *
-     * \param[in] win			The window to lock
+     * \param[in] agg				The aggregator to push to
+     * \param[in] dst				The rank of the destination
+     * \param[in] handler			The id of the handler to deliver the message to
+     * \param[in] val				The element to send
      */
-    inline void WinLockAll(const Win &win) {
-        WinLockAll(win, 0);
+    template<typename T>
+    inline void AggregatorPush(Aggregator &agg, const int dst, const int handler, const T &val) {
+        AggregatorPush(agg, dst, handler, &val, sizeof(T));
     };
 
     /**
-     * \ingroup  Win
-     * Release the lock on an RMA access epoch for a window on all attached processes
-     *
-     * \see MPI_Win_unlock_all
+     * \ingroup Aggregate
+     * Make progress on an aggregator. Sends buffers older than the time threshold, retires completed sends, 
+     * and receives and dispatches any aggregated messages that have arrived
      *
-     * \param[in] win			The window to unlock
+     * \param[in] agg				The aggregator to progress
+     * \return						Returns the number of messages dispatched to handlers
      */
-    inline void WinUnlockAll(const Win &win) {
-        MEL_THROW(MPI_Win_unlock_all((MPI_Win) win), "RMA::WinUnlockAll");
+    inline int AggregatorProgress(Aggregator &agg) {
+        if (agg.timeThreshold >= 0.) {
+            const double now = MEL::Wtime();
+            for (int dst = 0; dst < agg.size; ++dst) 
+                if (!agg.buffers[dst].empty() && (now - agg.bufferTime[dst]) >= agg.timeThreshold) AggregatorFlush(agg, dst);
+        }
+
+        /// Retire completed sends keeping their storage for reuse
+        int active = 0;
+        for (int i = 0; i < (int) agg.pending.size(); ++i) {
+            if (MEL::Test(agg.pending[i].rq)) {
+                agg.spare.push_back(std::move(agg.pending[i].data));
+                agg.spare.back().clear();
+            }
+            else if (active != i) {
+                agg.pending[active++] = std::move(agg.pending[i]);
+            }
+            else {
+                ++active;
+            }
+        }
+        agg.pending.resize(active);
+
+        int dispatched = 0;
+        std::vector<char> msg;
+        while (true) {
+#ifdef MEL_3
+            /// A matched probe keeps another thread progressing the same tag from receiving this message
+            MEL::Message message;
+            auto probe = MEL::Improbe(MEL::ANY_SOURCE, agg.tag, agg.comm, message);
+#else
+            auto probe = MEL::Iprobe(MEL::ANY_SOURCE, agg.tag, agg.comm);
+#endif
+            if (!probe.first) break;
+
+            const int src = probe.second.MPI_SOURCE,
+                      len = MEL::ProbeGetCount<char>(probe.second);
+            msg.resize(len);
+#ifdef MEL_3
+            MEL::Mrecv(&msg[0], len, MEL::Datatype::CHAR, message);
+#else
+            MEL::Recv(&msg[0], len, MEL::Datatype::CHAR, src, agg.tag, agg.comm);
+#endif
+            ++agg.received;
+
+            int hdr[2];
+            for (int off = 0; off < len; off += sizeof(hdr) + hdr[1]) {
+                std::memcpy(hdr, &msg[off], sizeof(hdr));
+                if (hdr[0] < 0 || hdr[0] >= (int) agg.handlers.size()) MEL::Abort(-1, "Aggregator::Progress Unknown handler id!");
+                agg.handlers[hdr[0]](src, &msg[off + sizeof(hdr)], hdr[1]);
+                ++dispatched;
+            }
+        }
+        return dispatched;
     };
 
     /**
-     * \ingroup  Win
-     * Force all operations within an RMA access epoch for a window to finish
-     *
-     * \see MPI_Win_flush
+     * \ingroup Aggregate
+     * Flush and deliver all outstanding messages on every process. Messages pushed by handlers while draining are delivered 
+     * before returning. Collective across the comm world the aggregator was created in
      *
-     * \param[in] win			The window to flush
-     * \param[in] rank			Rank to force synchronization with
+     * \param[in] agg				The aggregator to synchronize
      */
-    inline void WinFlush(const Win &win, const int rank) {
-        MEL_THROW(MPI_Win_flush(rank, (MPI_Win) win), "RMA::WinFlush");
+    inline void AggregatorSync(Aggregator &agg) {
+        Quiesce_helper(agg.sentTo, agg.received, agg.rank, agg.comm, 
+                       [&agg]() { AggregatorFlush(agg); }, 
+                       [&agg]() { AggregatorProgress(agg); }, 
+                       [&agg]() {
+                           int buffered = 0;
+                           for (const auto &buf : agg.buffers) if (!buf.empty()) ++buffered;
+                           return buffered;
+                       });
+
+        for (auto &p : agg.pending) MEL::Wait(p.rq);
+        agg.pending.clear();
     };
-    
+
     /**
-     * \ingroup  Win
-     * Force all operations within an RMA access epoch for a window to finish for all attached processes
+     * \ingroup Aggregate
+     * Free a MEL::Aggregator, waiting on any sends still in flight. Buffered messages that were not flushed are discarded
      *
-     * \see MPI_Win_flush_all
-     *
-     * \param[in] win			The window to flush
+     * \param[in] agg				The aggregator to free
      */
-    inline void WinFlushAll(const Win &win) {
-        MEL_THROW(MPI_Win_flush_all((MPI_Win) win), "RMA::WinFlushAll");
+    inline void AggregatorFree(Aggregator &agg) {
+        for (auto &p : agg.pending) MEL::Wait(p.rq);
+        agg.pending.clear();
+        agg.buffers.clear();
+        agg.spare.clear();
+        agg.handlers.clear();
     };
 
+
     /**
-     * \ingroup  Win
-     * Force all local operations within an RMA access epoch for a window to finish
-     *
-     * \see MPI_Win_flush_local
-     *
-     * \param[in] win			The window to flush
-     * \param[in] rank			Rank to force synchronization with
+     * \ingroup Checkpoint
+     * What CheckpointerWrite does when the previous checkpoint is still being written
      */
-    inline void WinFlushLocal(const Win &win, const int rank) {
-        MEL_THROW(MPI_Win_flush_local(rank, (MPI_Win) win), "RMA::WinFlushLocal");
+    enum class CheckpointPolicy {
+        WAIT,
+        SKIP
+    };
+
+    /// \cond HIDE
+    struct Checkpointer {
+        struct Array {
+            void *ptr;
+            int bytes;
+            Datatype fileType;
+            Offset disp;
+        };
+
+        /// Members
+        Comm comm;
+        File file;
+        CheckpointPolicy policy;
+        std::vector<Array> arrays;
+        std::vector<char> staging[2];
+        Datatype fileType;
+        Offset fileBytes;
+        int localBytes, current;
+        bool inFlight;
+        Request rq;
+
+        Checkpointer() : comm(MEL::Comm::COMM_NULL), file(MPI_FILE_NULL), policy(CheckpointPolicy::WAIT), fileType(MEL::Datatype::DATATYPE_NULL), 
+                         fileBytes(0), localBytes(0), current(0), inFlight(false) {};
     };
+    /// \endcond
 
     /**
-     * \ingroup  Win
-     * Force all local operations within an RMA access epoch for a window to finish for all attached processes
-     *
-     * \see MPI_Win_flush_local_all
+     * \ingroup Checkpoint
+     * Create a MEL::Checkpointer writing to a shared file. Collective across the comm world
      *
-     * \param[in] win			The window to flush
+     * \param[in] path				The path of the checkpoint file. Created if it does not exist
+     * \param[in] comm				The comm world to checkpoint within
+     * \param[in] policy			WAIT blocks a new checkpoint until the previous one is written, SKIP drops it instead
+     * \param[in] info				Hints passed to FileOpen
+     * \return						Returns the checkpointer
      */
-    inline void WinFlushLocalAll(const Win &win) {
-        MEL_THROW(MPI_Win_flush_local_all((MPI_Win) win), "RMA::WinFlushLocalAll");
+    inline Checkpointer CheckpointerCreate(const std::string &path, const Comm &comm, const CheckpointPolicy policy, const Info &info) {
+        Checkpointer cp;
+        cp.comm   = comm;
+        cp.policy = policy;
+        cp.file   = MEL::FileOpen(comm, path, MEL::FileMode::CREATE | MEL::FileMode::RDWR, info);
+        return cp;
     };
 
     /**
-     * \ingroup  Win
-     * Synchronize the public and private copies of the window
-     *
-     * \see MPI_Win_sync
+     * \ingroup Checkpoint
+     * Create a MEL::Checkpointer writing to a shared file. Collective across the comm world
      *
-     * \param[in] win			The window to synchronize
+     * \param[in] path				The path of the checkpoint file. Created if it does not exist
+     * \param[in] comm				The comm world to checkpoint within
+     * \param[in] policy			WAIT blocks a new checkpoint until the previous one is written, SKIP drops it instead
+     * \return						Returns the checkpointer
      */
-    inline void WinSync(const Win &win) {
-        MEL_THROW(MPI_Win_sync((MPI_Win) win), "RMA::WinSync");
+    inline Checkpointer CheckpointerCreate(const std::string &path, const Comm &comm, const CheckpointPolicy policy = CheckpointPolicy::WAIT) {
+        return CheckpointerCreate(path, comm, policy, MEL::Info::INFO_NULL);
     };
 
     /**
-     * \ingroup  Win
-     * Put data into the mapped window of another process
+     * \ingroup Checkpoint
+     * Block until the checkpoint in flight, if any, has been written. Collective across the comm world
      *
-     * \see MPI_Rput
-     *
-     * \param[in] origin_ptr		Pointer to the array to put
-     * \param[in] origin_num		The number of elements to put from the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be put
-     * \param[in] target_disp		Element displacement into the window to put data into
-     * \param[in] target_num		The number of elements to put into the window
-     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
-     * \param[in] target_rank		Rank of the process to put into
-     * \param[in] win				The window to put into
-     * \param[out] rq				A request object
+     * \param[in] cp				The checkpointer
      */
-    inline void Rput(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win, Request &rq) {
-        MEL_THROW(MPI_Rput(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Rput");
+    inline void CheckpointerWait(Checkpointer &cp) {
+        if (!cp.inFlight) return;
+#ifdef MEL_3_1
+        MEL::Wait(cp.rq);
+#else
+        MEL::FileWriteAtAllEnd(cp.file, cp.staging[cp.current].data());
+#endif
+        cp.inFlight = false;
     };
 
     /**
-     * \ingroup  Win
-     * Put data into the mapped window of another process
+     * \ingroup Checkpoint
+     * Test whether the checkpoint in flight has been written. Without MPI 3.1 the write is a split-collective 
+     * so this blocks, and must be called by every process
      *
-     * \param[in] origin_ptr		Pointer to the array to put
-     * \param[in] origin_num		The number of elements to put from the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be put
-     * \param[in] target_disp		Element displacement into the window to put data into
-     * \param[in] target_num		The number of elements to put into the window
-     * \param[in] target_datatype	The derived datatype of the elements to be put into the window
-     * \param[in] target_rank		Rank of the process to put into
-     * \param[in] win				The window to put into
-     * \return						Returns a request object
+     * \param[in] cp				The checkpointer
+     * \return						Returns true if no checkpoint is in flight on this process
      */
-    inline Request Rput(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
-        Request rq;
-        Rput(origin_ptr, origin_num, origin_datatype, target_disp, target_num, target_datatype, target_rank, win, rq);
-        return rq;
+    inline bool CheckpointerTest(Checkpointer &cp) {
+        if (!cp.inFlight) return true;
+#ifdef MEL_3_1
+        if (MEL::Test(cp.rq)) cp.inFlight = false;
+#else
+        CheckpointerWait(cp);
+#endif
+        return !cp.inFlight;
+    };
+
+    /// \cond HIDE
+    inline void Checkpointer_add(Checkpointer &cp, void *ptr, const int bytes, const Datatype &fileType, const Offset disp, const Offset regionBytes) {
+        /// The file view cannot change under a write in flight
+        CheckpointerWait(cp);
+        MEL::TypeFree(cp.fileType);
+
+        Checkpointer::Array array;
+        array.ptr      = ptr;
+        array.bytes    = bytes;
+        array.fileType = fileType;
+        array.disp     = cp.fileBytes + disp;
+        cp.arrays.push_back(array);
+
+        cp.fileBytes  += regionBytes;
+        cp.localBytes += bytes;
+    };
+
+    inline void Checkpointer_build(Checkpointer &cp) {
+        if (cp.fileType != MEL::Datatype::DATATYPE_NULL) return;
+        if (cp.arrays.empty()) MEL::Abort(-1, "Checkpointer No arrays registered!");
+
+        /// One filetype covering every registered region, so a checkpoint is a single collective write
+        std::vector<TypeStruct_Block> blocks;
+        for (const auto &array : cp.arrays) blocks.push_back(TypeStruct_Block(array.fileType, 1, (Aint) array.disp));
+        cp.fileType = MEL::TypeCreateStruct(blocks);
+        MEL::FileSetView(cp.file, 0, MEL::Datatype::UNSIGNED_CHAR, cp.fileType);
+
+        cp.staging[0].resize(cp.localBytes);
+        cp.staging[1].resize(cp.localBytes);
     };
+    /// \endcond
 
     /**
-     * \ingroup  Win
-     * Get data from the mapped window of another process
+     * \ingroup Checkpoint
+     * Register a local array with the checkpointer. Each process's array is stored contiguously, in rank order. 
+     * Collective across the comm world, and arrays must be registered in the same order on every process
      *
-     * \see MPI_Rget
-     *
-     * \param[out] origin_ptr		Pointer to the array to get
-     * \param[in] origin_num		The number of elements to get into the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
-     * \param[in] target_disp		Element displacement into the window to get data from
-     * \param[in] target_num		The number of elements to get from the window
-     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
-     * \param[in] target_rank		Rank of the process to get from
-     * \param[in] win				The window to get from
-     * \param[out] rq				A request object
+     * \param[in] cp				The checkpointer
+     * \param[in] ptr				Pointer to the local array. Must remain valid until the checkpointer is freed
+     * \param[in] num				The number of elements in the local array
      */
-    inline void Rget(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win, Request &rq) {
-        MEL_THROW(MPI_Rget(origin_ptr, origin_num, (MPI_Datatype) origin_datatype, target_rank, target_disp, target_num, (MPI_Datatype) target_datatype, (MPI_Win) win, (MPI_Request*) &rq), "RMA::Rget");
+    template<typename T>
+    inline void CheckpointerRegister(Checkpointer &cp, T *ptr, const int num) {
+        const int rank = MEL::CommRank(cp.comm), size = MEL::CommSize(cp.comm);
+        int bytes = num * sizeof(T);
+        std::vector<int> all(size);
+        MEL::Allgather(&bytes, 1, &all[0], 1, cp.comm);
+
+        Offset start = 0, total = 0;
+        for (int i = 0; i < size; ++i) {
+            if (i < rank) start += all[i];
+            total += all[i];
+        }
+        Checkpointer_add(cp, ptr, bytes, MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, bytes), start, total);
     };
-    
+
     /**
-     * \ingroup  Win
-     * Get data from the mapped window of another process
+     * \ingroup Checkpoint
+     * Register the local block of a distributed array with the checkpointer. The global array is stored in the file in 
+     * row major order. Collective across the comm world, and arrays must be registered in the same order on every process
      *
-     * \param[out] origin_ptr		Pointer to the array to get
-     * \param[in] origin_num		The number of elements to get into the local array
-     * \param[in] origin_datatype	The derived datatype of the elements to be gotten
-     * \param[in] target_disp		Element displacement into the window to get data from
-     * \param[in] target_num		The number of elements to get from the window
-     * \param[in] target_datatype	The derived datatype of the elements to be gotten from the window
-     * \param[in] target_rank		Rank of the process to get from
-     * \param[in] win				The window to get from
-     * \return						Returns a request object
+     * \param[in] cp				The checkpointer
+     * \param[in] ptr				Pointer to the local block, stored contiguously. Must remain valid until the checkpointer is freed
+     * \param[in] dims				A std::vector of triples representing the start, local size, and global size of each dimension
      */
-    inline Request Rget(void *origin_ptr, int origin_num, const Datatype &origin_datatype, const Aint target_disp, const int target_num, const Datatype &target_datatype, const int target_rank, const Win &win) {
-        Request rq;
-        Rget(origin_ptr, origin_num, origin_datatype, target_disp, target_num, target_datatype, target_rank, win, rq);
-        return rq;
+    template<typename T>
+    inline void CheckpointerRegister(Checkpointer &cp, T *ptr, const std::vector<TypeSubArray_Dim> &dims) {
+        Datatype element = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, sizeof(T));
+        Datatype subArray = MEL::TypeCreateSubArray(element, dims);
+        MEL::TypeFree(element);
+
+        int bytes = sizeof(T);
+        Offset total = sizeof(T);
+        for (const auto &dim : dims) {
+            bytes *= dim.size;
+            total *= dim.extent;
+        }
+        Checkpointer_add(cp, ptr, bytes, subArray, 0, total);
     };
-    
-#endif
-    
+
     /**
-     * \ingroup  Win
-     * Free an RMA window
+     * \ingroup Checkpoint
+     * Snapshot every registered array and start writing them in the background. The arrays may be modified as soon as this returns. 
+     * Collective across the comm world
      *
-     * \see MPI_Win_free
-     *
-     * \param[in] win			The window to free
+     * \param[in] cp				The checkpointer
+     * \return						Returns false if the checkpoint was skipped because the previous one was still in flight
      */
-    inline void WinFree(Win &win) {
-        if (win != MEL::Win::WIN_NULL)
-            MEL_THROW( MPI_Win_free((MPI_Win*) &win), "RMA::FreeWin" );                                                                
-    };    
+    inline bool CheckpointerWrite(Checkpointer &cp) {
+        Checkpointer_build(cp);
+
+        if (cp.policy == CheckpointPolicy::SKIP) {
+            /// Every process must agree, a collective write cannot be started by only some of them
+            int done = CheckpointerTest(cp) ? 1 : 0, all = 0;
+            MEL::Allreduce(&done, &all, 1, MEL::Datatype::INT, MEL::Op::LAND, cp.comm);
+            if (all == 0) return false;
+        }
+
+        /// Copy into the spare buffer while the previous checkpoint may still be draining from the other
+        const int next = 1 - cp.current;
+        char *staging = cp.staging[next].data();
+        for (const auto &array : cp.arrays) {
+            std::memcpy(staging, array.ptr, array.bytes);
+            staging += array.bytes;
+        }
+
+        CheckpointerWait(cp);
+        cp.current = next;
+#ifdef MEL_3_1
+        cp.rq = MEL::FileIwriteAtAll(cp.file, 0, cp.staging[next].data(), cp.localBytes, MEL::Datatype::UNSIGNED_CHAR);
+#else
+        MEL::FileWriteAtAllBegin(cp.file, 0, cp.staging[next].data(), cp.localBytes, MEL::Datatype::UNSIGNED_CHAR);
+#endif
+        cp.inFlight = true;
+        return true;
+    };
 
     /**
-     * \ingroup  Win
-     * Free a std::vector of RMA window handles
+     * \ingroup Checkpoint
+     * Read the last checkpoint in the file back into every registered array. Collective across the comm world
      *
-     * \param[in] wins			A std::vector of windows to free
+     * \param[in] cp				The checkpointer
      */
-    inline void WinFree(std::vector<Win> &wins) {
-        for (auto &w : wins) WinFree(w);
+    inline void CheckpointerRestore(Checkpointer &cp) {
+        Checkpointer_build(cp);
+        CheckpointerWait(cp);
+
+        char *staging = cp.staging[cp.current].data();
+        MEL::FileReadAtAll(cp.file, 0, staging, cp.localBytes, MEL::Datatype::UNSIGNED_CHAR);
+        for (const auto &array : cp.arrays) {
+            std::memcpy(array.ptr, staging, array.bytes);
+            staging += array.bytes;
+        }
     };
 
     /**
-     * \ingroup  Win
-     * Free a varadic set of RMA windows
+     * \ingroup Checkpoint
+     * Free a MEL::Checkpointer, waiting on the checkpoint in flight and closing the file. Collective across the comm world
      *
-     * \param[in] d0			The first window to free
-     * \param[in] d1			The second window to free
-     * \param[in] args			The remaining windows to free
+     * \param[in] cp				The checkpointer to free
      */
-    template<typename T0, typename T1, typename ...Args>
-    inline void WinFree(T0 &d0, T1 &d1, Args &&...args) {
-        WinFree(d0);
-        WinFree(d1, args...);
+    inline void CheckpointerFree(Checkpointer &cp) {
+        CheckpointerWait(cp);
+        MEL::FileClose(cp.file);
+        for (auto &array : cp.arrays) MEL::TypeFree(array.fileType);
+        MEL::TypeFree(cp.fileType);
+        cp.arrays.clear();
+        cp.staging[0].clear();
+        cp.staging[1].clear();
     };
 
     /// \cond HIDE
-    struct Mutex {
-        /// Members
-        unsigned char *val; 
-        bool locked;
-        int rank, size, root;
-        Comm        comm;
-        Win            win;
-    
-        Mutex() : val(nullptr), locked(false), rank(0), size(0), root(0),
-                      comm(MEL::Comm::COMM_NULL), win(MEL::Win::WIN_NULL) {};
+    struct ProgressEngine_state {
+        /// Attachments are queued under mutex, while the active set is only touched by the poller holding pollMutex
+        std::mutex mutex, pollMutex;
+        std::vector<Request> incoming;
+        std::vector<std::function<void()>> incomingCallbacks;
+        RequestSet active;
+        RequestSet_payload<std::function<void()>> activeCallbacks;
+        std::thread thread;
+        std::chrono::microseconds interval;
+        int outstanding;
+        bool done;
+
+        ProgressEngine_state() : interval(0), outstanding(0), done(false) {};
     };
     /// \endcond
 
     /**
-     * \ingroup Mutex
-     * Create a MEL::Mutex across a comm world
+     * \ingroup Progress
+     * A handle to a progress engine. Copies refer to the same engine
+     */
+    struct ProgressEngine {
+        ProgressEngine_state *state;
+
+        ProgressEngine() : state(nullptr) {};
+    };
+
+    /**
+     * \ingroup Progress
+     * Make progress on every request attached to an engine, running the callbacks of those that completed. Safe to call 
+     * from any thread, and intended as the hook for programs that progress communication from their own loops or 
+     * OpenMP tasks. Returns immediately if another thread is already polling the engine
      *
-     * \param[in] rank		The rank of the calling process
-     * \param[in] size		The size of the comm world
-     * \param[in] root		The rank of the process who will own the mutex
-     * \param[in] comm		The comm world to share the mutex across
+     * \see MPI_Testsome
+     *
+     * \param[in] engine	The engine to progress
+     * \return				Returns the number of requests that completed
      */
-    inline Mutex MutexCreate(const int rank, const int size, const int root, const Comm &comm) {
-        MEL::Barrier(comm);
-        Mutex mutex;
-        mutex.locked = false;
-        mutex.rank = rank;
-        mutex.size = size;
-        mutex.root = root;
-        mutex.comm = comm;
+    inline int ProgressPoll(ProgressEngine &engine) {
+        ProgressEngine_state &state = *engine.state;
+        std::unique_lock<std::mutex> poll(state.pollMutex, std::try_to_lock);
+        if (!poll.owns_lock()) return 0;
 
-        if (rank == root) {
-            /// Allocate and expose
-            mutex.val = MEL::MemAlloc<unsigned char>(size);
-            memset(mutex.val, 0, size);
-            mutex.win = MEL::WinCreate(mutex.val, size, comm);
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (int i = 0; i < (int) state.incoming.size(); ++i) {
+                RequestSetAdd(state.active, state.incoming[i], state.activeCallbacks.add(std::move(state.incomingCallbacks[i])));
+            }
+            state.incoming.clear();
+            state.incomingCallbacks.clear();
         }
-        else {
-            /// Indecent exposure
-            mutex.val = nullptr;
-            mutex.win = MEL::WinCreate(mutex.val, 0, comm);
+
+        const int onum = RequestSetTestsome(state.active);
+        if (onum == 0) return 0;
+
+        for (int i = 0; i < onum; ++i) {
+            const std::function<void()> func = state.activeCallbacks.take(state.active.completed[i]);
+            if (func) func();
         }
 
-        return mutex;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.outstanding -= onum;
+        return onum;
+    };
+
+    /// \cond HIDE
+    inline void ProgressEngine_loop(ProgressEngine engine) {
+        ProgressEngine_state &state = *engine.state;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (state.done) return;
+            }
+            if (ProgressPoll(engine) == 0) {
+                if (state.interval.count() > 0) std::this_thread::sleep_for(state.interval);
+                else                            std::this_thread::yield();
+            }
+        }
     };
+    /// \endcond
 
     /**
-     * \ingroup Mutex
-     * Create a MEL::Mutex across a comm world
+     * \ingroup Progress
+     * Create a progress engine. With a dedicated thread, attached requests progress while the caller computes, which 
+     * requires MPI to provide ThreadLevel::MULTIPLE. Without a thread, requests progress whenever ProgressPoll is called
      *
-     * \param[in] root		The rank of the process who will own the mutex
-     * \param[in] comm		The comm world to share the mutex across
+     * \param[in] thread		Whether to progress requests from a dedicated thread
+     * \param[in] intervalUS	Microseconds the thread sleeps after a poll that completed nothing. Zero yields instead
+     * \return					Returns the engine
      */
-    inline Mutex MutexCreate(const int root, const Comm &comm) {
-        return MutexCreate(CommRank(comm), CommSize(comm), root, comm);
+    inline ProgressEngine ProgressEngineCreate(const bool thread = true, const int intervalUS = 20) {
+        if (thread && MEL::QueryThread() != MEL::ThreadLevel::MULTIPLE) {
+            MEL::Abort(-1, "MEL::ProgressEngineCreate A progress thread requires MPI to be initialized with ThreadLevel::MULTIPLE!");
+        }
+
+        ProgressEngine engine;
+        engine.state = new ProgressEngine_state();
+        engine.state->interval = std::chrono::microseconds(intervalUS);
+        if (thread) engine.state->thread = std::thread(ProgressEngine_loop, engine);
+        return engine;
     };
 
     /**
-     * \ingroup Mutex
-     * Free a MEL::Mutex
+     * \ingroup Progress
+     * Attach a request to a progress engine, running a callback once it completes. The engine takes ownership of the 
+     * request and rq is set to REQUEST_NULL. Callbacks run on whichever thread completes the request, and may attach 
+     * further requests. A request that is already REQUEST_NULL runs its callback immediately on the calling thread. A 
+     * persistent request is detached once it completes but is not freed, so keep a copy of its handle to restart or free it
      *
-     * \param[in] mutex		The mutex to free
+     * \param[in] engine	The engine to attach to
+     * \param[in,out] rq	The request to attach
+     * \param[in] func		The function to call when the request completes
      */
-    inline void MutexFree(Mutex &mutex) {
-        MEL::Barrier(mutex.comm);
-        MEL::WinFree(mutex.win);
-        MEL::MemFree(mutex.val);
+    inline void ProgressAttach(ProgressEngine &engine, Request &rq, const std::function<void()> &func) {
+        if ((MPI_Request) rq == MPI_REQUEST_NULL) {
+            if (func) func();
+            return;
+        }
+
+        ProgressEngine_state &state = *engine.state;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.incoming.push_back(rq);
+        state.incomingCallbacks.push_back(func);
+        ++state.outstanding;
+        rq = MPI_REQUEST_NULL;
     };
 
     /**
-     * \ingroup Mutex
-     * Get the exclusive lock on a MEL::Mutex
+     * \ingroup Progress
+     * Attach a request to a progress engine. The engine takes ownership of the request and rq is set to REQUEST_NULL
      *
-     * \param[in] mutex		The mutex to lock
+     * \param[in] engine	The engine to attach to
+     * \param[in,out] rq	The request to attach
+     * \return				Returns a std::future that becomes ready once the request completes
      */
-    inline void MutexLock(Mutex &mutex) {
-        if (mutex.locked) return;
-
-        unsigned char *waitlist = MEL::MemAlloc<unsigned char>(mutex.size);
-
-        /// Declare our intent to lock and sync waitlist
-        unsigned char lock = 1;
-        MEL::WinLockExclusive(mutex.win, mutex.root);
-        MEL::Put(&lock,       1,           MEL::Datatype::UNSIGNED_CHAR, mutex.rank, 1,             MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
-        MEL::Get(waitlist, mutex.size, MEL::Datatype::UNSIGNED_CHAR, 0,             mutex.size, MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
-        MEL::WinUnlock(mutex.win, mutex.root);
-
-        /// Is there a conflict?
-        for (int i = 0; i < mutex.size; i++) {
-            if (i != mutex.rank && waitlist[i] != 0) {
-                /// If at least one conflict exists wait for a message to say everything is groovy
-                MEL::Recv(&lock, 0, MEL::Datatype::UNSIGNED_CHAR, MEL::ANY_SOURCE, 99, mutex.comm);
-                break;
-            }
-        }
-
-        /// Clean up for if we got the lock without conflict
-        MEL::MemFree(waitlist);
+    inline std::future<void> ProgressAttach(ProgressEngine &engine, Request &rq) {
+        auto promise = std::make_shared<std::promise<void>>();
+        ProgressAttach(engine, rq, [promise]() {
+            promise->set_value();
+        });
+        return promise->get_future();
+    };
 
-        /// We have the lock
-        mutex.locked = true;
+    /**
+     * \ingroup Progress
+     * Get the number of attached requests that have not yet completed
+     *
+     * \param[in] engine	The engine to query
+     * \return				Returns the number of outstanding requests
+     */
+    inline int ProgressOutstanding(ProgressEngine &engine) {
+        std::lock_guard<std::mutex> lock(engine.state->mutex);
+        return engine.state->outstanding;
     };
 
     /**
-     * \ingroup Mutex
-     * Test if the mutex is currently locked
+     * \ingroup Progress
+     * Block until every request attached to an engine, including any attached by callbacks, has completed
      *
-     * \param[in] mutex		The mutex to lock
+     * \param[in] engine	The engine to wait on
      */
-    inline bool MutexTest(const Mutex &mutex) {
-        return mutex.locked;
+    inline void ProgressWait(ProgressEngine &engine) {
+        while (ProgressOutstanding(engine) > 0) {
+            if (ProgressPoll(engine) == 0) std::this_thread::yield();
+        }
     };
 
     /**
-     * \ingroup Mutex
-     * Release the exclusive lock on a MEL::Mutex
+     * \ingroup Progress
+     * Free a progress engine, waiting on every attached request and stopping its thread
      *
-     * \param[in] mutex		The mutex to lock
+     * \param[in] engine	The engine to free
      */
-    inline void MutexUnlock(Mutex &mutex) {
-        if (!mutex.locked) return;
+    inline void ProgressEngineFree(ProgressEngine &engine) {
+        if (engine.state == nullptr) return;
+        ProgressWait(engine);
+        {
+            std::lock_guard<std::mutex> lock(engine.state->mutex);
+            engine.state->done = true;
+        }
+        if (engine.state->thread.joinable()) engine.state->thread.join();
+        delete engine.state;
+        engine.state = nullptr;
+    };
 
-        unsigned char *waitlist = MEL::MemAlloc<unsigned char>(mutex.size);
-        mutex.locked = 0;
+    template<typename T>
+    struct Future;
 
-        /// Declare we are done and sync waitlist
-        unsigned char lock = 0;
-        MEL::WinLockExclusive(mutex.win, mutex.root);
-        MEL::Put(&lock,       1,           MEL::Datatype::UNSIGNED_CHAR, mutex.rank, 1,             MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
-        MEL::Get(waitlist, mutex.size, MEL::Datatype::UNSIGNED_CHAR, 0,             mutex.size, MEL::Datatype::UNSIGNED_CHAR, mutex.root, mutex.win);
-        MEL::WinUnlock(mutex.win, mutex.root);
+    /// \cond HIDE
+    struct Future_state {
+        Request rq;
+        bool ready;
+        std::vector<std::function<void()>> continuations;
 
-        /// Starting at a random process, scan for a intent to lock 
-        const int r = rand() % mutex.size;
-        for (int k = 0; k < mutex.size; k++) {
-            const int i = (mutex.rank + k + r) % mutex.size;
-            if (i != mutex.rank && waitlist[i] == 1) {
-                /// If a process is waiting for the lock, send them a message
-                MEL::Send(&lock, 0, MEL::Datatype::UNSIGNED_CHAR, i, 99, mutex.comm);
-                break;
-            }
+        Future_state() : ready(false) {};
+
+        inline void complete() {
+            ready = true;
+            /// Continuations may add more continuations to other states, so run from a local copy
+            std::vector<std::function<void()>> funcs;
+            funcs.swap(continuations);
+            for (auto &func : funcs) func();
+        };
+
+        inline void onReady(const std::function<void()> &func) {
+            if (ready) func();
+            else       continuations.push_back(func);
+        };
+    };
+
+    template<typename T>
+    struct Future_value : public Future_state {
+        T value;
+    };
+
+    template<>
+    struct Future_value<void> : public Future_state {};
+
+    /// Futures are progressed per thread, so each thread keeps its own set of pending requests
+    struct Future_registry {
+        RequestSet requests;
+        RequestSet_payload<std::shared_ptr<Future_state>> states;
+    };
+
+    inline Future_registry& Future_getRegistry() {
+        static thread_local Future_registry registry;
+        return registry;
+    };
+
+    inline void Future_register(const std::shared_ptr<Future_state> &state) {
+        if ((MPI_Request) state->rq == MPI_REQUEST_NULL) {
+            state->complete();
+            return;
         }
+        Future_registry &registry = Future_getRegistry();
+        RequestSetAdd(registry.requests, state->rq, registry.states.add(std::shared_ptr<Future_state>(state)));
+    };
+    /// \endcond
 
-        /// Clean up for if no one else wanted the lock
-        MEL::MemFree(waitlist);
+    /**
+     * \ingroup Future
+     * Test every pending future created on this thread, completing those whose requests have finished and running their 
+     * continuations
+     *
+     * \see MPI_Testsome
+     *
+     * \return				Returns the number of requests that completed
+     */
+    inline int FuturePoll() {
+        Future_registry &registry = Future_getRegistry();
+        const int onum = RequestSetTestsome(registry.requests);
+        if (onum == 0) return 0;
+
+        /// Take the completed states before running continuations, as they may register new futures or poll again
+        std::vector<std::shared_ptr<Future_state>> completed(onum);
+        for (int i = 0; i < onum; ++i) completed[i] = registry.states.take(registry.requests.completed[i]);
+
+        for (auto &state : completed) state->complete();
+        return onum;
     };
 
     /// \cond HIDE
-    template<typename T>
-    struct Shared {
-        /// Members
-        Mutex mutex;
-        Win win;
-        Datatype typeData;
-        T *ptr;
-        int len;
+    template<typename T, typename F, bool = std::is_void<T>::value>
+    struct Future_result {
+        typedef decltype(std::declval<F&>()(std::declval<T&>())) type;
+    };
+    template<typename T, typename F>
+    struct Future_result<T, F, true> {
+        typedef decltype(std::declval<F&>()()) type;
+    };
+
+    /// Continuations returning a Future are flattened, so then() always yields a Future of the final value
+    template<typename R>
+    struct Future_unwrap {
+        typedef R type;
+        static constexpr int KIND = std::is_void<R>::value ? 0 : 1;
+    };
+    template<typename U>
+    struct Future_unwrap<Future<U>> {
+        typedef U type;
+        static constexpr int KIND = 2;
+    };
+
+    template<typename T, typename F>
+    inline typename Future_result<T, F>::type Future_invoke(F &func, Future_value<T> &state) {
+        return func(state.value);
+    };
+    template<typename F>
+    inline typename Future_result<void, F>::type Future_invoke(F &func, Future_value<void> &) {
+        return func();
+    };
+
+    template<typename U>
+    inline void Future_forward(Future_value<U> &dst, Future_value<U> &src) {
+        dst.value = std::move(src.value);
+    };
+    inline void Future_forward(Future_value<void> &, Future_value<void> &) {};
+
+    template<typename T, typename U, typename F>
+    inline void Future_chain(const std::shared_ptr<Future_value<T>> &parent, const std::shared_ptr<Future_value<U>> &child, F &func, std::integral_constant<int, 0>) {
+        Future_invoke(func, *parent);
+        child->complete();
+    };
+    template<typename T, typename U, typename F>
+    inline void Future_chain(const std::shared_ptr<Future_value<T>> &parent, const std::shared_ptr<Future_value<U>> &child, F &func, std::integral_constant<int, 1>) {
+        child->value = Future_invoke(func, *parent);
+        child->complete();
+    };
+    template<typename T, typename U, typename F>
+    inline void Future_chain(const std::shared_ptr<Future_value<T>> &parent, const std::shared_ptr<Future_value<U>> &child, F &func, std::integral_constant<int, 2>) {
+        Future<U> inner = Future_invoke(func, *parent);
+        std::shared_ptr<Future_value<U>> innerState = inner.state;
+        innerState->onReady([child, innerState]() {
+            Future_forward(*child, *innerState);
+            child->complete();
+        });
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Future
+     * A value produced by a non-blocking operation, such as a receive buffer. Futures are progressed by FuturePoll, 
+     * which test, wait and get call on the thread that created them. Copies refer to the same value
+     */
+    template<typename T>
+    struct Future {
+        std::shared_ptr<Future_value<T>> state;
 
-        Shared() : ptr(nullptr), len(0), mutex(), win(MEL::Win::WIN_NULL), typeData(MEL::Datatype::DATATYPE_NULL) {};
-        
-        inline bool is_locked() const {
-            return MEL::MutexTest(mutex);
+        Future() {};
+        explicit Future(const std::shared_ptr<Future_value<T>> &_state) : state(_state) {};
+
+        /**
+         * Test if the future is ready, progressing pending futures if not
+         *
+         * \return			Returns true if the value is available
+         */
+        inline bool test() {
+            if (!state->ready) FuturePoll();
+            return state->ready;
         };
 
-        inline T& operator[](const int i) {
-            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator[] We do not have the lock!");
-            return ptr[i];
+        /**
+         * Block until the future is ready, progressing pending futures
+         */
+        inline void wait() {
+            while (!state->ready) FuturePoll();
         };
 
-        inline T* operator->() {
-            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator-> We do not have the lock!");
-            return ptr;
+        /**
+         * Block until the future is ready and get its value
+         *
+         * \return			Returns a reference to the value, owned by the future
+         */
+        template<typename U = T>
+        inline typename std::enable_if<!std::is_void<U>::value, U&>::type get() {
+            wait();
+            return state->value;
         };
 
-        inline operator T*() {
-            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator (T*) We do not have the lock!");
-            return ptr;
+        /**
+         * Block until the future is ready
+         */
+        template<typename U = T>
+        inline typename std::enable_if<std::is_void<U>::value>::type get() {
+            wait();
         };
 
-        inline T& operator*() {
-            if (!is_locked()) MEL::Abort(-1, "RMA::Shared<T>::operator* We do not have the lock!");
-            return *ptr;
+        /**
+         * Attach a continuation to run once this future is ready. The continuation takes a reference to the value, or 
+         * nothing for Future<void>, and may return nothing, a value, or another Future to wait on, such as a send started 
+         * from a received buffer
+         *
+         * \param[in] func	The continuation
+         * \return			Returns a future for the result of the continuation
+         */
+        template<typename F>
+        inline Future<typename Future_unwrap<typename Future_result<T, F>::type>::type> then(F func) {
+            typedef typename Future_result<T, F>::type R;
+            typedef typename Future_unwrap<R>::type U;
+
+            auto parent = state;
+            auto child  = std::make_shared<Future_value<U>>();
+            parent->onReady([parent, child, func]() mutable {
+                Future_chain(parent, child, func, std::integral_constant<int, Future_unwrap<R>::KIND>());
+            });
+            return Future<U>(child);
         };
     };
-    /// \endcond
 
     /**
-     * \ingroup Shared
-     * Create a MEL::Shared array across a comm world
+     * \ingroup Future
+     * Create a future completed by a request. The future takes ownership of the request and rq is set to REQUEST_NULL
      *
-     * \param[in] len		The number of elements to allocate
-     * \param[in] rank		The rank of the calling process
-     * \param[in] size		The size of the comm world
-     * \param[in] root		The rank of the process who will own the shared array
-     * \param[in] comm		The comm world to share the array across
+     * \param[in,out] rq	The request to attach
+     * \return				Returns the future
      */
-    template<typename T>
-    inline Shared<T> SharedCreate(const int len, const int rank, const int size, const int root, const Comm &comm) {
-        MEL::Barrier(comm);
-        Shared<T> shared;
-        shared.len = len;
-        shared.mutex = MEL::MutexCreate(rank, size, root, comm);
-
-        shared.ptr = MEL::MemAlloc<T>(len);
-        memset(shared.ptr, 0, sizeof(T) * len);
-
-        if (rank == root) {
-            shared.win = MEL::WinCreate(shared.ptr, len, comm);
-        }
-        else {
-            shared.win = MEL::WinCreate(shared.ptr, 0, comm);
-        }
+    inline Future<void> FutureCreate(Request &rq) {
+        auto state = std::make_shared<Future_value<void>>();
+        state->rq = rq;
+        rq = MPI_REQUEST_NULL;
+        Future_register(state);
+        return Future<void>(state);
+    };
 
-        shared.typeData = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, sizeof(T));
-        return shared;
+    /**
+     * \ingroup Future
+     * Create a future holding a value, completed by a request reading or writing the value's storage. The future takes 
+     * ownership of the request and rq is set to REQUEST_NULL
+     *
+     * \warning The storage used by the request must not move when the value is moved, as with std::vector
+     *
+     * \param[in,out] rq	The request to attach
+     * \param[in] value		The value to hold, such as the buffer the request receives into
+     * \return				Returns the future
+     */
+    template<typename T>
+    inline Future<typename std::decay<T>::type> FutureCreate(Request &rq, T &&value) {
+        auto state = std::make_shared<Future_value<typename std::decay<T>::type>>();
+        state->value = std::forward<T>(value);
+        state->rq    = rq;
+        rq = MPI_REQUEST_NULL;
+        Future_register(state);
+        return Future<typename std::decay<T>::type>(state);
     };
 
     /**
-     * \ingroup Shared
-     * Create a MEL::Shared array across a comm world
+     * \ingroup Future
+     * Create a future that is already ready
      *
-     * \param[in] len		The number of elements to allocate
-     * \param[in] root		The rank of the process who will own the shared array
-     * \param[in] comm		The comm world to share the array across
+     * \param[in] value		The value to hold
+     * \return				Returns the future
      */
     template<typename T>
-    inline Shared<T> SharedCreate(const int len, const int root, const Comm &comm) {
-        return SharedCreate<T>(len, CommRank(comm), CommSize(comm), root, comm);
+    inline Future<typename std::decay<T>::type> FutureReady(T &&value) {
+        auto state = std::make_shared<Future_value<typename std::decay<T>::type>>();
+        state->value = std::forward<T>(value);
+        state->ready = true;
+        return Future<typename std::decay<T>::type>(state);
     };
 
     /**
-     * \ingroup Shared
-     * Free a MEL::Shared array
+     * \ingroup Future
+     * Non-Blocking. Receive num elements into a new buffer held by the returned future
      *
-     * \param[in] shared	The shared array to free
+     * \param[in] num		The number of elements to receive
+     * \param[in] src		The rank of the process to receive from
+     * \param[in] tag		A tag for the message
+     * \param[in] comm		The comm world to receive within
+     * \return				Returns a future for the received buffer
      */
     template<typename T>
-    inline void SharedFree(Shared<T> &shared) {
-        MEL::Barrier(shared.mutex.comm);
-        MEL::WinFree(shared.win);
-        MEL::MemFree(shared.ptr);
-        MEL::MutexFree(shared.mutex);
-        MEL::TypeFree(shared.typeData);
+    inline Future<std::vector<T>> FutureIrecv(const int num, const int src, const int tag, const Comm &comm) {
+        auto state = std::make_shared<Future_value<std::vector<T>>>();
+        state->value.resize(num);
+        MEL::Irecv(state->value.data(), num, src, tag, comm, state->rq);
+        Future_register(state);
+        return Future<std::vector<T>>(state);
     };
 
     /**
-     * \ingroup Shared
-     * Test if the shared array is currently locked
+     * \ingroup Future
+     * Non-Blocking. Send a buffer, which the returned future holds until the send completes
      *
-     * \param[in] shared	The shared array to test
+     * \param[in] buffer	The buffer to send
+     * \param[in] dst		The rank of the process to send to
+     * \param[in] tag		A tag for the message
+     * \param[in] comm		The comm world to send within
+     * \return				Returns a future handing the buffer back once it can be reused
      */
     template<typename T>
-    inline bool SharedTest(const Shared<T> &shared) {
-        return shared.is_locked();
+    inline Future<std::vector<T>> FutureIsend(std::vector<T> buffer, const int dst, const int tag, const Comm &comm) {
+        auto state = std::make_shared<Future_value<std::vector<T>>>();
+        state->value = std::move(buffer);
+        MEL::Isend(state->value.data(), (int) state->value.size(), dst, tag, comm, state->rq);
+        Future_register(state);
+        return Future<std::vector<T>>(state);
+    };
+
+#ifdef MEL_3
+    /// \cond HIDE
+    /// The state of a future for a collective that reads from a separate send buffer, held until the state is released
+    template<typename T>
+    struct Future_sendValue : public Future_value<T> {
+        T send;
     };
+    /// \endcond
 
     /**
-     * \ingroup Shared
-     * Get the lock on the shared array without synchronizing the data. Useful for if you only intend to write to the array
+     * \ingroup Future
+     * Non-Blocking. Broadcast a buffer to all processes in comm, where all processes provide a buffer of the expected size
      *
-     * \param[in] shared	The shared array to lock
+     * \param[in] buffer	The buffer to broadcast from, or receive into
+     * \param[in] root		The rank of the process to send from
+     * \param[in] comm		The comm world to broadcast within
+     * \return				Returns a future for the broadcast buffer
      */
     template<typename T>
-    inline void SharedLock_noget(Shared<T> &shared) {
-        SharedLock_noget(shared, 0, shared.len - 1);
+    inline Future<std::vector<T>> FutureIbcast(std::vector<T> buffer, const int root, const Comm &comm) {
+        auto state = std::make_shared<Future_value<std::vector<T>>>();
+        state->value = std::move(buffer);
+        MEL::Ibcast(state->value.data(), (int) state->value.size(), root, comm, state->rq);
+        Future_register(state);
+        return Future<std::vector<T>>(state);
     };
-    
+
     /**
-     * \ingroup Shared
-     * Get the lock on the shared array without synchronizing the data. Useful for if you only intend to write to the array
+     * \ingroup Future
+     * Non-Blocking. Reduce a buffer across all processes in comm, storing the result on all processes
      *
-     * \param[in] shared	The shared array to lock
-     * \param[in] start		The start index to lock
-     * \param[in] end		The end index to lock
+     * \param[in] buffer	The buffer to reduce
+     * \param[in] op		The operation to perform for the reduction
+     * \param[in] comm		The comm world to reduce within
+     * \return				Returns a future for the reduced buffer
      */
     template<typename T>
-    inline void SharedLock_noget(Shared<T> &shared, const int start, const int end) {
-        MEL::MutexLock(shared.mutex); // , start, end
+    inline Future<std::vector<T>> FutureIallreduce(const std::vector<T> &buffer, const Op &op, const Comm &comm) {
+        auto state = std::make_shared<Future_sendValue<std::vector<T>>>();
+        state->send = buffer;
+        state->value.resize(buffer.size());
+        MEL::Iallreduce(state->send.data(), state->value.data(), (int) buffer.size(), op, comm, state->rq);
+        Future_register(state);
+        return Future<std::vector<T>>(state);
     };
+#endif
 
     /**
-     * \ingroup Shared
-     * Get the lock on the shared array and synchronize the data
+     * \ingroup Future
+     * Create a future that becomes ready once every future in the set is ready
      *
-     * \param[in] shared	The shared array to lock
+     * \param[in] futures	The futures to wait on
+     * \return				Returns the combined future
      */
     template<typename T>
-    inline void SharedLock(Shared<T> &shared) {
-        SharedLock(shared, 0, shared.len - 1);
+    inline Future<void> WhenAll(const std::vector<Future<T>> &futures) {
+        auto state     = std::make_shared<Future_value<void>>();
+        auto remaining = std::make_shared<int>(futures.size());
+        if (futures.empty()) state->complete();
+        for (const auto &future : futures) {
+            future.state->onReady([state, remaining]() {
+                if (--(*remaining) == 0) state->complete();
+            });
+        }
+        return Future<void>(state);
     };
 
     /**
-     * \ingroup Shared
-     * Get the lock on the shared array and synchronize the data
+     * \ingroup Future
+     * Create a future that becomes ready once any future in the set is ready. An empty set is ready immediately
      *
-     * \param[in] shared	The shared array to lock
-     * \param[in] start		The start index to lock
-     * \param[in] end		The end index to lock
+     * \param[in] futures	The futures to wait on
+     * \return				Returns a future for the index of the first future to become ready, or -1 if the set is empty
      */
     template<typename T>
-    inline void SharedLock(Shared<T> &shared, const int start, const int end) {
-        SharedLock_noget(shared, start, end);
+    inline Future<int> WhenAny(const std::vector<Future<T>> &futures) {
+        auto state = std::make_shared<Future_value<int>>();
+        if (futures.empty()) {
+            state->value = -1;
+            state->complete();
+        }
+        for (int i = 0; i < (int) futures.size(); ++i) {
+            futures[i].state->onReady([state, i]() {
+                if (state->ready) return;
+                state->value = i;
+                state->complete();
+            });
+        }
+        return Future<int>(state);
+    };
 
-        if (shared.mutex.rank != shared.mutex.root) {
-            const int num = (end - start) + 1;
-            MEL::WinLockExclusive(shared.win, shared.mutex.root);
-            MEL::Get(shared.ptr + (start), num, shared.typeData, start, num, shared.typeData, shared.mutex.root, shared.win);
-            MEL::WinUnlock(shared.win, shared.mutex.root);
+
+#ifdef MEL_PROFILE
+    /// \cond HIDE
+    struct Profile_summary {
+        long long calls, bytes;
+        double timeMin, timeMax, timeSum;
+        long long hist[PROFILE_BINS];
+    };
+    /// \endcond
+
+    /**
+     * \ingroup Profile
+     * Discard everything recorded so far on this process
+     */
+    inline void ProfileReset() {
+        Profile_state &state = Profile_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.entries.clear();
+    };
+
+    /**
+     * \ingroup Profile
+     * Gather the profile of every process to rank 0 of comm, print a summary of the call count, bytes and min / avg / max 
+     * time across processes of every wrapped function, and write the same as CSV including message size histograms. 
+     * Collective across the comm world. Called on MPI_COMM_WORLD by Finalize when MEL_PROFILE is defined
+     *
+     * \param[in] comm		The comm world to gather the profile within
+     * \param[in] path		The path of the CSV file written by rank 0
+     */
+    inline void ProfileReport(const Comm &comm, const std::string &path) {
+        Profile_state &state = Profile_getState();
+
+        /// Serialize the local profile merged by name, as the same literal may have different addresses in different translation units
+        std::vector<char> local;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.enabled = false;
+
+            std::map<std::string, Profile_entry> merged;
+            for (const auto &e : state.entries) {
+                Profile_entry &m = merged[e.first];
+                m.calls += e.second.calls;
+                m.bytes += e.second.bytes;
+                m.time  += e.second.time;
+                for (int i = 0; i < PROFILE_BINS; ++i) m.hist[i] += e.second.hist[i];
+            }
+
+            for (const auto &m : merged) {
+                const int len = m.first.size();
+                const char *bytes[] = { (const char*) &len, m.first.c_str(), (const char*) &m.second };
+                const size_t sizes[] = { sizeof(int), (size_t) len, sizeof(Profile_entry) };
+                for (int i = 0; i < 3; ++i) local.insert(local.end(), bytes[i], bytes[i] + sizes[i]);
+            }
+        }
+
+        const int rank = MEL::CommRank(comm), size = MEL::CommSize(comm);
+        int localSize = local.size();
+        std::vector<int> sizes(size), displs(size, 0);
+        MEL::Gather(&localSize, 1, &sizes[0], 1, 0, comm);
+
+        std::vector<char> global;
+        if (rank == 0) {
+            for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + sizes[i - 1];
+            global.resize(displs[size - 1] + sizes[size - 1] + 1);
+        }
+        local.push_back(0);
+        MEL::Gatherv(&local[0], localSize, global.data(), &sizes[0], &displs[0], 0, comm);
+
+        if (rank == 0) {
+            /// Functions a process never called count as zero time towards the min and average
+            std::map<std::string, Profile_summary> summary;
+            std::map<std::string, int> seenBy;
+            for (int r = 0; r < size; ++r) {
+                const char *ptr = &global[displs[r]], *end = ptr + sizes[r];
+                while (ptr < end) {
+                    int len;
+                    std::memcpy(&len, ptr, sizeof(int));                 ptr += sizeof(int);
+                    const std::string name(ptr, len);                     ptr += len;
+                    Profile_entry e;
+                    std::memcpy((void*) &e, ptr, sizeof(Profile_entry)); ptr += sizeof(Profile_entry);
+
+                    auto it = summary.find(name);
+                    if (it == summary.end()) {
+                        Profile_summary s{};
+                        s.timeMin = e.time;
+                        s.timeMax = e.time;
+                        it = summary.insert(std::make_pair(name, s)).first;
+                    }
+                    Profile_summary &s = it->second;
+                    s.calls   += e.calls;
+                    s.bytes   += e.bytes;
+                    s.timeSum += e.time;
+                    s.timeMin  = std::min(s.timeMin, e.time);
+                    s.timeMax  = std::max(s.timeMax, e.time);
+                    for (int i = 0; i < PROFILE_BINS; ++i) s.hist[i] += e.hist[i];
+                    ++seenBy[name];
+                }
+            }
+            for (auto &s : summary) {
+                if (seenBy[s.first] < size) s.second.timeMin = 0.0;
+            }
+
+            std::vector<std::pair<std::string, Profile_summary>> order(summary.begin(), summary.end());
+            std::sort(order.begin(), order.end(), [](const std::pair<std::string, Profile_summary> &a, const std::pair<std::string, Profile_summary> &b) {
+                return a.second.timeMax > b.second.timeMax;
+            });
+
+            std::printf("\n*** MEL::PROFILE *** %d processes\n%-48s %12s %16s %12s %12s %12s\n", size, "Function", "Calls", "Bytes", "Min (s)", "Avg (s)", "Max (s)");
+            for (const auto &s : order) {
+                std::printf("%-48s %12lld %16lld %12.6f %12.6f %12.6f\n", s.first.c_str(), s.second.calls, s.second.bytes, 
+                            s.second.timeMin, s.second.timeSum / size, s.second.timeMax);
+            }
+            std::fflush(stdout);
+
+            std::FILE *file = std::fopen(path.c_str(), "w");
+            if (file != nullptr) {
+                std::fprintf(file, "function,processes,calls,bytes,time_min,time_avg,time_max");
+                for (int i = 0; i < PROFILE_BINS; ++i) std::fprintf(file, ",hist_%d", i);
+                std::fprintf(file, "\n");
+                for (const auto &s : order) {
+                    std::fprintf(file, "\"%s\",%d,%lld,%lld,%.9f,%.9f,%.9f", s.first.c_str(), seenBy[s.first], s.second.calls, s.second.bytes, 
+                                 s.second.timeMin, s.second.timeSum / size, s.second.timeMax);
+                    for (int i = 0; i < PROFILE_BINS; ++i) std::fprintf(file, ",%lld", s.second.hist[i]);
+                    std::fprintf(file, "\n");
+                }
+                std::fclose(file);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.enabled = true;
+    };
+
+    /// \cond HIDE
+    inline void Profile_finalize() {
+        ProfileReport(MEL::Comm::WORLD, MEL_PROFILE_FILE);
+    };
+    /// \endcond
+#endif
+
+#ifdef MEL_TRACE
+    /// \cond HIDE
+    struct Trace_packed {
+        int name, tid;
+        double start, end;
+        long long bytes;
+    };
+
+    inline std::vector<char> Trace_gatherv(std::vector<char> &local, std::vector<int> &sizes, std::vector<int> &displs, const int rank, const int size, const Comm &comm) {
+        int localSize = local.size();
+        sizes.assign(size, 0);
+        displs.assign(size, 0);
+        MEL::Gather(&localSize, 1, &sizes[0], 1, 0, comm);
+
+        std::vector<char> global;
+        if (rank == 0) {
+            for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + sizes[i - 1];
+            global.resize(displs[size - 1] + sizes[size - 1] + 1);
+        }
+        local.push_back(0);
+        MEL::Gatherv(&local[0], localSize, global.data(), &sizes[0], &displs[0], 0, comm);
+        local.pop_back();
+        return global;
+    };
+
+    inline void Trace_escape(std::FILE *file, const char *str) {
+        for (; *str != 0; ++str) {
+            if (*str == '"' || *str == '\\') std::fputc('\\', file);
+            std::fputc(*str, file);
         }
     };
+    /// \endcond
 
     /**
-     * \ingroup Shared
-     * Release the lock on the shared array without synchronizing the data. Useful for if you only read from the array
-     * 
-     * \param[in] shared	The shared array to unlock
+     * \ingroup Trace
+     * Discard every event recorded so far on this process
      */
-    template<typename T>
-    inline void SharedUnlock_noput(Shared<T> &shared) {
-        SharedUnlock_noput(shared, 0, shared.len - 1);
+    inline void TraceReset() {
+        Trace_state &state = Trace_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.ring.clear();
+        state.head     = 0;
+        state.recorded = 0;
+        state.epochs.clear();
     };
-    
+
     /**
-     * \ingroup Shared
-     * Release the lock on the shared array without synchronizing the data. Useful for if you only read from the array
-     * 
-     * \param[in] shared	The shared array to unlock
-     * \param[in] start		The start index to unlock
-     * \param[in] end		The end index to unlock
+     * \ingroup Trace
+     * Merge the event ring of every process to rank 0 of comm and write it as Chrome trace JSON, viewable in 
+     * chrome://tracing or Perfetto. Each rank is a process and each thread that made calls is a thread. Clocks are 
+     * aligned on leaving a barrier, so skew between ranks is bounded by the barrier latency. 
+     * Collective across the comm world. Called on MPI_COMM_WORLD by Finalize when MEL_TRACE is defined
+     *
+     * \param[in] comm		The comm world to merge the trace within
+     * \param[in] path		The path of the JSON file written by rank 0
      */
-    template<typename T>
-    inline void SharedUnlock_noput(Shared<T> &shared, const int start, const int end) {
-        MEL::MutexUnlock(shared.mutex); // , start, end
+    inline void TraceReport(const Comm &comm, const std::string &path) {
+        Trace_state &state = Trace_getState();
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.enabled = false;
+        }
+
+        MEL::Barrier(comm);
+        const double zero = Profile_now();
+
+        /// Serialize the name table and the events oldest first, names are interned by literal address
+        std::vector<char> localNames, localEvents;
+        double earliest = 0.0;
+        long long dropped;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            dropped = state.recorded - (long long) state.ring.size();
+
+            std::map<const char*, int> ids;
+            const size_t num = state.ring.size(), first = (num < (size_t) MEL_TRACE_EVENTS) ? 0 : state.head;
+            for (size_t i = 0; i < num; ++i) {
+                const Trace_event &e = state.ring[(first + i) % num];
+                auto it = ids.find(e.name);
+                if (it == ids.end()) {
+                    it = ids.insert(std::make_pair(e.name, (int) ids.size())).first;
+                    localNames.insert(localNames.end(), e.name, e.name + std::strlen(e.name) + 1);
+                }
+
+                const Trace_packed p = { it->second, e.tid, e.start - zero, e.end - zero, e.bytes };
+                earliest = std::min(earliest, p.start);
+                const char *bytes = (const char*) &p;
+                localEvents.insert(localEvents.end(), bytes, bytes + sizeof(Trace_packed));
+            }
+        }
+
+        const int rank = MEL::CommRank(comm), size = MEL::CommSize(comm);
+        double base = 0.0;
+        MEL::Allreduce(&earliest, &base, 1, MEL::Datatype::DOUBLE, MEL::Op::MIN, comm);
+        
+        std::vector<long long> droppedBy(size);
+        MEL::Gather(&dropped, 1, MEL::Datatype::LONG_LONG, &droppedBy[0], 1, MEL::Datatype::LONG_LONG, 0, comm);
+
+        std::vector<int> nameSizes, nameDispls, eventSizes, eventDispls;
+        const std::vector<char> globalNames  = Trace_gatherv(localNames,  nameSizes,  nameDispls,  rank, size, comm),
+                                globalEvents = Trace_gatherv(localEvents, eventSizes, eventDispls, rank, size, comm);
+
+        if (rank == 0) {
+            std::FILE *file = std::fopen(path.c_str(), "w");
+            if (file != nullptr) {
+                long long totalDropped = 0;
+                std::fprintf(file, "{\"traceEvents\":[\n");
+                bool comma = false;
+                for (int r = 0; r < size; ++r) {
+                    std::fprintf(file, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Rank %d\"}}", comma ? ",\n" : "", r, r);
+                    std::fprintf(file, ",\n{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"sort_index\":%d}}", r, r);
+                    comma = true;
+                    totalDropped += droppedBy[r];
+
+                    std::vector<const char*> names;
+                    for (const char *ptr = &globalNames[nameDispls[r]], *end = ptr + nameSizes[r]; ptr < end; ptr += std::strlen(ptr) + 1) {
+                        names.push_back(ptr);
+                    }
+
+                    for (const char *ptr = &globalEvents[eventDispls[r]], *end = ptr + eventSizes[r]; ptr < end; ptr += sizeof(Trace_packed)) {
+                        Trace_packed p;
+                        std::memcpy((void*) &p, ptr, sizeof(Trace_packed));
+
+                        const char *name = names[p.name], *sep = std::strstr(name, "::");
+                        const std::string cat = (sep == nullptr) ? std::string("MPI") : std::string(name, sep);
+
+                        std::fprintf(file, ",\n{\"name\":\"");
+                        Trace_escape(file, name);
+                        std::fprintf(file, "\",\"cat\":\"");
+                        Trace_escape(file, cat.c_str());
+                        std::fprintf(file, "\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f", 
+                                     r, p.tid, (p.start - base) * 1e6, (p.end - p.start) * 1e6);
+                        if (p.bytes >= 0) std::fprintf(file, ",\"args\":{\"bytes\":%lld}", p.bytes);
+                        std::fprintf(file, "}");
+                    }
+                }
+                std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"processes\":%d,\"dropped\":%lld}}\n", size, totalDropped);
+                std::fclose(file);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.enabled = true;
+    };
+
+    /// \cond HIDE
+    inline void Trace_finalize() {
+        TraceReport(MEL::Comm::WORLD, MEL_TRACE_FILE);
+    };
+    /// \endcond
+#endif
+
+#ifdef MEL_COMM_MATRIX
+    /// \cond HIDE
+    struct Matrix_packed {
+        int src, dst;
+        long long bytes, messages;
+    };
+
+    struct Matrix_rank {
+        double compute, wait;
+        long long bytesSent, messagesSent, bytesReceived, messagesReceived;
     };
 
+    inline void Matrix_summary(const char *label, const std::vector<double> &values) {
+        const int size = values.size();
+        double sum = 0.0;
+        int imin = 0, imax = 0;
+        for (int i = 0; i < size; ++i) {
+            sum += values[i];
+            if (values[i] < values[imin]) imin = i;
+            if (values[i] > values[imax]) imax = i;
+        }
+        const double avg = sum / size;
+        std::printf("%-16s %16.6g %8d %16.6g %16.6g %8d %11.1f%%\n", label, values[imin], imin, avg, values[imax], imax, 
+                    (avg > 0.0) ? 100.0 * (values[imax] / avg - 1.0) : 0.0);
+    };
+
+    inline void Matrix_write(const std::string &path, const std::vector<long long> &matrix, const int size) {
+        std::FILE *file = std::fopen(path.c_str(), "w");
+        if (file == nullptr) return;
+        std::fprintf(file, "src\\dst");
+        for (int j = 0; j < size; ++j) std::fprintf(file, ",%d", j);
+        std::fprintf(file, "\n");
+        for (int i = 0; i < size; ++i) {
+            std::fprintf(file, "%d", i);
+            for (int j = 0; j < size; ++j) std::fprintf(file, ",%lld", matrix[(size_t) i * size + j]);
+            std::fprintf(file, "\n");
+        }
+        std::fclose(file);
+    };
+    /// \endcond
+
     /**
-     * \ingroup Shared
-     * Release the lock on the shared array and synchronize the data
-     * 
-     * \param[in] shared	The shared array to unlock
+     * \ingroup CommMatrix
+     * Discard the traffic and wait time recorded so far on this process, and restart its clock
      */
-    template<typename T>
-    inline void SharedUnlock(Shared<T> &shared) {
-        SharedUnlock(shared, 0, shared.len - 1);
+    inline void CommMatrixReset() {
+        Matrix_state &state = Matrix_getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.cells.clear();
+        state.start = Profile_now();
+        state.wait  = 0.0;
     };
 
     /**
-     * \ingroup Shared
-     * Release the lock on the shared array and synchronize the data
-     * 
-     * \param[in] shared	The shared array to unlock
-     * \param[in] start		The start index to unlock
-     * \param[in] end		The end index to unlock
+     * \ingroup CommMatrix
+     * Sum the point to point and RMA traffic of every process to rank 0 of comm, and write the bytes and message counts 
+     * sent from each MPI_COMM_WORLD rank (rows) to each other (columns) as CSV matrices. Per rank compute time, time waiting 
+     * inside MPI, and traffic totals are written as a third CSV, and a summary of the imbalance across ranks and the busiest 
+     * pairs is printed. Collective across the comm world. Called on MPI_COMM_WORLD by Finalize when MEL_COMM_MATRIX is defined
+     *
+     * \param[in] comm				The comm world to reduce the matrix within
+     * \param[in] bytesPath			The path of the bytes matrix CSV written by rank 0
+     * \param[in] messagesPath		The path of the message count matrix CSV written by rank 0
+     * \param[in] imbalancePath		The path of the per rank CSV written by rank 0
      */
-    template<typename T>
-    inline void SharedUnlock(Shared<T> &shared, const int start, const int end) {
-        if (shared.mutex.rank != shared.mutex.root) {
-            const int num = (end - start) + 1;
-            MEL::WinLockExclusive(shared.win, shared.mutex.root);
-            MEL::Put(shared.ptr + (start), num, shared.typeData, start, num, shared.typeData, shared.mutex.root, shared.win);
-            MEL::WinUnlock(shared.win, shared.mutex.root);
+    inline void CommMatrixReport(const Comm &comm, const std::string &bytesPath, const std::string &messagesPath, const std::string &imbalancePath) {
+        Matrix_state &state = Matrix_getState();
+
+        std::vector<char> local;
+        double times[2];
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.enabled = false;
+            times[1] = state.wait;
+            times[0] = std::max(0.0, Profile_now() - state.start - state.wait);
+
+            for (const auto &c : state.cells) {
+                const Matrix_packed p = { c.first.first, c.first.second, c.second.bytes, c.second.messages };
+                const char *bytes = (const char*) &p;
+                local.insert(local.end(), bytes, bytes + sizeof(Matrix_packed));
+            }
         }
 
-        SharedUnlock_noput(shared, start, end);
+        const int rank = MEL::CommRank(comm), size = MEL::CommSize(comm), worldSize = MEL::CommSize(MEL::Comm::WORLD);
+        std::vector<double> allTimes(2 * size);
+        MEL::Gather(times, 2, &allTimes[0], 2, 0, comm);
+
+        int localSize = local.size();
+        std::vector<int> sizes(size), displs(size, 0);
+        MEL::Gather(&localSize, 1, &sizes[0], 1, 0, comm);
+
+        std::vector<char> global;
+        if (rank == 0) {
+            for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + sizes[i - 1];
+            global.resize(displs[size - 1] + sizes[size - 1] + 1);
+        }
+        local.push_back(0);
+        MEL::Gatherv(&local[0], localSize, global.data(), &sizes[0], &displs[0], 0, comm);
+
+        if (rank == 0) {
+            /// Dense matrices over MPI_COMM_WORLD ranks. Only the origin records an RMA get, as traffic from the target to itself
+            std::vector<long long> bytes((size_t) worldSize * worldSize, 0), messages((size_t) worldSize * worldSize, 0);
+            std::vector<Matrix_rank> ranks(worldSize, Matrix_rank{ 0.0, 0.0, 0, 0, 0, 0 });
+            for (const char *ptr = &global[0], *end = ptr + displs[size - 1] + sizes[size - 1]; ptr < end; ptr += sizeof(Matrix_packed)) {
+                Matrix_packed p;
+                std::memcpy((void*) &p, ptr, sizeof(Matrix_packed));
+                const size_t idx = (size_t) p.src * worldSize + p.dst;
+                bytes[idx]    += p.bytes;
+                messages[idx] += p.messages;
+                ranks[p.src].bytesSent        += p.bytes;
+                ranks[p.src].messagesSent     += p.messages;
+                ranks[p.dst].bytesReceived    += p.bytes;
+                ranks[p.dst].messagesReceived += p.messages;
+            }
+
+            /// Times are indexed by rank in comm, traffic by rank in MPI_COMM_WORLD
+            std::vector<int> commRanks(size), worldRanks(size);
+            for (int i = 0; i < size; ++i) commRanks[i] = i;
+            {
+                MPI_Group group, world;
+                MPI_Comm_group((MPI_Comm) comm, &group);
+                MPI_Comm_group(MPI_COMM_WORLD, &world);
+                MPI_Group_translate_ranks(group, size, &commRanks[0], world, &worldRanks[0]);
+                MPI_Group_free(&group);
+                MPI_Group_free(&world);
+            }
+
+            std::vector<double> compute(size), wait(size), sent(size), received(size), messagesSent(size);
+            for (int i = 0; i < size; ++i) {
+                const Matrix_rank &r = ranks[worldRanks[i]];
+                compute[i]      = allTimes[2 * i];
+                wait[i]         = allTimes[2 * i + 1];
+                sent[i]         = (double) r.bytesSent;
+                received[i]     = (double) r.bytesReceived;
+                messagesSent[i] = (double) r.messagesSent;
+            }
+
+            std::printf("\n*** MEL::COMM MATRIX *** %d processes\n%-16s %16s %8s %16s %16s %8s %12s\n", size, "", "Min", "Rank", "Avg", "Max", "Rank", "Imbalance");
+            Matrix_summary("Compute (s)",    compute);
+            Matrix_summary("Wait (s)",       wait);
+            Matrix_summary("Bytes sent",     sent);
+            Matrix_summary("Bytes received", received);
+            Matrix_summary("Messages sent",  messagesSent);
+
+            std::vector<size_t> order;
+            for (size_t i = 0; i < bytes.size(); ++i) if (messages[i] > 0) order.push_back(i);
+            const size_t top = std::min<size_t>(10, order.size());
+            std::partial_sort(order.begin(), order.begin() + top, order.end(), [&bytes](const size_t a, const size_t b) {
+                return bytes[a] > bytes[b];
+            });
+            std::printf("Busiest pairs (MPI_COMM_WORLD ranks)\n%8s %8s %16s %12s\n", "Src", "Dst", "Bytes", "Messages");
+            for (size_t i = 0; i < top; ++i) {
+                std::printf("%8d %8d %16lld %12lld\n", (int) (order[i] / worldSize), (int) (order[i] % worldSize), bytes[order[i]], messages[order[i]]);
+            }
+            std::fflush(stdout);
+
+            Matrix_write(bytesPath,    bytes,    worldSize);
+            Matrix_write(messagesPath, messages, worldSize);
+
+            std::FILE *file = std::fopen(imbalancePath.c_str(), "w");
+            if (file != nullptr) {
+                std::fprintf(file, "rank,world_rank,compute,wait,wait_fraction,bytes_sent,messages_sent,bytes_received,messages_received\n");
+                for (int i = 0; i < size; ++i) {
+                    const Matrix_rank &r = ranks[worldRanks[i]];
+                    const double total = compute[i] + wait[i];
+                    std::fprintf(file, "%d,%d,%.9f,%.9f,%.6f,%lld,%lld,%lld,%lld\n", i, worldRanks[i], compute[i], wait[i], 
+                                 (total > 0.0) ? wait[i] / total : 0.0, r.bytesSent, r.messagesSent, r.bytesReceived, r.messagesReceived);
+                }
+                std::fclose(file);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.enabled = true;
+    };
+
+    /// \cond HIDE
+    inline void Matrix_finalize() {
+        CommMatrixReport(MEL::Comm::WORLD, MEL_COMM_MATRIX_FILE, MEL_COMM_MESSAGES_FILE, MEL_COMM_IMBALANCE_FILE);
     };
+    /// \endcond
+#endif
 
 };
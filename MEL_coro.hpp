@@ -0,0 +1,291 @@
+/*
+The MIT License(MIT)
+
+Copyright(c) 2016 Joss Whittle
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include "MEL.hpp"
+
+/// Coroutines need C++20 compiler support, without it this header provides nothing
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define MEL_CORO
+#endif
+#endif
+
+#ifdef MEL_CORO
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+
+/**
+* \file MEL_coro.hpp
+*/
+
+namespace MEL {
+    namespace Coro {
+
+        /**
+         * \defgroup Coro Coroutines
+         * C++20 coroutines awaiting non-blocking requests, resumed by a single threaded scheduler
+         */
+
+        struct Scheduler;
+
+        /// \cond HIDE
+        inline Scheduler*& Scheduler_current() {
+            static thread_local Scheduler *current = nullptr;
+            return current;
+        };
+        /// \endcond
+
+        /**
+         * \ingroup Coro
+         * A coroutine run by a Scheduler. A Task may also co_await another Task, resuming once it finishes
+         */
+        struct Task {
+            struct promise_type {
+                std::coroutine_handle<> continuation;
+                std::exception_ptr exception;
+
+                inline Task get_return_object() {
+                    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+                };
+                inline std::suspend_always initial_suspend() noexcept {
+                    return {};
+                };
+
+                struct FinalAwaiter {
+                    inline bool await_ready() noexcept {
+                        return false;
+                    };
+                    /// Resume the awaiting Task if there is one, otherwise hand control back to the scheduler
+                    inline std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                        auto continuation = handle.promise().continuation;
+                        return continuation ? continuation : std::noop_coroutine();
+                    };
+                    inline void await_resume() noexcept {};
+                };
+
+                inline FinalAwaiter final_suspend() noexcept {
+                    return {};
+                };
+                inline void return_void() {};
+                inline void unhandled_exception() {
+                    exception = std::current_exception();
+                };
+            };
+
+            std::coroutine_handle<promise_type> handle;
+
+            Task() : handle(nullptr) {};
+            explicit Task(std::coroutine_handle<promise_type> _handle) : handle(_handle) {};
+            Task(const Task&) = delete;
+            Task(Task &&rhs) : handle(rhs.handle) {
+                rhs.handle = nullptr;
+            };
+            inline Task& operator=(Task &&rhs) {
+                if (handle) handle.destroy();
+                handle     = rhs.handle;
+                rhs.handle = nullptr;
+                return *this;
+            };
+            ~Task() {
+                if (handle) handle.destroy();
+            };
+
+            inline bool await_ready() {
+                return !handle || handle.done();
+            };
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+                handle.promise().continuation = awaiting;
+                return handle;
+            };
+            inline void await_resume() {
+                if (handle.promise().exception) std::rethrow_exception(handle.promise().exception);
+            };
+        };
+
+        /**
+         * \ingroup Coro
+         * A single threaded scheduler. Coroutines suspended on requests are resumed when Testsome reports their completion
+         */
+        struct Scheduler {
+            /// Members
+            std::vector<Task> tasks;
+            std::deque<std::coroutine_handle<>> ready;
+            RequestSet requests;
+            RequestSet_payload<std::pair<std::coroutine_handle<>, Status*>> waiting;
+            int futures;
+
+            Scheduler() : futures(0) {};
+        };
+
+        /// \cond HIDE
+        inline Scheduler& Scheduler_get() {
+            Scheduler *sched = Scheduler_current();
+            if (sched == nullptr) MEL::Abort(-1, "MEL::Coro co_await used outside of MEL::Coro::Run!");
+            return *sched;
+        };
+
+        /// Refers to the awaited request, which outlives the co_await expression when it is a temporary
+        struct RequestAwaiter {
+            Request &rq;
+            Status status;
+
+            inline bool await_ready() {
+                return (MPI_Request) rq == MPI_REQUEST_NULL;
+            };
+            inline void await_suspend(std::coroutine_handle<> handle) {
+                Scheduler &sched = Scheduler_get();
+                RequestSetAdd(sched.requests, rq, sched.waiting.add(std::make_pair(handle, &status)));
+            };
+            inline Status await_resume() {
+                rq = MPI_REQUEST_NULL;
+                return status;
+            };
+        };
+
+        template<typename T>
+        struct FutureAwaiter {
+            Future<T> future;
+
+            inline bool await_ready() {
+                return future.state->ready;
+            };
+            inline void await_suspend(std::coroutine_handle<> handle) {
+                Scheduler *sched = &Scheduler_get();
+                ++sched->futures;
+                future.state->onReady([sched, handle]() {
+                    --sched->futures;
+                    sched->ready.push_back(handle);
+                });
+            };
+            inline decltype(auto) await_resume() {
+                return future.get();
+            };
+        };
+        /// \endcond
+
+        /**
+         * \ingroup Coro
+         * Add a coroutine to a scheduler. It starts running at the next call to Run
+         *
+         * \param[in] sched		The scheduler to run the coroutine
+         * \param[in] task		The coroutine
+         */
+        inline void Spawn(Scheduler &sched, Task &&task) {
+            sched.ready.push_back(task.handle);
+            sched.tasks.push_back(std::move(task));
+        };
+
+        /**
+         * \ingroup Coro
+         * Resume every coroutine that is ready, then test the requests coroutines are suspended on
+         *
+         * \see MPI_Testsome
+         *
+         * \param[in] sched		The scheduler to progress
+         * \return				Returns the number of coroutines resumed
+         */
+        inline int Poll(Scheduler &sched) {
+            Scheduler *previous = Scheduler_current();
+            Scheduler_current() = &sched;
+
+            int resumed = 0;
+            while (!sched.ready.empty()) {
+                auto handle = sched.ready.front();
+                sched.ready.pop_front();
+                handle.resume();
+                ++resumed;
+            }
+
+            const int onum = RequestSetTestsome(sched.requests);
+            for (int i = 0; i < onum; ++i) {
+                const auto waiter = sched.waiting.take(sched.requests.completed[i]);
+                *waiter.second = sched.requests.completedStatuses[i];
+                sched.ready.push_back(waiter.first);
+            }
+            if (sched.futures > 0) MEL::FuturePoll();
+
+            Scheduler_current() = previous;
+            return resumed;
+        };
+
+        /**
+         * \ingroup Coro
+         * Run a scheduler until every spawned coroutine has finished. Rethrows the first exception escaping a coroutine
+         *
+         * \param[in] sched		The scheduler to run
+         */
+        inline void Run(Scheduler &sched) {
+            while (!sched.ready.empty() || RequestSetSize(sched.requests) > 0 || sched.futures > 0) {
+                Poll(sched);
+            }
+
+            std::vector<Task> tasks;
+            tasks.swap(sched.tasks);
+            for (auto &task : tasks) {
+                if (!task.handle.done()) MEL::Abort(-1, "MEL::Coro::Run A coroutine is suspended on something other than a MEL request!");
+                if (task.handle.promise().exception) std::rethrow_exception(task.handle.promise().exception);
+            }
+        };
+    };
+
+    /**
+     * \ingroup Coro
+     * Suspend the calling coroutine until a request completes. The request is set to REQUEST_NULL when the coroutine resumes, 
+     * as MEL::Wait does
+     *
+     * \param[in,out] rq	The request to wait on
+     * \return				Returns an awaitable producing the status of the request
+     */
+    inline Coro::RequestAwaiter operator co_await(Request &rq) {
+        return Coro::RequestAwaiter{rq, Status{}};
+    };
+
+    /**
+     * \ingroup Coro
+     * Suspend the calling coroutine until a request completes, such as one returned by Isend, Irecv, Iallreduce or FileIwrite
+     *
+     * \param[in] rq		The request to wait on
+     * \return				Returns an awaitable producing the status of the request
+     */
+    inline Coro::RequestAwaiter operator co_await(Request &&rq) {
+        return Coro::RequestAwaiter{rq, Status{}};
+    };
+
+    /**
+     * \ingroup Coro
+     * Suspend the calling coroutine until a future is ready
+     *
+     * \param[in] future	The future to wait on
+     * \return				Returns an awaitable producing a reference to the value of the future
+     */
+    template<typename T>
+    inline Coro::FutureAwaiter<T> operator co_await(Future<T> future) {
+        return Coro::FutureAwaiter<T>{future};
+    };
+};
+
+#endif
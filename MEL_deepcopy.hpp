@@ -31,6 +31,24 @@ SOFTWARE.
 #include <list>
 #include <fstream>
 #include <unordered_map>
+#include <type_traits>
+
+#ifdef MEL_ZSTD
+#include <zstd.h>
+#endif
+
+#ifndef _WIN32
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace MEL {
     namespace Deep {
@@ -171,6 +189,353 @@ namespace MEL {
             };
         };
 
+        /// Packs each block in the portable external32 representation, converting lengths, the 64-bit root address, elementary 
+        /// types and types declared with MEL_DATATYPE. Other types are written as their native bytes, including any object holding 
+        /// pointer members, so files containing them only read back on the same architecture
+        class TransportExternalFileWrite {
+        private:
+            /// Members
+            std::ofstream *file;
+            std::vector<char> scratch;
+
+        public:
+            static constexpr bool SOURCE = true;
+
+            TransportExternalFileWrite(std::ofstream &_file) : file(&_file) {};
+
+            template<typename T>
+            inline void transport(T *&ptr, const int len) {
+                const MEL::Aint size = MEL::PackExternalSize<T>(len);
+                scratch.resize(size);
+                MEL::Aint position = 0;
+                MEL::PackExternal(ptr, len, &scratch[0], size, position);
+                file->write(&scratch[0], size);
+            };
+        };
+
+        class TransportExternalFileRead {
+        private:
+            /// Members
+            std::ifstream *file;
+            std::vector<char> scratch;
+
+        public:
+            static constexpr bool SOURCE = false;
+
+            TransportExternalFileRead(std::ifstream &_file) : file(&_file) {};
+
+            template<typename T>
+            inline void transport(T *&ptr, const int len) {
+                const MEL::Aint size = MEL::PackExternalSize<T>(len);
+                scratch.resize(size);
+                file->read(&scratch[0], size);
+                MEL::Aint position = 0;
+                MEL::UnpackExternal(&scratch[0], size, position, ptr, len);
+            };
+        };
+
+#ifndef _WIN32
+        /// \cond HIDE
+        /// Runs one job at a time on a background thread. Submitting waits for the previous job to finish. A job returns false 
+        /// on failure, which is only recorded so the owner can raise it on its own thread
+        class StreamFile_worker {
+        private:
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::function<bool()> job;
+            bool busy, done;
+            std::atomic<bool> error;
+
+            inline void loop() {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true) {
+                    cv.wait(lock, [this] { return busy || done; });
+                    if (!busy) return;
+                    lock.unlock();
+                    const bool ok = job();
+                    lock.lock();
+                    if (!ok) error = true;
+                    busy = false;
+                    cv.notify_all();
+                }
+            };
+
+        public:
+            StreamFile_worker() : busy(false), done(false), error(false) {
+                thread = std::thread(&StreamFile_worker::loop, this);
+            };
+
+            ~StreamFile_worker() {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [this] { return !busy; });
+                    done = true;
+                    cv.notify_all();
+                }
+                thread.join();
+            };
+
+            inline void submit(const std::function<bool()> &_job) {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return !busy; });
+                job  = _job;
+                busy = true;
+                cv.notify_all();
+            };
+
+            inline void wait() {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return !busy; });
+            };
+
+            inline bool failed() const {
+                return error.load(std::memory_order_acquire);
+            };
+        };
+
+        static constexpr size_t STREAM_FILE_ALIGN = 4096;
+
+        inline int StreamFile_open(const std::string &path, int flags, const bool direct) {
+#ifdef O_DIRECT
+            if (direct) flags |= O_DIRECT;
+            int fd = open(path.c_str(), flags, 0644);
+            /// Some file systems refuse direct IO, fall back to the page cache rather than failing
+            if (fd < 0 && direct) fd = open(path.c_str(), flags & ~O_DIRECT, 0644);
+#else
+            int fd = open(path.c_str(), flags, 0644);
+#endif
+            if (fd < 0) MEL::Abort(-1, "MEL::Deep::StreamFile Could not open file!");
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+            if (direct) fcntl(fd, F_NOCACHE, 1);
+#endif
+            return fd;
+        };
+
+        inline char* StreamFile_alloc(const size_t bytes) {
+            void *ptr = nullptr;
+            if (posix_memalign(&ptr, STREAM_FILE_ALIGN, bytes) != 0) MEL::Abort(-1, "MEL::Deep::StreamFile Could not allocate buffer!");
+            return (char*) ptr;
+        };
+        /// \endcond
+
+        /// A write only file with its own large aligned buffers, for deep copies of many small blocks. Full buffers are written
+        /// by a background thread while the next one fills. With direct the page cache is bypassed where the OS supports it
+        class StreamFileWriter {
+        private:
+            /// Members
+            int fd;
+            bool direct;
+            size_t capacity, fill;
+            int64_t total;
+            int active;
+            char *buffers[2];
+            StreamFile_worker *worker;
+
+            inline void dispatch(const size_t bytes) {
+                char *buffer = buffers[active];
+                const int f  = fd;
+                auto job = [buffer, bytes, f]() {
+                    size_t done = 0;
+                    while (done < bytes) {
+                        const ssize_t n = ::write(f, buffer + done, bytes - done);
+                        if (n <= 0) return false;
+                        done += n;
+                    }
+                    return true;
+                };
+                if (worker != nullptr) worker->submit(job);
+                else if (!job())       MEL::Abort(-1, "MEL::Deep::StreamFileWriter Write failed!");
+
+                active = 1 - active;
+                fill   = 0;
+            };
+
+            /// A write that failed on the background thread is raised here, on the thread using the file
+            inline void check() {
+                if (worker != nullptr && worker->failed()) MEL::Abort(-1, "MEL::Deep::StreamFileWriter Write failed!");
+            };
+
+        public:
+            StreamFileWriter(const std::string &path, const size_t bufferSize = 1 << 24, const bool _direct = false, const bool background = true) 
+                : direct(_direct), fill(0), total(0), active(0), worker(nullptr) {
+                /// Direct IO needs whole aligned blocks
+                capacity   = ((bufferSize + STREAM_FILE_ALIGN - 1) / STREAM_FILE_ALIGN) * STREAM_FILE_ALIGN;
+                fd         = StreamFile_open(path, O_WRONLY | O_CREAT | O_TRUNC, direct);
+                buffers[0] = StreamFile_alloc(capacity);
+                buffers[1] = StreamFile_alloc(capacity);
+                if (background) worker = new StreamFile_worker();
+            };
+
+            StreamFileWriter(const StreamFileWriter &)            = delete;
+            StreamFileWriter& operator=(const StreamFileWriter &) = delete;
+
+            ~StreamFileWriter() {
+                close();
+            };
+
+            inline void write(const char *data, size_t bytes) {
+                if (fd < 0) MEL::Abort(-1, "MEL::Deep::StreamFileWriter Write after close!");
+                check();
+                total += bytes;
+                while (bytes > 0) {
+                    const size_t n = std::min(bytes, capacity - fill);
+                    std::memcpy(buffers[active] + fill, data, n);
+                    fill  += n;
+                    data  += n;
+                    bytes -= n;
+                    if (fill == capacity) dispatch(capacity);
+                }
+            };
+
+            inline void close() {
+                if (fd < 0) return;
+                /// The tail is padded to a whole block for direct IO, then the file is cut back to its true length
+                if (fill > 0) {
+                    size_t bytes = fill;
+                    if (direct) {
+                        bytes = ((fill + STREAM_FILE_ALIGN - 1) / STREAM_FILE_ALIGN) * STREAM_FILE_ALIGN;
+                        std::memset(buffers[active] + fill, 0, bytes - fill);
+                    }
+                    dispatch(bytes);
+                }
+                if (worker != nullptr) worker->wait();
+                check();
+                delete worker;
+                worker = nullptr;
+
+                if (direct && ftruncate(fd, total) != 0) MEL::Abort(-1, "MEL::Deep::StreamFileWriter Truncate failed!");
+                ::close(fd);
+                fd = -1;
+                free(buffers[0]);
+                free(buffers[1]);
+                buffers[0] = buffers[1] = nullptr;
+            };
+        };
+
+        /// A read only file with its own large aligned buffers. The next buffer is read ahead by a background thread while 
+        /// the current one is consumed. With direct the page cache is bypassed where the OS supports it
+        class StreamFileReader {
+        private:
+            /// Members
+            int fd;
+            size_t capacity, pos;
+            int active;
+            char *buffers[2];
+            size_t avail[2];
+            StreamFile_worker *worker;
+
+            inline void fetch(const int b) {
+                char *buffer   = buffers[b];
+                size_t *bytes  = &avail[b];
+                const size_t c = capacity;
+                const int f    = fd;
+                auto job = [buffer, bytes, c, f]() {
+                    size_t done = 0;
+                    while (done < c) {
+                        const ssize_t n = ::read(f, buffer + done, c - done);
+                        if (n < 0) return false;
+                        if (n == 0) break;
+                        done += n;
+                    }
+                    *bytes = done;
+                    return true;
+                };
+                if (worker != nullptr) worker->submit(job);
+                else if (!job())       MEL::Abort(-1, "MEL::Deep::StreamFileReader Read failed!");
+            };
+
+            inline void next() {
+                active = 1 - active;
+                pos    = 0;
+                if (worker != nullptr) worker->wait();
+                else                   fetch(active);
+
+                /// A read that failed on the background thread is raised here, on the thread using the file
+                if (worker != nullptr && worker->failed()) MEL::Abort(-1, "MEL::Deep::StreamFileReader Read failed!");
+                if (avail[active] == 0) MEL::Abort(-1, "MEL::Deep::StreamFileReader Read past end of file!");
+                /// Start reading ahead into the buffer just consumed
+                if (worker != nullptr && avail[active] == capacity) fetch(1 - active);
+            };
+
+        public:
+            StreamFileReader(const std::string &path, const size_t bufferSize = 1 << 24, const bool direct = false, const bool background = true) 
+                : pos(0), active(1), worker(nullptr) {
+                capacity   = ((bufferSize + STREAM_FILE_ALIGN - 1) / STREAM_FILE_ALIGN) * STREAM_FILE_ALIGN;
+                fd         = StreamFile_open(path, O_RDONLY, direct);
+                buffers[0] = StreamFile_alloc(capacity);
+                buffers[1] = StreamFile_alloc(capacity);
+                avail[0]   = avail[1] = 0;
+                if (background) {
+                    worker = new StreamFile_worker();
+                    fetch(0);
+                }
+            };
+
+            StreamFileReader(const StreamFileReader &)            = delete;
+            StreamFileReader& operator=(const StreamFileReader &) = delete;
+
+            ~StreamFileReader() {
+                close();
+            };
+
+            inline void read(char *data, size_t bytes) {
+                if (fd < 0) MEL::Abort(-1, "MEL::Deep::StreamFileReader Read after close!");
+                while (bytes > 0) {
+                    if (pos == avail[active]) next();
+                    const size_t n = std::min(bytes, avail[active] - pos);
+                    std::memcpy(data, buffers[active] + pos, n);
+                    pos   += n;
+                    data  += n;
+                    bytes -= n;
+                }
+            };
+
+            inline void close() {
+                if (fd < 0) return;
+                delete worker;
+                worker = nullptr;
+                ::close(fd);
+                fd = -1;
+                free(buffers[0]);
+                free(buffers[1]);
+                buffers[0] = buffers[1] = nullptr;
+            };
+        };
+
+        class TransportStreamFileWrite {
+        private:
+            /// Members
+            StreamFileWriter *file;
+
+        public:
+            static constexpr bool SOURCE = true;
+
+            TransportStreamFileWrite(StreamFileWriter &_file) : file(&_file) {};
+
+            template<typename T>
+            inline void transport(T *&ptr, const int len) {
+                file->write((const char*) ptr, len * sizeof(T));
+            };
+        };
+
+        class TransportStreamFileRead {
+        private:
+            /// Members
+            StreamFileReader *file;
+
+        public:
+            static constexpr bool SOURCE = false;
+
+            TransportStreamFileRead(StreamFileReader &_file) : file(&_file) {};
+
+            template<typename T>
+            inline void transport(T *&ptr, const int len) {
+                file->read((char*) ptr, len * sizeof(T));
+            };
+        };
+#endif
+
         class TransportBufferWrite {
         private:
             /// Members
@@ -180,7 +545,8 @@ namespace MEL {
         public:
             static constexpr bool SOURCE = true;
 
-            TransportBufferWrite(char *_buffer, const int _bufferSize) : offset(0), buffer(_buffer), bufferSize(_bufferSize) {};
+            TransportBufferWrite(char *_buffer, const int _bufferSize) : offset(0), buffer(_buffer), bufferSize(_bufferSize), aligned(false) {};
+            TransportBufferWrite(char *_buffer, const int _bufferSize, const bool _aligned) : offset(0), bufferSize(_bufferSize), buffer(_buffer), aligned(_aligned) {};
 
             template<typename T>
             inline void transport(T *&ptr, const int len) {
@@ -194,6 +560,18 @@ namespace MEL {
                     MEL::Abort(-1, "TransportBufferWrite : Offset longer than buffer...");
                 }
             };
+
+            /// When aligned, zero fill up to the next multiple of alignment so the following array can be used in place
+            inline int pad(const int at, const int alignment) {
+                const int num = aligned ? (alignment - (at % alignment)) % alignment : 0;
+                if ((offset + num) > bufferSize) MEL::Abort(-1, "TransportBufferWrite : Offset longer than buffer...");
+                std::memset(&buffer[offset], 0, num);
+                offset += num;
+                return num;
+            };
+
+        private:
+            bool aligned;
         };
 
         class TransportBufferRead {
@@ -221,15 +599,216 @@ namespace MEL {
             }
         };
 
+        class TransportBufferMap {
+        private:
+            /// Members
+            int offset, bufferSize;
+            char *buffer;
+            std::vector<void*> *owned;
+            bool aligned;
+
+        public:
+            static constexpr bool SOURCE = false;
+
+            TransportBufferMap(char *_buffer, const int _bufferSize, std::vector<void*> &_owned, const bool _aligned) : offset(0), bufferSize(_bufferSize), buffer(_buffer), owned(&_owned), aligned(_aligned) {};
+
+            template<typename T>
+            inline void transport(T *&ptr, const int len) {
+                const int num = len * sizeof(T);
+
+                if ((offset + num) <= bufferSize) {
+                    memcpy((void*) ptr, &buffer[offset], num);
+                    offset += num;
+                }
+                else {
+                    MEL::Abort(-1, "TransportBufferMap : Offset longer than buffer...");
+                }
+            };
+
+            /// Point ptr directly into the buffer when the elements can be used in place, otherwise allocate and copy
+            template<typename T>
+            inline void map(T *&ptr, const int len, const bool trivial) {
+                const int num = len * sizeof(T);
+
+                if ((offset + num) > bufferSize) MEL::Abort(-1, "TransportBufferMap : Offset longer than buffer...");
+                
+                if (trivial && (((size_t) &buffer[offset]) % alignof(T)) == 0) {
+                    ptr = (T*) &buffer[offset];
+                }
+                else {
+                    ptr = MEL::MemAlloc<T>(len);
+                    memcpy((void*) ptr, &buffer[offset], num);
+                    owned->push_back((void*) ptr);
+                }
+                offset += num;
+            };
+
+            /// Skip the padding an aligned writer placed before an array
+            inline int pad(const int at, const int alignment) {
+                const int num = aligned ? (alignment - (at % alignment)) % alignment : 0;
+                if ((offset + num) > bufferSize) MEL::Abort(-1, "TransportBufferMap : Offset longer than buffer...");
+                offset += num;
+                return num;
+            };
+        };
+
         class NoTransport {
+        private:
+            bool aligned;
+
         public:
             static constexpr bool SOURCE = true; 
         
-            explicit NoTransport(const int dummy) {};
+            explicit NoTransport(const int) : aligned(false) {};
+            NoTransport(const int, const bool _aligned) : aligned(_aligned) {};
 
             template<typename T>
             inline void transport(T *&ptr, const int len) {};
+
+            /// Count the padding an aligned writer would insert
+            inline int pad(const int at, const int alignment) const {
+                return aligned ? (alignment - (at % alignment)) % alignment : 0;
+            };
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Codecs for the Compressed API. A codec provides a non-zero ID stored in every frame, and
+        //     static int  compress(const char *src, const int n, char *dst, const int cap)     the compressed size, or -1 if it exceeds cap
+        //     static bool decompress(const char *src, const int n, char *dst, const int raw)   true if exactly raw bytes were produced
+
+        // A self contained byte oriented LZ77 codec in the style of LZ4. Each sequence is a token holding the literal length and 
+        // match length in its high and low nibbles, extended by 255-continued bytes, the literals, then a 16 bit match offset
+        class LZCodec {
+        private:
+            static constexpr int MIN_MATCH = 4, HASH_BITS = 14;
+
+            static inline unsigned char* writeLength(unsigned char *op, const unsigned char *oend, int len) {
+                for (; len >= 255; len -= 255) {
+                    if (op >= oend) return nullptr;
+                    *op++ = 255;
+                }
+                if (op >= oend) return nullptr;
+                *op++ = (unsigned char) len;
+                return op;
+            };
+
+            static inline unsigned char* writeSequence(unsigned char *op, const unsigned char *oend, const unsigned char *lit, const int litLen, const int offset, const int matchLen) {
+                if (op >= oend) return nullptr;
+                unsigned char *token = op++;
+                *token = (unsigned char) (((litLen < 15) ? litLen : 15) << 4);
+                if (litLen >= 15 && (op = writeLength(op, oend, litLen - 15)) == nullptr) return nullptr;
+
+                if ((oend - op) < litLen) return nullptr;
+                std::memcpy(op, lit, litLen);
+                op += litLen;
+
+                /// The final sequence carries literals only
+                if (matchLen == 0) return op;
+
+                if ((oend - op) < 2) return nullptr;
+                *op++ = (unsigned char) (offset & 0xFF);
+                *op++ = (unsigned char) (offset >> 8);
+
+                const int ml = matchLen - MIN_MATCH;
+                *token |= (unsigned char) ((ml < 15) ? ml : 15);
+                if (ml >= 15 && (op = writeLength(op, oend, ml - 15)) == nullptr) return nullptr;
+                return op;
+            };
+
+            static inline bool readLength(const unsigned char *&ip, const unsigned char *iend, int &len) {
+                unsigned char b;
+                do {
+                    if (ip >= iend) return false;
+                    b = *ip++;
+                    len += b;
+                } while (b == 255);
+                return true;
+            };
+
+        public:
+            static constexpr int ID = 1;
+
+            static inline int compress(const char *src, const int n, char *dst, const int cap) {
+                const unsigned char *in = (const unsigned char*) src;
+                unsigned char *op = (unsigned char*) dst, *oend = op + cap;
+
+                std::vector<int> table(1 << HASH_BITS, -1);
+                int anchor = 0, i = 0;
+                while (i + MIN_MATCH <= n) {
+                    uint32_t seq;
+                    std::memcpy(&seq, in + i, sizeof(uint32_t));
+                    const uint32_t h = (seq * 2654435761u) >> (32 - HASH_BITS);
+                    const int ref = table[h];
+                    table[h] = i;
+
+                    if (ref >= 0 && (i - ref) <= 0xFFFF && std::memcmp(in + ref, in + i, MIN_MATCH) == 0) {
+                        int len = MIN_MATCH;
+                        while (i + len < n && in[ref + len] == in[i + len]) ++len;
+
+                        if ((op = writeSequence(op, oend, in + anchor, i - anchor, i - ref, len)) == nullptr) return -1;
+                        i += len;
+                        anchor = i;
+                    }
+                    else {
+                        ++i;
+                    }
+                }
+                if ((op = writeSequence(op, oend, in + anchor, n - anchor, 0, 0)) == nullptr) return -1;
+                return (int) (op - (unsigned char*) dst);
+            };
+
+            static inline bool decompress(const char *src, const int n, char *dst, const int raw) {
+                const unsigned char *ip = (const unsigned char*) src, *iend = ip + n;
+                unsigned char *op = (unsigned char*) dst, *oend = op + raw;
+
+                while (ip < iend) {
+                    const unsigned char token = *ip++;
+
+                    int litLen = token >> 4;
+                    if (litLen == 15 && !readLength(ip, iend, litLen)) return false;
+                    if ((iend - ip) < litLen || (oend - op) < litLen) return false;
+                    std::memcpy(op, ip, litLen);
+                    ip += litLen;
+                    op += litLen;
+
+                    if (ip == iend) break;
+
+                    if ((iend - ip) < 2) return false;
+                    const int offset = ip[0] | (ip[1] << 8);
+                    ip += 2;
+
+                    int matchLen = token & 0x0F;
+                    if (matchLen == 15 && !readLength(ip, iend, matchLen)) return false;
+                    matchLen += MIN_MATCH;
+
+                    if (offset == 0 || offset > (op - (unsigned char*) dst) || (oend - op) < matchLen) return false;
+                    /// Matches may overlap the bytes they produce, so copy forwards one byte at a time
+                    const unsigned char *match = op - offset;
+                    for (int i = 0; i < matchLen; ++i) op[i] = match[i];
+                    op += matchLen;
+                }
+                return op == oend;
+            };
+        };
+
+#ifdef MEL_ZSTD
+        // Zstandard codec, available when the including code defines MEL_ZSTD and links against libzstd
+        class ZstdCodec {
+        public:
+            static constexpr int ID = 2, LEVEL = 3;
+
+            static inline int compress(const char *src, const int n, char *dst, const int cap) {
+                const size_t len = ZSTD_compress(dst, cap, src, n, LEVEL);
+                return ZSTD_isError(len) ? -1 : (int) len;
+            };
+
+            static inline bool decompress(const char *src, const int n, char *dst, const int raw) {
+                const size_t len = ZSTD_decompress(dst, raw, src, n);
+                return !ZSTD_isError(len) && len == (size_t) raw;
+            };
         };
+#endif
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -364,6 +943,7 @@ namespace MEL {
                     typedef typename std::remove_pointer<P>::type T; // where P == T*, find T
 
                     offset += len * sizeof(T);
+                    MEL_PROFILE_SCOPE("Deep::Transport", (long long) len * sizeof(T));
                     transporter.transport(ptr, len);
                 }
             };
@@ -374,10 +954,47 @@ namespace MEL {
                 transport(ptr, 1);
             };
 
+            /// The root address is a fixed 64-bit field, so portable transports such as external32 files read it on any architecture
+            template<typename T>
+            inline void transportRootAddress(T* &ptr) {
+                uint64_t addr = (uint64_t) (uintptr_t) ptr;
+                transport(addr);
+                ptr = (T*) (uintptr_t) addr;
+            };
+
+            /// Transports that can hand out memory in place, such as TransportBufferMap, provide a map method
+            template<typename TM, typename T>
+            static inline auto transportMap(TM &tm, T *&ptr, const int len, int) -> decltype(tm.map(ptr, len, true), bool()) {
+                tm.map(ptr, len, std::is_trivially_copyable<T>::value);
+                return true;
+            };
+
+            template<typename TM, typename T>
+            static inline bool transportMap(TM &, T *&, const int, long) {
+                return false;
+            };
+
+            /// Transports that lay arrays out on their natural alignment, such as memory mapped files, provide a pad method
+            template<typename TM>
+            static inline auto transportPad(TM &tm, const int at, const int alignment, int) -> decltype(tm.pad(at, alignment)) {
+                return tm.pad(at, alignment);
+            };
+
+            template<typename TM>
+            static inline int transportPad(TM &, const int, const int, long) {
+                return 0;
+            };
+
             template<typename P>
             inline enable_if_pointer<P> transportAlloc(P &ptr, const int len) {
+                typedef typename std::remove_pointer<P>::type T; // where P == T*, find T
+                if (len > 0 && ptr != nullptr) offset += transportPad(transporter, offset, (int) alignof(T), 0);
+
                 if (!TRANSPORT_METHOD::SOURCE) {
-                    typedef typename std::remove_pointer<P>::type T; // where P == T*, find T
+                    if (len > 0 && ptr != nullptr && transportMap(transporter, ptr, len, 0)) {
+                        offset += len * sizeof(T);
+                        return;
+                    }
                     ptr = (len > 0 && ptr != nullptr) ? MEL::MemAlloc<T>(len) : nullptr;
                 }
                 transport(ptr, len);
@@ -512,9 +1129,7 @@ namespace MEL {
             template<typename T>
             inline enable_if_not_deep<T> packRootPtr(T* &ptr, int len = 1) {
                 // Explicitly transport the pointer value for the root node
-                size_t addr = (size_t) ptr;
-                transport(addr);
-                ptr = (T*) addr;
+                transportRootAddress(ptr);
 
                 T *oldPtr = ptr;
                 if (pointerMap.find(oldPtr, ptr)) return;
@@ -526,9 +1141,7 @@ namespace MEL {
             template<typename T, DEEP_FUNCTOR<T, TRANSPORT_METHOD, HASH_MAP> F>
             inline void packRootPtr(T* &ptr, int len = 1) {
                 // Explicitly transport the pointer value for the root node
-                size_t addr = (size_t) ptr;
-                transport(addr);
-                ptr = (T*) addr;
+                transportRootAddress(ptr);
 
                 T *oldPtr = ptr;
                 if (pointerMap.find(oldPtr, ptr)) return;
@@ -547,9 +1160,7 @@ namespace MEL {
             template<typename D>
             inline enable_if_deep<D> packRootPtr(D* &ptr, int len = 1) {
                 // Explicitly transport the pointer value for the root node
-                size_t addr = (size_t) ptr;
-                transport(addr);
-                ptr = (D*) addr;
+                transportRootAddress(ptr);
                 
                 D *oldPtr = ptr;
                 if (pointerMap.find(oldPtr, ptr)) return;
@@ -568,7 +1179,8 @@ namespace MEL {
             /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
             // STL
 
-            inline void packSTL(std::string &obj) {
+            template<typename A>
+            inline void packSTL(std::basic_string<char, std::char_traits<char>, A> &obj) {
                 int len;
                 if (TRANSPORT_METHOD::SOURCE) {
                     len = obj.size();
@@ -576,18 +1188,18 @@ namespace MEL {
                 }
                 else {
                     transport(len);
-                    new (&obj) std::string(len, ' ');
+                    new (&obj) std::basic_string<char, std::char_traits<char>, A>(len, ' ');
                 }
 
                 char *p = &obj[0];
                 if (len > 0) transport(p, len);
             };
 
-            template<typename T>
-            inline enable_if_not_deep<T> packSTL(std::vector<T> &obj) {
+            template<typename T, typename A>
+            inline enable_if_not_deep<T> packSTL(std::vector<T, A> &obj) {
                 int len = obj.size();
                 if (!TRANSPORT_METHOD::SOURCE) {
-                    new (&obj) std::vector<T>(len, T());
+                    new (&obj) std::vector<T, A>(len, T());
                     for (int i = 0; i < len; ++i) (&obj[i])->~T();
                 }
 
@@ -595,11 +1207,11 @@ namespace MEL {
                 if (len > 0) transport(p, len);
             };
 
-            template<typename T, DEEP_FUNCTOR<T, TRANSPORT_METHOD, HASH_MAP> F>
-            inline void packSTL(std::vector<T> &obj) {
+            template<typename T, DEEP_FUNCTOR<T, TRANSPORT_METHOD, HASH_MAP> F, typename A>
+            inline void packSTL(std::vector<T, A> &obj) {
                 int len = obj.size();
                 if (!TRANSPORT_METHOD::SOURCE) {
-                    new (&obj) std::vector<T>(len);
+                    new (&obj) std::vector<T, A>(len);
                     for (int i = 0; i < len; ++i) (&obj[i])->~T();
                 }
 
@@ -612,11 +1224,11 @@ namespace MEL {
                 }
             };
 
-            template<typename D>
-            inline enable_if_deep<D> packSTL(std::vector<D> &obj) {
+            template<typename D, typename A>
+            inline enable_if_deep<D> packSTL(std::vector<D, A> &obj) {
                 int len = obj.size();
                 if (!TRANSPORT_METHOD::SOURCE) {
-                    new (&obj) std::vector<D>(len);
+                    new (&obj) std::vector<D, A>(len);
                     for (int i = 0; i < len; ++i) (&obj[i])->~D();
                 }
 
@@ -681,8 +1293,8 @@ namespace MEL {
             // Root STL
 
             // ###### EDITED #######
-            template<typename T>
-            inline enable_if_not_deep_pointer<T> packRootSTL(std::vector<T> &obj) {
+            template<typename T, typename A>
+            inline enable_if_not_deep_pointer<T> packRootSTL(std::vector<T, A> &obj) {
                 int len;
                 if (TRANSPORT_METHOD::SOURCE) {
                     len = obj.size(); transport(len);
@@ -702,8 +1314,8 @@ namespace MEL {
                 // ###### ADDED #######
             };
 
-            template<typename T>
-            inline enable_if_not_deep_not_pointer<T> packRootSTL(std::vector<T> &obj) {
+            template<typename T, typename A>
+            inline enable_if_not_deep_not_pointer<T> packRootSTL(std::vector<T, A> &obj) {
                 int len;
                 if (TRANSPORT_METHOD::SOURCE) {
                     int rank = MEL::CommRank(MEL::Comm::WORLD);
@@ -719,8 +1331,8 @@ namespace MEL {
             };
             // ###### EDITED #######
 
-            template<typename T, DEEP_FUNCTOR<T, TRANSPORT_METHOD, HASH_MAP> F>
-            inline void packRootSTL(std::vector<T> &obj) {
+            template<typename T, DEEP_FUNCTOR<T, TRANSPORT_METHOD, HASH_MAP> F, typename A>
+            inline void packRootSTL(std::vector<T, A> &obj) {
                 int len;
                 if (TRANSPORT_METHOD::SOURCE) {
                     len = obj.size(); transport(len);
@@ -738,8 +1350,8 @@ namespace MEL {
                 }
             };
 
-            template<typename D>
-            inline enable_if_deep<D> packRootSTL(std::vector<D> &obj) {
+            template<typename D, typename A>
+            inline enable_if_deep<D> packRootSTL(std::vector<D, A> &obj) {
                 int len;
                 if (TRANSPORT_METHOD::SOURCE) {
                     len = obj.size(); transport(len);
@@ -946,8 +1558,8 @@ namespace MEL {
             /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
             // Shorthand Overloads
 
-            template<typename T>
-            inline Message<TRANSPORT_METHOD, HASH_MAP>& operator&(std::vector<T> &obj) {
+            template<typename T, typename A>
+            inline Message<TRANSPORT_METHOD, HASH_MAP>& operator&(std::vector<T, A> &obj) {
                 packSTL(obj);
                 return *this;
             };
@@ -964,7 +1576,8 @@ namespace MEL {
                 return *this;
             };
 
-            inline Message<TRANSPORT_METHOD, HASH_MAP>& operator&(std::string &obj) {
+            template<typename A>
+            inline Message<TRANSPORT_METHOD, HASH_MAP>& operator&(std::basic_string<char, std::char_traits<char>, A> &obj) {
                 packSTL(obj);
                 return *this;
             };
@@ -1064,6 +1677,26 @@ namespace MEL {
             return msg.getOffset();
         };
 
+        /// \cond HIDE
+        /// Buffered and compressed deep copies travel as one message. The receiver sizes its buffer from a matched probe, 
+        /// so a wildcard receive can never take the payload of a different sender than the one it sized for
+        inline char* Buffered_recv(int &len, const int src, const int tag, const Comm &comm) {
+#ifdef MEL_3
+            MEL::Message message;
+            const Status status = MEL::Mprobe(src, tag, comm, message);
+            len = MEL::ProbeGetCount<char>(status);
+            char *buffer = MEL::MemAlloc<char>(len);
+            MEL::Mrecv(buffer, len, MEL::Datatype::CHAR, message);
+#else
+            const Status status = MEL::Probe(src, tag, comm);
+            len = MEL::ProbeGetCount<char>(status);
+            char *buffer = MEL::MemAlloc<char>(len);
+            MEL::Recv(buffer, len, MEL::Datatype::CHAR, status.MPI_SOURCE, status.MPI_TAG, comm);
+#endif
+            return buffer;
+        };
+        /// \endcond
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Send
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1093,7 +1726,7 @@ namespace MEL {
             msg.packRootVar(len);
             msg.packRootPtr(ptr, len);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
 
             MEL::MemFree(buffer);
         };
@@ -1107,7 +1740,7 @@ namespace MEL {
             msg.packRootVar(len);
             msg. template packRootPtr<T, F>(ptr, len);
             
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1148,7 +1781,7 @@ namespace MEL {
             Message<TransportBufferWrite, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootPtr(ptr);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
 
             MEL::MemFree(buffer);
         };
@@ -1160,7 +1793,7 @@ namespace MEL {
             typedef typename std::remove_pointer<P>::type T;
             msg. template packRootPtr<T, F>(ptr);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1196,7 +1829,7 @@ namespace MEL {
             Message<TransportBufferWrite, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootSTL(obj);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1207,7 +1840,7 @@ namespace MEL {
             Message<TransportBufferWrite, HASH_MAP> msg(buffer, bufferSize);
             msg. template packRootSTL<T, F>(obj);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1267,7 +1900,7 @@ namespace MEL {
             Message<TransportBufferWrite, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootVar(obj);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1277,7 +1910,7 @@ namespace MEL {
             Message<TransportBufferWrite, HASH_MAP> msg(buffer, bufferSize);
             msg. template packRootVar<T, F>(obj);
 
-            MEL::Deep::Send(buffer, msg.getOffset(), dst, tag, comm);
+            MEL::Send(buffer, msg.getOffset(), dst, tag, comm);
             MEL::MemFree(buffer);
         };
 
@@ -1335,8 +1968,7 @@ namespace MEL {
         TEMPLATE_P
         inline enable_if_pointer<P> BufferedRecv(P &ptr, int &len, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootVar(len);
@@ -1350,8 +1982,7 @@ namespace MEL {
             typedef typename std::remove_pointer<P>::type T;
             
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootVar(len);
@@ -1363,8 +1994,7 @@ namespace MEL {
         TEMPLATE_P
         inline enable_if_pointer<P> BufferedRecv(P &ptr, int const &len, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             int _len = len;
@@ -1380,8 +2010,7 @@ namespace MEL {
             typedef typename std::remove_pointer<P>::type T;
             
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             int _len = len;
@@ -1412,8 +2041,7 @@ namespace MEL {
         TEMPLATE_P
         inline enable_if_pointer<P> BufferedRecv(P &ptr, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootPtr(ptr);
@@ -1426,8 +2054,7 @@ namespace MEL {
             typedef typename std::remove_pointer<P>::type T;
             
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg. template packRootPtr<T, F>(ptr);
@@ -1454,8 +2081,7 @@ namespace MEL {
         TEMPLATE_STL
         inline enable_if_stl<S> BufferedRecv(S &obj, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootSTL(obj);
@@ -1467,8 +2093,7 @@ namespace MEL {
         inline enable_if_stl<S> BufferedRecv(S &obj, const int src, const int tag, const Comm &comm) {
             typedef typename S::value_type T;
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg. template packRootSTL<T, F>(obj);
@@ -1519,8 +2144,7 @@ namespace MEL {
         TEMPLATE_T
         inline enable_if_deep_not_pointer_not_stl<T> BufferedRecv(T &obj, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg.packRootVar(obj);
@@ -1531,8 +2155,7 @@ namespace MEL {
         TEMPLATE_T_F(TransportBufferRead)
         inline enable_if_not_pointer_not_stl<T> BufferedRecv(T &obj, const int src, const int tag, const Comm &comm) {
             int bufferSize;
-            char *buffer = nullptr;
-            MEL::Deep::Recv(buffer, bufferSize, src, tag, comm);
+            char *buffer = MEL::Deep::Buffered_recv(bufferSize, src, tag, comm);
 
             Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
             msg. template packRootVar<T, F>(obj);
@@ -2845,6 +3468,1753 @@ namespace MEL {
             MEL::MemFree(buffer);
         };
 
+#ifndef _WIN32
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stream File Write
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileWrite(P &ptr, int const &len, StreamFileWriter &file) {
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+        };
+
+        TEMPLATE_P_F(TransportStreamFileWrite)
+        inline enable_if_pointer<P> FileWrite(P &ptr, int const &len, StreamFileWriter &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileWrite(P &ptr, StreamFileWriter &file) {
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg.packRootPtr(ptr);
+        };
+
+        TEMPLATE_P_F(TransportStreamFileWrite)
+        inline enable_if_pointer<P> FileWrite(P &ptr, StreamFileWriter &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg. template packRootPtr<T, F>(ptr);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL 
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> FileWrite(S &obj, StreamFileWriter &file) {
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg.packRootSTL(obj);
+        };
+
+        TEMPLATE_STL_F(TransportStreamFileWrite)
+        inline enable_if_stl<S> FileWrite(S &obj, StreamFileWriter &file) {
+            typedef typename S::value_type T;
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg. template packRootSTL<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> FileWrite(T &obj, StreamFileWriter &file) {
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(obj);
+        };
+
+        TEMPLATE_T_F(TransportStreamFileWrite)
+        inline enable_if_not_pointer_not_stl<T> FileWrite(T &obj, StreamFileWriter &file) {
+            Message<TransportStreamFileWrite, HASH_MAP> msg(file);
+            msg. template packRootVar<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stream File Read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileRead(P &ptr, int &len, StreamFileReader &file) {
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+        };
+
+        TEMPLATE_P_F(TransportStreamFileRead)
+        inline enable_if_pointer<P> FileRead(P &ptr, int &len, StreamFileReader &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileRead(P &ptr, StreamFileReader &file) {
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg.packRootPtr(ptr);
+        };
+
+        TEMPLATE_P_F(TransportStreamFileRead)
+        inline enable_if_pointer<P> FileRead(P &ptr, StreamFileReader &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg. template packRootPtr<T, F>(ptr);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> FileRead(S &obj, StreamFileReader &file) {
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg.packRootSTL(obj);
+        };
+
+        TEMPLATE_STL_F(TransportStreamFileRead)
+        inline enable_if_stl<S> FileRead(S &obj, StreamFileReader &file) {
+            typedef typename S::value_type T;
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg. template packRootSTL<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> FileRead(T &obj, StreamFileReader &file) {
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(obj);
+        };
+
+        TEMPLATE_T_F(TransportStreamFileRead)
+        inline enable_if_not_pointer_not_stl<T> FileRead(T &obj, StreamFileReader &file) {
+            Message<TransportStreamFileRead, HASH_MAP> msg(file);
+            msg. template packRootVar<T, F>(obj);
+        };
+#endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // External32 File Write
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> ExternalFileWrite(P &ptr, int const &len, std::ofstream &file) {
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+        };
+
+        TEMPLATE_P_F(TransportExternalFileWrite)
+        inline enable_if_pointer<P> ExternalFileWrite(P &ptr, int const &len, std::ofstream &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> ExternalFileWrite(P &ptr, std::ofstream &file) {
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg.packRootPtr(ptr);
+        };
+
+        TEMPLATE_P_F(TransportExternalFileWrite)
+        inline enable_if_pointer<P> ExternalFileWrite(P &ptr, std::ofstream &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg. template packRootPtr<T, F>(ptr);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL 
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> ExternalFileWrite(S &obj, std::ofstream &file) {
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg.packRootSTL(obj);
+        };
+
+        TEMPLATE_STL_F(TransportExternalFileWrite)
+        inline enable_if_stl<S> ExternalFileWrite(S &obj, std::ofstream &file) {
+            typedef typename S::value_type T;
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg. template packRootSTL<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> ExternalFileWrite(T &obj, std::ofstream &file) {
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg.packRootVar(obj);
+        };
+
+        TEMPLATE_T_F(TransportExternalFileWrite)
+        inline enable_if_not_pointer_not_stl<T> ExternalFileWrite(T &obj, std::ofstream &file) {
+            Message<TransportExternalFileWrite, HASH_MAP> msg(file);
+            msg. template packRootVar<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // External32 File Read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> ExternalFileRead(P &ptr, int &len, std::ifstream &file) {
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+        };
+
+        TEMPLATE_P_F(TransportExternalFileRead)
+        inline enable_if_pointer<P> ExternalFileRead(P &ptr, int &len, std::ifstream &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> ExternalFileRead(P &ptr, std::ifstream &file) {
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg.packRootPtr(ptr);
+        };
+
+        TEMPLATE_P_F(TransportExternalFileRead)
+        inline enable_if_pointer<P> ExternalFileRead(P &ptr, std::ifstream &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg. template packRootPtr<T, F>(ptr);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> ExternalFileRead(S &obj, std::ifstream &file) {
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg.packRootSTL(obj);
+        };
+
+        TEMPLATE_STL_F(TransportExternalFileRead)
+        inline enable_if_stl<S> ExternalFileRead(S &obj, std::ifstream &file) {
+            typedef typename S::value_type T;
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg. template packRootSTL<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> ExternalFileRead(T &obj, std::ifstream &file) {
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg.packRootVar(obj);
+        };
+
+        TEMPLATE_T_F(TransportExternalFileRead)
+        inline enable_if_not_pointer_not_stl<T> ExternalFileRead(T &obj, std::ifstream &file) {
+            Message<TransportExternalFileRead, HASH_MAP> msg(file);
+            msg. template packRootVar<T, F>(obj);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Collective MPI_File Write / Read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /// \cond HIDE
+        /// The file starts with an index of int64_t values: the number of processes that wrote it, then the byte offset of 
+        /// each process's packed object, then the end of the last object. The file must use the default byte view
+        inline int FileIndex_size(const int size) {
+            return (size + 2) * sizeof(int64_t);
+        };
+
+        inline int FileIndex_head(const Comm &comm) {
+            return (MEL::CommRank(comm) == 0) ? FileIndex_size(MEL::CommSize(comm)) : 0;
+        };
+
+        inline void FileIndex_write(char *buffer, const int len, MEL::File &file, const Comm &comm) {
+            const int rank = MEL::CommRank(comm), size = MEL::CommSize(comm), header = FileIndex_size(size);
+
+            int64_t bytes = len, before = 0;
+            MEL::Exscan(&bytes, &before, 1, MEL::Op::SUM, comm);
+            if (rank == 0) before = 0;
+
+            std::vector<int64_t> lens(size);
+            MEL::Gather(&bytes, 1, &lens[0], 1, 0, comm);
+
+            /// Process 0 reserved room for the index in front of its object, so every process writes one contiguous block
+            if (rank == 0) {
+                std::vector<int64_t> index(size + 2);
+                index[0] = size;
+                index[1] = header;
+                for (int i = 0; i < size; ++i) index[i + 2] = index[i + 1] + lens[i];
+                std::memcpy(buffer, &index[0], header);
+            }
+            MEL::FileWriteAtAll(file, (rank == 0) ? 0 : (header + before), buffer, FileIndex_head(comm) + len, MEL::Datatype::UNSIGNED_CHAR);
+        };
+
+        inline char* FileIndex_readAll(int &len, MEL::File &file, const Comm &comm) {
+            const int rank = MEL::CommRank(comm), size = MEL::CommSize(comm);
+
+            std::vector<int64_t> index(size + 2);
+            MEL::FileReadAtAll(file, 0, &index[0], FileIndex_size(size), MEL::Datatype::UNSIGNED_CHAR);
+            if (index[0] != size) MEL::Abort(-1, "MEL::Deep::FileReadAll File was written by a different number of processes!");
+
+            len = index[rank + 2] - index[rank + 1];
+            char *buffer = MEL::MemAlloc<char>(len);
+            MEL::FileReadAtAll(file, index[rank + 1], buffer, len, MEL::Datatype::UNSIGNED_CHAR);
+            return buffer;
+        };
+
+        inline char* FileIndex_read(const int rank, int &len, MEL::File &file) {
+            int64_t size;
+            MEL::FileReadAt(file, 0, &size, sizeof(int64_t), MEL::Datatype::UNSIGNED_CHAR);
+            if (rank < 0 || rank >= size) MEL::Abort(-1, "MEL::Deep::FileReadRank Rank is not in the file index!");
+
+            int64_t range[2];
+            MEL::FileReadAt(file, (rank + 1) * sizeof(int64_t), range, 2 * sizeof(int64_t), MEL::Datatype::UNSIGNED_CHAR);
+
+            len = range[1] - range[0];
+            char *buffer = MEL::MemAlloc<char>(len);
+            MEL::FileReadAt(file, range[0], buffer, len, MEL::Datatype::UNSIGNED_CHAR);
+            return buffer;
+        };
+        /// \endcond
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileWriteAll(P &ptr, int const &len, MEL::File &file, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(ptr, len), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_pointer<P> FileWriteAll(P &ptr, int const &len, MEL::File &file, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr, len), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F2>(ptr, len);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileReadAll(P &ptr, int &len, MEL::File &file, const Comm &comm) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F(TransportBufferRead)
+        inline enable_if_pointer<P> FileReadAll(P &ptr, int &len, MEL::File &file, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileReadRank(P &ptr, int &len, const int rank, MEL::File &file) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F(TransportBufferRead)
+        inline enable_if_pointer<P> FileReadRank(P &ptr, int &len, const int rank, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+
+            MEL::MemFree(buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileWriteAll(P &ptr, MEL::File &file, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(ptr), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg.packRootPtr(ptr);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_pointer<P> FileWriteAll(P &ptr, MEL::File &file, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg. template packRootPtr<T, F2>(ptr);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileReadAll(P &ptr, MEL::File &file, const Comm &comm) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootPtr(ptr);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F(TransportBufferRead)
+        inline enable_if_pointer<P> FileReadAll(P &ptr, MEL::File &file, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootPtr<T, F>(ptr);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> FileReadRank(P &ptr, const int rank, MEL::File &file) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootPtr(ptr);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F(TransportBufferRead)
+        inline enable_if_pointer<P> FileReadRank(P &ptr, const int rank, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootPtr<T, F>(ptr);
+
+            MEL::MemFree(buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> FileWriteAll(S &obj, MEL::File &file, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(obj), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg.packRootSTL(obj);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_stl<S> FileWriteAll(S &obj, MEL::File &file, const Comm &comm) {
+            typedef typename S::value_type T;
+            const int bytes = MEL::Deep::BufferSize<S, HASH_MAP, F1>(obj), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg. template packRootSTL<T, F2>(obj);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> FileReadAll(S &obj, MEL::File &file, const Comm &comm) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootSTL(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL_F(TransportBufferRead)
+        inline enable_if_stl<S> FileReadAll(S &obj, MEL::File &file, const Comm &comm) {
+            typedef typename S::value_type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootSTL<T, F>(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> FileReadRank(S &obj, const int rank, MEL::File &file) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootSTL(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL_F(TransportBufferRead)
+        inline enable_if_stl<S> FileReadRank(S &obj, const int rank, MEL::File &file) {
+            typedef typename S::value_type T;
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootSTL<T, F>(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> FileWriteAll(T &obj, MEL::File &file, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(obj), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg.packRootVar(obj);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_not_pointer_not_stl<T> FileWriteAll(T &obj, MEL::File &file, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize<T, HASH_MAP, F1>(obj), head = MEL::Deep::FileIndex_head(comm);
+            char *buffer = MEL::MemAlloc<char>(head + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + head, bytes);
+            msg. template packRootVar<T, F2>(obj);
+
+            MEL::Deep::FileIndex_write(buffer, bytes, file, comm);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> FileReadAll(T &obj, MEL::File &file, const Comm &comm) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T_F(TransportBufferRead)
+        inline enable_if_not_pointer_not_stl<T> FileReadAll(T &obj, MEL::File &file, const Comm &comm) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_readAll(bufferSize, file, comm);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootVar<T, F>(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> FileReadRank(T &obj, const int rank, MEL::File &file) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T_F(TransportBufferRead)
+        inline enable_if_not_pointer_not_stl<T> FileReadRank(T &obj, const int rank, MEL::File &file) {
+            int bufferSize;
+            char *buffer = MEL::Deep::FileIndex_read(rank, bufferSize, file);
+
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootVar<T, F>(obj);
+
+            MEL::MemFree(buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Memory Mapped File Write / Read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /// A deep file mapped into memory. Objects read from it point into the private mapping wherever their elements are trivially 
+        /// copyable and aligned, so pages are only read from disk when touched. Their pointers must not be freed individually
+        struct MappedFile {
+            char *base;
+            size_t length;
+            std::vector<void*> owned;
+
+            MappedFile() : base(nullptr), length(0) {};
+        };
+
+        /// \cond HIDE
+        /// MappedFileWrite stores a magic number and the buffer size, padded so the packed buffer starts on a cache line. 
+        /// Within the buffer every array is padded to the alignment of its elements so it can be used in place
+        static constexpr uint64_t MAPPED_FILE_MAGIC  = 0x50454544204c454dULL;
+        static constexpr int      MAPPED_FILE_HEADER = 64;
+
+        inline void MappedFile_write(char *buffer, const int bufferSize, const std::string &path) {
+            const uint64_t header[2] = { MAPPED_FILE_MAGIC, (uint64_t) bufferSize };
+            std::memset(buffer, 0, MAPPED_FILE_HEADER);
+            std::memcpy(buffer, header, sizeof(header));
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file.good()) MEL::Abort(-1, "MEL::Deep::MappedFileWrite Could not open file!");
+            file.write(buffer, MAPPED_FILE_HEADER + bufferSize);
+        };
+
+        inline void MappedFile_open(MappedFile &map, const std::string &path) {
+#ifndef _WIN32
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) MEL::Abort(-1, "MEL::Deep::MappedFileRead Could not open file!");
+
+            struct stat st;
+            if (fstat(fd, &st) != 0) MEL::Abort(-1, "MEL::Deep::MappedFileRead Could not stat file!");
+            map.length = st.st_size;
+
+            void *base = mmap(nullptr, map.length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (base == MAP_FAILED) MEL::Abort(-1, "MEL::Deep::MappedFileRead Could not map file!");
+            map.base = (char*) base;
+#else
+            /// No mmap, read the file into one allocation so at least the nodes are not allocated individually
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file.good()) MEL::Abort(-1, "MEL::Deep::MappedFileRead Could not open file!");
+            map.length = file.tellg();
+            map.base   = MEL::MemAlloc<char>(map.length);
+            file.seekg(0);
+            file.read(map.base, map.length);
+#endif
+        };
+
+        inline char* MappedFile_buffer(MappedFile &map, int &bufferSize, bool &aligned) {
+            uint64_t header[2] = { 0, 0 };
+            if (map.length >= sizeof(header)) std::memcpy(header, map.base, sizeof(header));
+
+            aligned = (header[0] == MAPPED_FILE_MAGIC);
+            if (aligned) {
+                if ((MAPPED_FILE_HEADER + header[1]) > map.length) MEL::Abort(-1, "MEL::Deep::MappedFileRead File is too short!");
+                bufferSize = (int) header[1];
+                return map.base + MAPPED_FILE_HEADER;
+            }
+
+            /// Otherwise a file from BufferedFileWrite, the buffer size and address precede the buffer. Its elements are 
+            /// rarely aligned so most will be copied out of the mapping
+            const size_t offset = sizeof(int) + sizeof(uint64_t);
+            if (map.length < offset) MEL::Abort(-1, "MEL::Deep::MappedFileRead File is too short!");
+            std::memcpy(&bufferSize, map.base, sizeof(int));
+            if (bufferSize < 0 || (offset + bufferSize) > map.length) MEL::Abort(-1, "MEL::Deep::MappedFileRead File is too short!");
+            return map.base + offset;
+        };
+        /// \endcond
+
+        /// Release the mapping and every element that had to be copied out of it. Objects read from the mapping must not be used afterwards
+        inline void MappedFileFree(MappedFile &map) {
+            for (auto ptr : map.owned) MEL::MemFree(ptr);
+            map.owned.clear();
+#ifndef _WIN32
+            if (map.base != nullptr) munmap(map.base, map.length);
+#else
+            if (map.base != nullptr) MEL::MemFree(map.base);
+#endif
+            map.base   = nullptr;
+            map.length = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> MappedFileWrite(P &ptr, int const &len, const std::string &path) {
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg.packRootVar(len);
+                msg.packRootPtr(ptr, len);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_pointer<P> MappedFileWrite(P &ptr, int const &len, const std::string &path) {
+            typedef typename std::remove_pointer<P>::type T;
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg.packRootVar(len);
+                msg. template packRootPtr<T, F1>(ptr, len);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F2>(ptr, len);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P, MappedFile> MappedFileRead(P &ptr, int &len, const std::string &path) {
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            return map;
+        };
+
+        TEMPLATE_P_F(TransportBufferMap)
+        inline enable_if_pointer<P, MappedFile> MappedFileRead(P &ptr, int &len, const std::string &path) {
+            typedef typename std::remove_pointer<P>::type T;
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+
+            return map;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        TEMPLATE_P
+        inline enable_if_pointer<P> MappedFileWrite(P &ptr, const std::string &path) {
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg.packRootPtr(ptr);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg.packRootPtr(ptr);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_pointer<P> MappedFileWrite(P &ptr, const std::string &path) {
+            typedef typename std::remove_pointer<P>::type T;
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg. template packRootPtr<T, F1>(ptr);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg. template packRootPtr<T, F2>(ptr);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_P
+        inline enable_if_pointer<P, MappedFile> MappedFileRead(P &ptr, const std::string &path) {
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg.packRootPtr(ptr);
+
+            return map;
+        };
+
+        TEMPLATE_P_F(TransportBufferMap)
+        inline enable_if_pointer<P, MappedFile> MappedFileRead(P &ptr, const std::string &path) {
+            typedef typename std::remove_pointer<P>::type T;
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg. template packRootPtr<T, F>(ptr);
+
+            return map;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL
+
+        TEMPLATE_STL
+        inline enable_if_stl<S> MappedFileWrite(S &obj, const std::string &path) {
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg.packRootSTL(obj);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg.packRootSTL(obj);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_stl<S> MappedFileWrite(S &obj, const std::string &path) {
+            typedef typename S::value_type T;
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg. template packRootSTL<T, F1>(obj);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg. template packRootSTL<T, F2>(obj);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_STL
+        inline enable_if_stl<S, MappedFile> MappedFileRead(S &obj, const std::string &path) {
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg.packRootSTL(obj);
+
+            return map;
+        };
+
+        TEMPLATE_STL_F(TransportBufferMap)
+        inline enable_if_stl<S, MappedFile> MappedFileRead(S &obj, const std::string &path) {
+            typedef typename S::value_type T;
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg. template packRootSTL<T, F>(obj);
+
+            return map;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T> MappedFileWrite(T &obj, const std::string &path) {
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg.packRootVar(obj);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg.packRootVar(obj);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T_F2(NoTransport, TransportBufferWrite)
+        inline enable_if_not_pointer_not_stl<T> MappedFileWrite(T &obj, const std::string &path) {
+            /// Size with the same padding the aligned writer inserts
+            int bytes;
+            {
+                Message<NoTransport, HASH_MAP> msg(0, true);
+                msg. template packRootVar<T, F1>(obj);
+                bytes = msg.getOffset();
+            }
+            char *buffer = MEL::MemAlloc<char>(MAPPED_FILE_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + MAPPED_FILE_HEADER, bytes, true);
+            msg. template packRootVar<T, F2>(obj);
+
+            MEL::Deep::MappedFile_write(buffer, bytes, path);
+            MEL::MemFree(buffer);
+        };
+
+        TEMPLATE_T
+        inline enable_if_not_pointer_not_stl<T, MappedFile> MappedFileRead(T &obj, const std::string &path) {
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg.packRootVar(obj);
+
+            return map;
+        };
+
+        TEMPLATE_T_F(TransportBufferMap)
+        inline enable_if_not_pointer_not_stl<T, MappedFile> MappedFileRead(T &obj, const std::string &path) {
+            MappedFile map;
+            MEL::Deep::MappedFile_open(map, path);
+
+            int bufferSize;
+            bool aligned;
+            char *buffer = MEL::Deep::MappedFile_buffer(map, bufferSize, aligned);
+            Message<TransportBufferMap, HASH_MAP> msg(buffer, bufferSize, map.owned, aligned);
+            msg. template packRootVar<T, F>(obj);
+
+            return map;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Compressed Send / Recv / Bcast / File Write / File Read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /// \cond HIDE
+        /// A frame is the codec id, or 0 if stored raw, and the packed size, followed by the compressed or raw packed buffer
+        static constexpr int COMPRESS_HEADER      = 2 * sizeof(int);
+        static constexpr int COMPRESS_MIN_SIZE    = 1 << 10;
+        static constexpr int COMPRESS_SAMPLE_SIZE = 1 << 16;
+
+        /// buffer holds COMPRESS_HEADER free bytes followed by bufferSize packed bytes. Returns buffer itself when compression does not pay
+        template<typename CODEC>
+        inline char* Compress_frame(char *buffer, const int bufferSize, int &frameSize) {
+            int header[2] = { 0, bufferSize };
+            char *frame   = buffer;
+            frameSize     = COMPRESS_HEADER + bufferSize;
+
+            if (bufferSize >= COMPRESS_MIN_SIZE) {
+                bool worthIt = true;
+                /// Large buffers must save an eighth on a leading sample before the whole buffer is compressed
+                if (bufferSize > 2 * COMPRESS_SAMPLE_SIZE) {
+                    std::vector<char> sample(COMPRESS_SAMPLE_SIZE);
+                    worthIt = CODEC::compress(buffer + COMPRESS_HEADER, COMPRESS_SAMPLE_SIZE, &sample[0], COMPRESS_SAMPLE_SIZE - COMPRESS_SAMPLE_SIZE / 8) >= 0;
+                }
+
+                if (worthIt) {
+                    /// The whole buffer must save at least a sixteenth
+                    const int cap = bufferSize - bufferSize / 16;
+                    char *compressed = MEL::MemAlloc<char>(COMPRESS_HEADER + cap);
+                    const int len = CODEC::compress(buffer + COMPRESS_HEADER, bufferSize, compressed + COMPRESS_HEADER, cap);
+                    if (len >= 0) {
+                        header[0] = CODEC::ID;
+                        frame     = compressed;
+                        frameSize = COMPRESS_HEADER + len;
+                    }
+                    else {
+                        MEL::MemFree(compressed);
+                    }
+                }
+            }
+            std::memcpy(frame, header, COMPRESS_HEADER);
+            return frame;
+        };
+
+        inline void Compress_free(char *buffer, char *frame) {
+            if (frame != buffer) MEL::MemFree(frame);
+            MEL::MemFree(buffer);
+        };
+
+        /// Returns a pointer into frame when it was stored raw, otherwise a new buffer
+        template<typename CODEC>
+        inline char* Decompress_frame(char *frame, const int frameSize, int &bufferSize) {
+            if (frameSize < COMPRESS_HEADER) MEL::Abort(-1, "MEL::Deep::Compressed Frame is too short!");
+            int header[2];
+            std::memcpy(header, frame, COMPRESS_HEADER);
+            bufferSize = header[1];
+
+            if (header[0] == 0) {
+                if (bufferSize != frameSize - COMPRESS_HEADER) MEL::Abort(-1, "MEL::Deep::Compressed Frame size does not match!");
+                return frame + COMPRESS_HEADER;
+            }
+            if (header[0] != CODEC::ID) MEL::Abort(-1, "MEL::Deep::Compressed Frame was compressed with a different codec!");
+
+            char *buffer = MEL::MemAlloc<char>(bufferSize);
+            if (!CODEC::decompress(frame + COMPRESS_HEADER, frameSize - COMPRESS_HEADER, buffer, bufferSize)) 
+                MEL::Abort(-1, "MEL::Deep::Compressed Frame is corrupt!");
+            return buffer;
+        };
+
+        inline void Decompress_free(char *frame, char *buffer) {
+            if (buffer != frame + COMPRESS_HEADER) MEL::MemFree(buffer);
+            MEL::MemFree(frame);
+        };
+        /// \endcond
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer / Length
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedSend(P &ptr, int const &len, const int dst, const int tag, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(ptr, len);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_pointer<P> CompressedSend(P &ptr, int const &len, const int dst, const int tag, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr, len);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F2>(ptr, len);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedRecv(P &ptr, int &len, const int src, const int tag, const Comm &comm) {
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_pointer<P> CompressedRecv(P &ptr, int &len, const int src, const int tag, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedBcast(P &ptr, int &len, const int root, const Comm &comm) {
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize(ptr, len);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg.packRootVar(len);
+                msg.packRootPtr(ptr, len);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg.packRootVar(len);
+                msg.packRootPtr(ptr, len);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F3>
+        inline enable_if_pointer<P> CompressedBcast(P &ptr, int &len, const int root, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr, len);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg.packRootVar(len);
+                msg. template packRootPtr<T, F2>(ptr, len);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg.packRootVar(len);
+                msg. template packRootPtr<T, F3>(ptr, len);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedFileWrite(P &ptr, int const &len, MEL::File &file) {
+            const int bytes = MEL::Deep::BufferSize(ptr, len);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_pointer<P> CompressedFileWrite(P &ptr, int const &len, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr, len);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F2>(ptr, len);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedFileRead(P &ptr, int &len, MEL::File &file) {
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg.packRootPtr(ptr, len);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_pointer<P> CompressedFileRead(P &ptr, int &len, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(len);
+            msg. template packRootPtr<T, F>(ptr, len);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pointer
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedSend(P &ptr, const int dst, const int tag, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(ptr);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootPtr(ptr);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_pointer<P> CompressedSend(P &ptr, const int dst, const int tag, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootPtr<T, F2>(ptr);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedRecv(P &ptr, const int src, const int tag, const Comm &comm) {
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootPtr(ptr);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_pointer<P> CompressedRecv(P &ptr, const int src, const int tag, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootPtr<T, F>(ptr);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedBcast(P &ptr, const int root, const Comm &comm) {
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize(ptr);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg.packRootPtr(ptr);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg.packRootPtr(ptr);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F3>
+        inline enable_if_pointer<P> CompressedBcast(P &ptr, const int root, const Comm &comm) {
+            typedef typename std::remove_pointer<P>::type T;
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg. template packRootPtr<T, F2>(ptr);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg. template packRootPtr<T, F3>(ptr);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedFileWrite(P &ptr, MEL::File &file) {
+            const int bytes = MEL::Deep::BufferSize(ptr);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootPtr(ptr);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_pointer<P> CompressedFileWrite(P &ptr, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            const int bytes = MEL::Deep::BufferSize<P, HASH_MAP, F1>(ptr);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootPtr<T, F2>(ptr);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename P, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_pointer<P> CompressedFileRead(P &ptr, MEL::File &file) {
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootPtr(ptr);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename P, typename HASH_MAP, DEEP_FUNCTOR<typename std::remove_pointer<P>::type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_pointer<P> CompressedFileRead(P &ptr, MEL::File &file) {
+            typedef typename std::remove_pointer<P>::type T;
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootPtr<T, F>(ptr);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // STL
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename S, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_stl<S> CompressedSend(S &obj, const int dst, const int tag, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootSTL(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename S, typename HASH_MAP, DEEP_FUNCTOR<typename S::value_type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename S::value_type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_stl<S> CompressedSend(S &obj, const int dst, const int tag, const Comm &comm) {
+            typedef typename S::value_type T;
+            const int bytes = MEL::Deep::BufferSize<S, HASH_MAP, F1>(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootSTL<T, F2>(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename S, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_stl<S> CompressedRecv(S &obj, const int src, const int tag, const Comm &comm) {
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootSTL(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename S, typename HASH_MAP, DEEP_FUNCTOR<typename S::value_type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_stl<S> CompressedRecv(S &obj, const int src, const int tag, const Comm &comm) {
+            typedef typename S::value_type T;
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootSTL<T, F>(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename S, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_stl<S> CompressedBcast(S &obj, const int root, const Comm &comm) {
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize(obj);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg.packRootSTL(obj);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg.packRootSTL(obj);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC, typename S, typename HASH_MAP, DEEP_FUNCTOR<typename S::value_type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename S::value_type, TransportBufferWrite, HASH_MAP> F2, DEEP_FUNCTOR<typename S::value_type, TransportBufferRead, HASH_MAP> F3>
+        inline enable_if_stl<S> CompressedBcast(S &obj, const int root, const Comm &comm) {
+            typedef typename S::value_type T;
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize<S, HASH_MAP, F1>(obj);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg. template packRootSTL<T, F2>(obj);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg. template packRootSTL<T, F3>(obj);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename S, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_stl<S> CompressedFileWrite(S &obj, MEL::File &file) {
+            const int bytes = MEL::Deep::BufferSize(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootSTL(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename S, typename HASH_MAP, DEEP_FUNCTOR<typename S::value_type, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<typename S::value_type, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_stl<S> CompressedFileWrite(S &obj, MEL::File &file) {
+            typedef typename S::value_type T;
+            const int bytes = MEL::Deep::BufferSize<S, HASH_MAP, F1>(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootSTL<T, F2>(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename S, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_stl<S> CompressedFileRead(S &obj, MEL::File &file) {
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootSTL(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename S, typename HASH_MAP, DEEP_FUNCTOR<typename S::value_type, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_stl<S> CompressedFileRead(S &obj, MEL::File &file) {
+            typedef typename S::value_type T;
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootSTL<T, F>(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Object
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_not_pointer_not_stl<T> CompressedSend(T &obj, const int dst, const int tag, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename T, typename HASH_MAP, DEEP_FUNCTOR<T, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<T, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_not_pointer_not_stl<T> CompressedSend(T &obj, const int dst, const int tag, const Comm &comm) {
+            const int bytes = MEL::Deep::BufferSize<T, HASH_MAP, F1>(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootVar<T, F2>(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Send(frame, frameSize, dst, tag, comm);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_not_pointer_not_stl<T> CompressedRecv(T &obj, const int src, const int tag, const Comm &comm) {
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename T, typename HASH_MAP, DEEP_FUNCTOR<T, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_not_pointer_not_stl<T> CompressedRecv(T &obj, const int src, const int tag, const Comm &comm) {
+            int frameSize;
+            char *frame = MEL::Deep::Buffered_recv(frameSize, src, tag, comm);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootVar<T, F>(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_not_pointer_not_stl<T> CompressedBcast(T &obj, const int root, const Comm &comm) {
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize(obj);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg.packRootVar(obj);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg.packRootVar(obj);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC, typename T, typename HASH_MAP, DEEP_FUNCTOR<T, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<T, TransportBufferWrite, HASH_MAP> F2, DEEP_FUNCTOR<T, TransportBufferRead, HASH_MAP> F3>
+        inline enable_if_not_pointer_not_stl<T> CompressedBcast(T &obj, const int root, const Comm &comm) {
+            if (MEL::CommRank(comm) == root) {
+                const int bytes = MEL::Deep::BufferSize<T, HASH_MAP, F1>(obj);
+                char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+                Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+                msg. template packRootVar<T, F2>(obj);
+
+                int frameSize;
+                char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+                MEL::Deep::Compress_free(buffer, frame);
+            }
+            else {
+                int frameSize;
+                char *frame = nullptr;
+                MEL::Deep::Bcast(frame, frameSize, root, comm);
+
+                int bufferSize;
+                char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+                Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+                msg. template packRootVar<T, F3>(obj);
+
+                MEL::Deep::Decompress_free(frame, buffer);
+            }
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_not_pointer_not_stl<T> CompressedFileWrite(T &obj, MEL::File &file) {
+            const int bytes = MEL::Deep::BufferSize(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg.packRootVar(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC, typename T, typename HASH_MAP, DEEP_FUNCTOR<T, NoTransport, HASH_MAP> F1, DEEP_FUNCTOR<T, TransportBufferWrite, HASH_MAP> F2>
+        inline enable_if_not_pointer_not_stl<T> CompressedFileWrite(T &obj, MEL::File &file) {
+            const int bytes = MEL::Deep::BufferSize<T, HASH_MAP, F1>(obj);
+            char *buffer = MEL::MemAlloc<char>(COMPRESS_HEADER + bytes);
+            Message<TransportBufferWrite, HASH_MAP> msg(buffer + COMPRESS_HEADER, bytes);
+            msg. template packRootVar<T, F2>(obj);
+
+            int frameSize;
+            char *frame = MEL::Deep::Compress_frame<CODEC>(buffer, bytes, frameSize);
+            MEL::Deep::FileWrite(frame, frameSize, file);
+            MEL::Deep::Compress_free(buffer, frame);
+        };
+
+        template<typename CODEC = MEL::Deep::LZCodec, typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline enable_if_not_pointer_not_stl<T> CompressedFileRead(T &obj, MEL::File &file) {
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg.packRootVar(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
+        template<typename CODEC, typename T, typename HASH_MAP, DEEP_FUNCTOR<T, TransportBufferRead, HASH_MAP> F>
+        inline enable_if_not_pointer_not_stl<T> CompressedFileRead(T &obj, MEL::File &file) {
+            int frameSize;
+            char *frame = nullptr;
+            MEL::Deep::FileRead(frame, frameSize, file);
+
+            int bufferSize;
+            char *buffer = MEL::Deep::Decompress_frame<CODEC>(frame, frameSize, bufferSize);
+            Message<TransportBufferRead, HASH_MAP> msg(buffer, bufferSize);
+            msg. template packRootVar<T, F>(obj);
+
+            MEL::Deep::Decompress_free(frame, buffer);
+        };
+
 #undef TEMPLATE_STL
 #undef TEMPLATE_T
 #undef TEMPLATE_P
@@ -0,0 +1,262 @@
+/*
+The MIT License(MIT)
+
+Copyright(c) 2016 Joss Whittle
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include "MEL.hpp"
+#include "MEL_deepcopy.hpp"
+
+#include <functional>
+#include <vector>
+
+/**
+* \file MEL_rpc.hpp
+*/
+
+namespace MEL {
+    namespace RPC {
+
+        /**
+         * \defgroup RPC Active Messages
+         * Remote invocation of registered handlers with deep copied arguments, progressed by polling
+         */
+
+        /// \cond HIDE
+        struct Engine {
+            typedef std::function<void(const int, char*, const int)> Handler;
+
+            struct Pending {
+                Request rq;
+                char *buffer;
+            };
+
+            /// Members
+            Comm comm;
+            int rank, size, tag, received;
+            std::vector<int> sentTo;
+            std::vector<Pending> pending;
+            std::vector<Handler> handlers;
+
+            Engine() : comm(MEL::Comm::COMM_NULL), rank(0), size(0), tag(0), received(0) {};
+        };
+
+        template<typename S, typename TRANSPORT_METHOD, typename HASH_MAP>
+        inline MEL::Deep::enable_if_stl<S> Engine_pack(MEL::Deep::Message<TRANSPORT_METHOD, HASH_MAP> &msg, S &obj) {
+            msg.packRootSTL(obj);
+        };
+
+        template<typename T, typename TRANSPORT_METHOD, typename HASH_MAP>
+        inline MEL::Deep::enable_if_not_pointer_not_stl<T> Engine_pack(MEL::Deep::Message<TRANSPORT_METHOD, HASH_MAP> &msg, T &obj) {
+            msg.packRootVar(obj);
+        };
+        /// \endcond
+
+        /**
+         * \ingroup RPC
+         * Create an active message engine across a comm world
+         *
+         * \param[in] tag		The tag used for all active messages. Must not be used for any other traffic on comm
+         * \param[in] comm		The comm world to invoke handlers within
+         * \return				Returns the engine
+         */
+        inline Engine EngineCreate(const int tag, const Comm &comm) {
+            Engine engine;
+            engine.comm = comm;
+            engine.rank = MEL::CommRank(comm);
+            engine.size = MEL::CommSize(comm);
+            engine.tag  = tag;
+            engine.sentTo.resize(engine.size, 0);
+            return engine;
+        };
+
+        /**
+         * \ingroup RPC
+         * Free an active message engine, waiting on any invocations still in flight
+         *
+         * \param[in] engine	The engine to free
+         */
+        inline void EngineFree(Engine &engine) {
+            for (auto &p : engine.pending) {
+                MEL::Wait(p.rq);
+                MEL::MemFree(p.buffer);
+            }
+            engine.pending.clear();
+            engine.handlers.clear();
+        };
+
+        /**
+         * \ingroup RPC
+         * Register a handler taking no arguments. Handlers must be registered in the same order on every process
+         *
+         * \param[in] engine	The engine to register with
+         * \param[in] func		Function taking the rank of the invoking process
+         * \return				Returns the handler id
+         */
+        inline int Register(Engine &engine, const std::function<void(const int)> &func) {
+            engine.handlers.push_back([func](const int src, char*, const int) {
+                func(src);
+            });
+            return engine.handlers.size() - 1;
+        };
+
+        /**
+         * \ingroup RPC
+         * Register a handler taking a deep copied argument. Any memory allocated while unpacking the argument
+         * is owned by the handler. Handlers must be registered in the same order on every process
+         *
+         * \param[in] engine	The engine to register with
+         * \param[in] func		Function taking the rank of the invoking process and the argument
+         * \return				Returns the handler id
+         */
+        template<typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline int Register(Engine &engine, const std::function<void(const int, T&)> &func) {
+            engine.handlers.push_back([func](const int src, char *buffer, const int len) {
+                T obj;
+                MEL::Deep::Message<MEL::Deep::TransportBufferRead, HASH_MAP> msg(buffer, len);
+                Engine_pack(msg, obj);
+                func(src, obj);
+            });
+            return engine.handlers.size() - 1;
+        };
+
+        /// \cond HIDE
+        inline void Engine_send(Engine &engine, const int dst, char *buffer, const int len) {
+            Engine::Pending p;
+            p.buffer = buffer;
+            MEL::Isend(buffer, len, MEL::Datatype::CHAR, dst, engine.tag, engine.comm, p.rq);
+            engine.pending.push_back(p);
+            ++engine.sentTo[dst];
+        };
+        /// \endcond
+
+        /**
+         * \ingroup RPC
+         * Invoke a handler taking no arguments on a remote process. Returns without waiting for the handler to run
+         *
+         * \param[in] engine	The engine to invoke through
+         * \param[in] dst		The rank of the process to run the handler
+         * \param[in] id		The id of the handler to run
+         */
+        inline void Invoke(Engine &engine, const int dst, const int id) {
+            char *buffer = MEL::MemAlloc<char>(sizeof(int));
+            std::memcpy(buffer, &id, sizeof(int));
+            Engine_send(engine, dst, buffer, sizeof(int));
+        };
+
+        /**
+         * \ingroup RPC
+         * Invoke a handler on a remote process with a deep copied argument. Returns without waiting for the handler to run
+         *
+         * \param[in] engine	The engine to invoke through
+         * \param[in] dst		The rank of the process to run the handler
+         * \param[in] id		The id of the handler to run
+         * \param[in] obj		The argument to deep copy to the handler
+         */
+        template<typename T, typename HASH_MAP = MEL::Deep::PointerHashMap>
+        inline void Invoke(Engine &engine, const int dst, const int id, T &obj) {
+            int len;
+            {
+                MEL::Deep::Message<MEL::Deep::NoTransport, HASH_MAP> msg(0);
+                Engine_pack(msg, obj);
+                len = msg.getOffset();
+            }
+
+            char *buffer = MEL::MemAlloc<char>(sizeof(int) + len);
+            std::memcpy(buffer, &id, sizeof(int));
+            {
+                MEL::Deep::Message<MEL::Deep::TransportBufferWrite, HASH_MAP> msg(buffer + sizeof(int), len);
+                Engine_pack(msg, obj);
+            }
+            Engine_send(engine, dst, buffer, sizeof(int) + len);
+        };
+
+        /**
+         * \ingroup RPC
+         * Make progress on an active message engine. Retires completed invocations, and runs the handler for each
+         * invocation that has arrived
+         *
+         * \param[in] engine	The engine to progress
+         * \return				Returns the number of handlers run
+         */
+        inline int Progress(Engine &engine) {
+            /// Retire completed sends
+            int active = 0;
+            for (int i = 0; i < (int) engine.pending.size(); ++i) {
+                if (MEL::Test(engine.pending[i].rq)) MEL::MemFree(engine.pending[i].buffer);
+                else                                 engine.pending[active++] = engine.pending[i];
+            }
+            engine.pending.resize(active);
+
+            int run = 0;
+            while (true) {
+#ifdef MEL_3
+                MEL::Message message;
+                auto probe = MEL::Improbe(MEL::ANY_SOURCE, engine.tag, engine.comm, message);
+#else
+                auto probe = MEL::Iprobe(MEL::ANY_SOURCE, engine.tag, engine.comm);
+#endif
+                if (!probe.first) break;
+
+                const int src = probe.second.MPI_SOURCE,
+                          len = MEL::ProbeGetCount<char>(probe.second);
+                char *buffer  = MEL::MemAlloc<char>(len);
+#ifdef MEL_3
+                MEL::Mrecv(buffer, len, MEL::Datatype::CHAR, message);
+#else
+                MEL::Recv(buffer, len, MEL::Datatype::CHAR, src, engine.tag, engine.comm);
+#endif
+                ++engine.received;
+
+                int id;
+                std::memcpy(&id, buffer, sizeof(int));
+                if (id < 0 || id >= (int) engine.handlers.size()) MEL::Abort(-1, "RPC::Progress Unknown handler id!");
+                engine.handlers[id](src, buffer + sizeof(int), len - sizeof(int));
+
+                MEL::MemFree(buffer);
+                ++run;
+            }
+            return run;
+        };
+
+        /**
+         * \ingroup RPC
+         * Progress until every invocation issued by any process, including those issued by handlers while draining,
+         * has been run. Collective across the comm world the engine was created in
+         *
+         * \param[in] engine	The engine to synchronize
+         */
+        inline void Quiesce(Engine &engine) {
+            /// Invocations are sent immediately so there is nothing to flush or left buffered
+            MEL::Quiesce_helper(engine.sentTo, engine.received, engine.rank, engine.comm, 
+                                []() {}, 
+                                [&engine]() { Progress(engine); }, 
+                                []() { return 0; });
+
+            for (auto &p : engine.pending) {
+                MEL::Wait(p.rq);
+                MEL::MemFree(p.buffer);
+            }
+            engine.pending.clear();
+        };
+    };
+};
@@ -946,6 +946,9 @@ int main(int argc, char *argv[]) {
 
     auto typeColour  = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, 3);
     auto typeFilm    = MEL::TypeCreateContiguous(MEL::Datatype::UNSIGNED_CHAR, wR * h); // Includes byte padding for BMP
+
+    /// Blocks of the same shape share committed types, only the edge blocks need new ones
+    auto typeCache   = MEL::TypeCacheCreate(8);
     
     /// Work distribution by blocks
     const int blockSize = 1 << 6, // 64
@@ -954,10 +957,24 @@ int main(int argc, char *argv[]) {
               vBlocks = ((h + blockSize - 1) & ~(blockSize - 1)) / blockSize,
               tBlocks = uBlocks * vBlocks;
     
+    /// Shared counter on root holding the index of the next block to be rendered
+    int *nextPtr = nullptr;
+    MEL::Win nextWin;
+    if (rank == 0) {
+        nextPtr = MEL::MemAlloc<int>(1);
+        *nextPtr = 0;
+        nextWin = MEL::WinCreate(nextPtr, 1, comm);
+    }
+    else {
+        nextWin = MEL::WinCreate(nextPtr, 0, comm);
+    }
+    MEL::WinLockAll(nextWin);
+
     /// ****************************************** ///
     /// Render the image block by block            ///
     /// ****************************************** ///
-    for (int localIndex = rank; localIndex < tBlocks; localIndex += size) {
+    for (int localIndex = MEL::FetchAndOp(1, MEL::Op::SUM, 0, 0, nextWin); localIndex < tBlocks; 
+             localIndex = MEL::FetchAndOp(1, MEL::Op::SUM, 0, 0, nextWin)) {
         std::cout << "Rank: " << std::setw(4) << rank << " Starting block " 
                               << std::setw(4) << (localIndex + 1) << " of " 
                               << std::setw(4) << tBlocks << std::endl;
@@ -968,9 +985,10 @@ int main(int argc, char *argv[]) {
                   bw = std::min(blockSize, w - bx), 
                   bh = std::min(blockSize, h - by);
 
-        /// Helper types for moving data
-        auto typeGlobalBlock = MEL::TypeCreateSubArray2D(MEL::Datatype::UNSIGNED_CHAR, bx * 3, by, bw * 3, bh, wR, h);
-        auto typeLocalBlock  = MEL::TypeCreateContiguous(typeColour, bw * bh);
+        /// Helper types for moving data, owned by the cache. The global block is placed by displacement so its type
+        /// only depends on the block shape
+        auto typeGlobalBlock = MEL::TypeCreateVector(typeCache, MEL::Datatype::UNSIGNED_CHAR, bh, bw * 3, wR);
+        auto typeLocalBlock  = MEL::TypeCreateContiguous(typeCache, typeColour, bw * bh);
 
         /// Allocate local image block
         unsigned char *blockPtr = MEL::MemAlloc<unsigned char>(bw * bh * 3);
@@ -987,14 +1005,14 @@ int main(int argc, char *argv[]) {
 
         /// Write local block to global image on root process using RMA one sided communication
         MEL::WinLockShared(filmWin, 0);
-        MEL::Put(blockPtr, 1, typeLocalBlock, 0, 1, typeGlobalBlock, 0, filmWin);
+        MEL::Put(blockPtr, 1, typeLocalBlock, (by * wR) + (bx * 3), 1, typeGlobalBlock, 0, filmWin);
         MEL::WinUnlock(filmWin, 0);
 
         /// Clean up
         MEL::MemFree(blockPtr);
-        MEL::TypeFree(typeGlobalBlock, typeLocalBlock);
     }
     
+    MEL::WinUnlockAll(nextWin);
     MEL::Barrier(comm);
 
     /// ****************************************** ///
@@ -1021,9 +1039,10 @@ int main(int argc, char *argv[]) {
     }
 
     /// Clean up
+    MEL::TypeCacheFree(typeCache);
     MEL::TypeFree(typeColour, typeFilm);
-    MEL::WinFree(filmWin);
-    MEL::MemFree(filmPtr);
+    MEL::WinFree(filmWin, nextWin);
+    MEL::MemFree(filmPtr, nextPtr);
     MEL::MemDestruct(scene);
 
     MEL::Finalize();
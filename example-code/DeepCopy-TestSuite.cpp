@@ -25,10 +25,18 @@ SOFTWARE.
 /// Run this test suite using mpirun -n 2 ./DeepCopy-TestSuite
 /// It will produce two output files "DeepCopy - Test - Rank <i> of 2.out" and ".err"
 /// for each process.
+/// Build with MEL_TEST_THREAD_MULTIPLE defined to initialize MPI with ThreadLevel::MULTIPLE, which also runs the
+/// progress thread tests. One sided tests are tagged [RMA] and can be skipped with the test spec ~[RMA]
+/// Tests of optional features run when the suite is built with the matching define, and the coroutine tests run when it
+/// is built as C++20. Every optional feature is covered by building and running the suite once as
+///     mpicxx -std=c++20 -DMEL_PROFILE -DMEL_TRACE -DMEL_COMM_MATRIX -DMEL_MEM_POOL
+/// once with -DMEL_NO_CHECK_ERROR_CODES, and once with -DMEL_TEST_THREAD_MULTIPLE
 
 #define  MEL_IMPLEMENTATION
 #include "MEL.hpp"
 #include "MEL_deepcopy.hpp"
+#include "MEL_rpc.hpp"
+#include "MEL_coro.hpp"
 
 /// This file depends on the "Catch" testing framework
 /// available here https://github.com/philsquared/Catch 
@@ -945,6 +953,2282 @@ TEST_CASE("STL File", "[STL File]") {
     }
 }
 
+TEST_CASE("Collective MEL::File", "[FileWriteAll][FileReadAll][FileReadRank]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    const int other = 1 - comm_rank;
+
+    SECTION("Non-Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("FileWriteAll a pointer/len payload") {
+            int *p = MEL::MemAlloc<int>(10 + comm_rank);
+            for (int i = 0; i < 10 + comm_rank; ++i) p[i] = comm_rank * 100 + i;
+
+            MEL::File file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+            MEL::Deep::FileWriteAll(p, 10 + comm_rank, file, comm);
+            MEL::FileClose(file);
+            MEL::MemFree(p);
+
+            int *q = nullptr, *r = nullptr, qlen = 0, rlen = 0;
+
+            file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+            MEL::Deep::FileReadAll(q, qlen, file, comm);
+            MEL::Deep::FileReadRank(r, rlen, other, file);
+            MEL::FileClose(file);
+
+            REQUIRE(qlen == 10 + comm_rank);
+            for (int i = 0; i < qlen; ++i) { REQUIRE(q[i] == comm_rank * 100 + i); }
+            REQUIRE(rlen == 10 + other);
+            for (int i = 0; i < rlen; ++i) { REQUIRE(r[i] == other * 100 + i); }
+            MEL::MemFree(q);
+            MEL::MemFree(r);
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("FileWriteAll a std::vector payload") {
+            std::vector<int> p(10, comm_rank);
+
+            MEL::File file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+            MEL::Deep::FileWriteAll(p, file, comm);
+            MEL::FileClose(file);
+
+            std::vector<int> q, r;
+
+            file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+            MEL::Deep::FileReadAll(q, file, comm);
+            MEL::Deep::FileReadRank(r, other, file);
+            MEL::FileClose(file);
+
+            REQUIRE(q == std::vector<int>(10, comm_rank));
+            REQUIRE(r == std::vector<int>(10, other));
+        }
+
+        MEL::Barrier(comm);
+
+    }
+
+    SECTION("Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("FileWriteAll a pointer payload") {
+            TestObject *p = MEL::MemConstruct<TestObject>(10 + comm_rank);
+
+            MEL::File file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+            MEL::Deep::FileWriteAll(p, file, comm);
+            MEL::FileClose(file);
+            MEL::MemFree(p);
+
+            TestObject *q = nullptr, *r = nullptr;
+
+            file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+            MEL::Deep::FileReadAll(q, file, comm);
+            MEL::Deep::FileReadRank(r, other, file);
+            MEL::FileClose(file);
+
+            REQUIRE(*q == TestObject(10 + comm_rank));
+            REQUIRE(*r == TestObject(10 + other));
+            MEL::MemFree(q);
+            MEL::MemFree(r);
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("FileWriteAll an object payload") {
+            TestObject p(42 + comm_rank);
+
+            MEL::File file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+            MEL::Deep::FileWriteAll(p, file, comm);
+            MEL::FileClose(file);
+
+            TestObject q, r;
+
+            file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+            MEL::Deep::FileReadAll(q, file, comm);
+            MEL::Deep::FileReadRank(r, other, file);
+            MEL::FileClose(file);
+
+            REQUIRE(q == TestObject(42 + comm_rank));
+            REQUIRE(r == TestObject(42 + other));
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("FileWriteAll a std::list payload") {
+            std::list<TestObject> p;
+            for (int i = 0; i < 10 + comm_rank; ++i) p.push_back(TestObject(i));
+
+            MEL::File file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+            MEL::Deep::FileWriteAll(p, file, comm);
+            MEL::FileClose(file);
+
+            std::list<TestObject> q, r;
+
+            file = MEL::FileOpen(comm, "test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+            MEL::Deep::FileReadAll(q, file, comm);
+            MEL::Deep::FileReadRank(r, other, file);
+            MEL::FileClose(file);
+
+            REQUIRE(q.size() == (size_t) (10 + comm_rank));
+            REQUIRE(r.size() == (size_t) (10 + other));
+            auto it = r.begin();
+            for (int i = 0; i < 10 + other; ++i) { REQUIRE(*it++ == TestObject(i)); }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+}
+
+TEST_CASE("Compressed", "[CompressedSend][CompressedRecv][CompressedBcast][CompressedFile]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Non-Deep") {
+
+        SECTION("CompressedSend a compressible pointer/len payload") {
+            if (comm_rank == 0) {
+                int *p = MEL::MemAlloc<int>(10000);
+                for (int i = 0; i < 10000; ++i) p[i] = i % 16;
+                MEL::Deep::CompressedSend(p, 10000, 1, 0, comm);
+                MEL::MemFree(p);
+            }
+            else if (comm_rank == 1) {
+                int *p = nullptr, len = 0;
+                MEL::Deep::CompressedRecv(p, len, 0, 0, comm);
+                REQUIRE(len == 10000);
+                for (int i = 0; i < 10000; ++i) { REQUIRE(p[i] == i % 16); }
+                MEL::MemFree(p);
+            }
+        }
+
+        SECTION("CompressedSend an incompressible pointer/len payload") {
+            if (comm_rank == 0) {
+                unsigned int *p = MEL::MemAlloc<unsigned int>(1000);
+                for (int i = 0; i < 1000; ++i) p[i] = (unsigned int) i * 2654435761u;
+                MEL::Deep::CompressedSend(p, 1000, 1, 0, comm);
+                MEL::MemFree(p);
+            }
+            else if (comm_rank == 1) {
+                unsigned int *p = nullptr;
+                int len = 0;
+                MEL::Deep::CompressedRecv(p, len, 0, 0, comm);
+                REQUIRE(len == 1000);
+                for (int i = 0; i < 1000; ++i) { REQUIRE(p[i] == (unsigned int) i * 2654435761u); }
+                MEL::MemFree(p);
+            }
+        }
+
+        SECTION("CompressedBcast a std::vector payload") {
+            std::vector<int> p;
+            if (comm_rank == 0) p.assign(10000, 7);
+            MEL::Deep::CompressedBcast(p, 0, comm);
+            REQUIRE(p == std::vector<int>(10000, 7));
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("CompressedFile a pointer/len payload") {
+            if (comm_rank == 0) {
+                int *p = MEL::MemAlloc<int>(10000);
+                for (int i = 0; i < 10000; ++i) p[i] = i % 16;
+
+                MEL::File file = MEL::FileOpenIndividual("test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+                MEL::Deep::CompressedFileWrite(p, 10000, file);
+                MEL::FileClose(file);
+
+                MEL::MemFree(p);
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                int *p = nullptr, len = 0;
+
+                MEL::File file = MEL::FileOpenIndividual("test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+                MEL::Deep::CompressedFileRead(p, len, file);
+                MEL::FileClose(file);
+
+                REQUIRE(len == 10000);
+                for (int i = 0; i < 10000; ++i) { REQUIRE(p[i] == i % 16); }
+                MEL::MemFree(p);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+
+    SECTION("Deep") {
+
+        SECTION("CompressedSend a pointer payload") {
+            if (comm_rank == 0) {
+                TestObject *p = MEL::MemConstruct<TestObject>(1000);
+                MEL::Deep::CompressedSend(p, 1, 0, comm);
+                MEL::MemFree(p);
+            }
+            else if (comm_rank == 1) {
+                TestObject *p = nullptr;
+                MEL::Deep::CompressedRecv(p, 0, 0, comm);
+                REQUIRE(*p == TestObject(1000));
+                MEL::MemFree(p);
+            }
+        }
+
+        SECTION("CompressedSend an object payload") {
+            if (comm_rank == 0) {
+                TestObject p(42);
+                MEL::Deep::CompressedSend(p, 1, 0, comm);
+            }
+            else if (comm_rank == 1) {
+                TestObject p;
+                MEL::Deep::CompressedRecv(p, 0, 0, comm);
+                REQUIRE(p == TestObject(42));
+            }
+        }
+
+        SECTION("CompressedBcast a std::list payload") {
+            std::list<TestObject> p;
+            if (comm_rank == 0) for (int i = 0; i < 10; ++i) p.push_back(TestObject(i));
+            MEL::Deep::CompressedBcast(p, 0, comm);
+            REQUIRE(p.size() == 10);
+            auto it = p.begin();
+            for (int i = 0; i < 10; ++i) { REQUIRE(*it++ == TestObject(i)); }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("CompressedFile a std::vector payload") {
+            if (comm_rank == 0) {
+                std::vector<TestObject> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = TestObject(i);
+
+                MEL::File file = MEL::FileOpenIndividual("test.tmp", MEL::FileMode::CREATE | MEL::FileMode::WRONLY);
+                MEL::Deep::CompressedFileWrite(p, file);
+                MEL::FileClose(file);
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::vector<TestObject> p;
+
+                MEL::File file = MEL::FileOpenIndividual("test.tmp", MEL::FileMode::DELETE_ON_CLOSE | MEL::FileMode::RDONLY);
+                MEL::Deep::CompressedFileRead(p, file);
+                MEL::FileClose(file);
+
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == TestObject(i)); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("Stream File", "[Stream File]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Non-Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("Stream File a pointer/len payload spanning many buffers") {
+            if (comm_rank == 0) {
+                int *p = MEL::MemAlloc<int>(10000);
+                for (int i = 0; i < 10000; ++i) p[i] = i;
+
+                MEL::Deep::StreamFileWriter file("test.tmp", 4096);
+                MEL::Deep::FileWrite(p, 10000, file);
+                file.close();
+
+                MEL::MemFree(p);
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                int *p = nullptr, len = 0;
+
+                MEL::Deep::StreamFileReader file("test.tmp", 4096);
+                MEL::Deep::FileRead(p, len, file);
+                file.close();
+                std::remove("test.tmp");
+
+                REQUIRE(len == 10000);
+                for (int i = 0; i < 10000; ++i) { REQUIRE(p[i] == i); }
+                MEL::MemFree(p);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("Stream File a std::vector payload with direct IO and no background thread") {
+            if (comm_rank == 0) {
+                std::vector<int> p(10000);
+                for (int i = 0; i < 10000; ++i) p[i] = i;
+
+                MEL::Deep::StreamFileWriter file("test.tmp", 4096, true, false);
+                MEL::Deep::FileWrite(p, file);
+                file.close();
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::vector<int> p;
+
+                MEL::Deep::StreamFileReader file("test.tmp", 4096, true, false);
+                MEL::Deep::FileRead(p, file);
+                file.close();
+                std::remove("test.tmp");
+
+                REQUIRE(p.size() == 10000);
+                for (int i = 0; i < 10000; ++i) { REQUIRE(p[i] == i); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+
+    SECTION("Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("Stream File a pointer payload") {
+            if (comm_rank == 0) {
+                TestObject *p = MEL::MemConstruct<TestObject>(10000);
+
+                MEL::Deep::StreamFileWriter file("test.tmp", 4096);
+                MEL::Deep::FileWrite(p, file);
+                file.close();
+
+                MEL::MemFree(p);
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                TestObject *p = nullptr;
+
+                MEL::Deep::StreamFileReader file("test.tmp", 4096);
+                MEL::Deep::FileRead(p, file);
+                file.close();
+                std::remove("test.tmp");
+
+                REQUIRE(*p == TestObject(10000));
+                MEL::MemFree(p);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("Stream File a std::list payload") {
+            if (comm_rank == 0) {
+                std::list<TestObject> p;
+                for (int i = 0; i < 10; ++i) p.push_back(TestObject(i));
+
+                MEL::Deep::StreamFileWriter file("test.tmp");
+                MEL::Deep::FileWrite(p, file);
+                file.close();
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::list<TestObject> p;
+
+                MEL::Deep::StreamFileReader file("test.tmp");
+                MEL::Deep::FileRead(p, file);
+                file.close();
+                std::remove("test.tmp");
+
+                REQUIRE(p.size() == 10);
+                auto it = p.begin();
+                for (int i = 0; i < 10; ++i) { REQUIRE(*it++ == TestObject(i)); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+}
+#endif
+
+TEST_CASE("External File", "[External File]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Non-Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("External File a pointer/len payload") {
+            if (comm_rank == 0) {
+                double *p = MEL::MemAlloc<double>(10);
+                for (int i = 0; i < 10; ++i) p[i] = i * 0.5;
+
+                std::ofstream file("test.tmp", std::ios::out | std::ios::binary);
+                file.clear();
+                MEL::Deep::ExternalFileWrite(p, 10, file);
+                file.close();
+
+                MEL::MemFree(p);
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                double *p = nullptr;
+                int len = 0;
+
+                std::ifstream file("test.tmp", std::ios::in | std::ios::binary);
+                MEL::Deep::ExternalFileRead(p, len, file);
+                file.close();
+
+                REQUIRE(len == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i * 0.5); }
+                MEL::MemFree(p);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("External File writes the length big endian") {
+            if (comm_rank == 0) {
+                std::vector<int> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = i;
+
+                std::ofstream file("test.tmp", std::ios::out | std::ios::binary);
+                file.clear();
+                MEL::Deep::ExternalFileWrite(p, file);
+                file.close();
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                unsigned char head[4];
+
+                std::ifstream raw("test.tmp", std::ios::in | std::ios::binary);
+                raw.read((char*) head, 4);
+                raw.close();
+
+                REQUIRE(head[0] == 0);
+                REQUIRE(head[1] == 0);
+                REQUIRE(head[2] == 0);
+                REQUIRE(head[3] == 10);
+
+                std::vector<int> p;
+
+                std::ifstream file("test.tmp", std::ios::in | std::ios::binary);
+                MEL::Deep::ExternalFileRead(p, file);
+                file.close();
+
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("External File writes the root address as 64 bits big endian") {
+            if (comm_rank == 0) {
+                int *p = MEL::MemAlloc<int>(3);
+                for (int i = 0; i < 3; ++i) p[i] = i;
+                const uint64_t addr = (uint64_t) (uintptr_t) p;
+
+                std::ofstream file("test.tmp", std::ios::out | std::ios::binary);
+                file.clear();
+                MEL::Deep::ExternalFileWrite(p, 3, file);
+                file.close();
+                MEL::MemFree(p);
+
+                unsigned char head[12];
+                std::ifstream raw("test.tmp", std::ios::in | std::ios::binary | std::ios::ate);
+                REQUIRE(raw.tellg() == (std::streamoff) (4 + 8 + 3 * 4));
+                raw.seekg(0);
+                raw.read((char*) head, 12);
+                raw.close();
+
+                for (int i = 0; i < 8; ++i) { REQUIRE(head[4 + i] == (unsigned char) (addr >> (8 * (7 - i)))); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+
+    SECTION("Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("External File an object payload") {
+            if (comm_rank == 0) {
+                TestObject p(42);
+
+                std::ofstream file("test.tmp", std::ios::out | std::ios::binary);
+                file.clear();
+                MEL::Deep::ExternalFileWrite(p, file);
+                file.close();
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                TestObject p;
+
+                std::ifstream file("test.tmp", std::ios::in | std::ios::binary);
+                MEL::Deep::ExternalFileRead(p, file);
+                file.close();
+
+                REQUIRE(p == TestObject(42));
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("External File a std::list payload") {
+            if (comm_rank == 0) {
+                std::list<TestObject> p;
+                for (int i = 0; i < 10; ++i) p.push_back(TestObject(i));
+
+                std::ofstream file("test.tmp", std::ios::out | std::ios::binary);
+                file.clear();
+                MEL::Deep::ExternalFileWrite(p, file);
+                file.close();
+
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::list<TestObject> p;
+
+                std::ifstream file("test.tmp", std::ios::in | std::ios::binary);
+                MEL::Deep::ExternalFileRead(p, file);
+                file.close();
+
+                REQUIRE(p.size() == 10);
+                auto it = p.begin();
+                for (int i = 0; i < 10; ++i) { REQUIRE(*it++ == TestObject(i)); }
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+}
+
+TEST_CASE("Buffered Send/Recv", "[BufferedSend][BufferedRecv]") {
+    
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Non-Deep") {
+
+        SECTION("BufferedSend a pointer/len payload") {
+            if (comm_rank == 0) {
+                int *p = MEL::MemAlloc<int>(10);
+                for (int i = 0; i < 10; ++i) p[i] = i;
+                MEL::Deep::BufferedSend(p, 10, 1, 0, comm);
+                MEL::MemFree(p);
+            }
+            else if (comm_rank == 1) {
+                int *p = nullptr, len = 0;
+                MEL::Deep::BufferedRecv(p, len, 0, 0, comm);
+                REQUIRE(len == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i); }
+                MEL::MemFree(p);
+            }
+        }
+
+        SECTION("BufferedSend a std::vector payload") {
+            if (comm_rank == 0) {
+                std::vector<int> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = i;
+                MEL::Deep::BufferedSend(p, 1, 0, comm);
+            }
+            else if (comm_rank == 1) {
+                std::vector<int> p;
+                MEL::Deep::BufferedRecv(p, 0, 0, comm);
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i); }
+            }
+        }
+
+        SECTION("BufferedSend a std::vector payload with an oversized buffer") {
+            if (comm_rank == 0) {
+                std::vector<int> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = i;
+                MEL::Deep::BufferedSend(p, 1, 0, comm, 4096);
+            }
+            else if (comm_rank == 1) {
+                std::vector<int> p;
+                MEL::Deep::BufferedRecv(p, 0, 0, comm);
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i); }
+            }
+        }
+    }
+
+    SECTION("Deep") {
+
+        SECTION("BufferedSend a pointer/len payload") {
+            if (comm_rank == 0) {
+                TestObject *p = MEL::MemAlloc<TestObject>(10);
+                for (int i = 0; i < 10; ++i) new (&p[i]) TestObject(i);
+                MEL::Deep::BufferedSend(p, 10, 1, 0, comm);
+                MEL::MemFree(p);
+            }
+            else if (comm_rank == 1) {
+                TestObject *p = nullptr;
+                int len = 0;
+                MEL::Deep::BufferedRecv(p, len, 0, 0, comm);
+                REQUIRE(len == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == TestObject(i)); }
+                MEL::MemFree(p);
+            }
+        }
+
+        SECTION("BufferedSend an object payload") {
+            if (comm_rank == 0) {
+                TestObject p(42);
+                MEL::Deep::BufferedSend(p, 1, 0, comm);
+            }
+            else if (comm_rank == 1) {
+                TestObject p;
+                MEL::Deep::BufferedRecv(p, 0, 0, comm);
+                REQUIRE(p == TestObject(42));
+            }
+        }
+
+        SECTION("BufferedSend a std::list payload") {
+            if (comm_rank == 0) {
+                std::list<TestObject> p;
+                for (int i = 0; i < 10; ++i) p.push_back(TestObject(i));
+                MEL::Deep::BufferedSend(p, 1, 0, comm);
+            }
+            else if (comm_rank == 1) {
+                std::list<TestObject> p;
+                MEL::Deep::BufferedRecv(p, 0, 0, comm);
+                REQUIRE(p.size() == 10);
+                auto it = p.begin();
+                for (int i = 0; i < 10; ++i) { REQUIRE(*it++ == TestObject(i)); }
+            }
+        }
+    }
+}
+
+TEST_CASE("Mapped File", "[Mapped File]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Non-Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("Mapped File a pointer/len payload is used in place") {
+            if (comm_rank == 0) {
+                char *c = MEL::MemAlloc<char>(1);
+                *c = 'x';
+                double *p = MEL::MemAlloc<double>(1000);
+                for (int i = 0; i < 1000; ++i) p[i] = i;
+
+                MEL::Deep::MappedFileWrite(c, 1, "test.tmp");
+                MEL::Deep::MappedFileWrite(p, 1000, "test.tmp");
+
+                MEL::MemFree(c);
+                MEL::MemFree(p);
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                double *p = nullptr;
+                int len = 0;
+
+                MEL::Deep::MappedFile map = MEL::Deep::MappedFileRead(p, len, "test.tmp");
+
+                REQUIRE(len == 1000);
+                REQUIRE((char*) p >= map.base);
+                REQUIRE((char*) (p + len) <= map.base + map.length);
+                REQUIRE(map.owned.empty());
+                for (int i = 0; i < 1000; ++i) { REQUIRE(p[i] == i); }
+                MEL::Deep::MappedFileFree(map);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("Mapped File a std::vector payload") {
+            if (comm_rank == 0) {
+                std::vector<int> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = i;
+
+                MEL::Deep::MappedFileWrite(p, "test.tmp");
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::vector<int> p;
+
+                MEL::Deep::MappedFile map = MEL::Deep::MappedFileRead(p, "test.tmp");
+
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == i); }
+                MEL::Deep::MappedFileFree(map);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+
+    SECTION("Deep") {
+
+        MEL::Barrier(comm);
+
+        SECTION("Mapped File an object payload") {
+            if (comm_rank == 0) {
+                TestObject p(42);
+
+                MEL::Deep::MappedFileWrite(p, "test.tmp");
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                TestObject p;
+
+                MEL::Deep::MappedFile map = MEL::Deep::MappedFileRead(p, "test.tmp");
+
+                REQUIRE(p == TestObject(42));
+                MEL::Deep::MappedFileFree(map);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+        SECTION("Mapped File a std::vector payload") {
+            if (comm_rank == 0) {
+                std::vector<TestObject> p(10);
+                for (int i = 0; i < 10; ++i) p[i] = TestObject(i);
+
+                MEL::Deep::MappedFileWrite(p, "test.tmp");
+                MEL::Barrier(comm);
+            }
+            else if (comm_rank == 1) {
+                MEL::Barrier(comm);
+                std::vector<TestObject> p;
+
+                MEL::Deep::MappedFile map = MEL::Deep::MappedFileRead(p, "test.tmp");
+
+                REQUIRE(p.size() == 10);
+                for (int i = 0; i < 10; ++i) { REQUIRE(p[i] == TestObject(i)); }
+                MEL::Deep::MappedFileFree(map);
+            }
+        }
+
+        MEL::Barrier(comm);
+
+    }
+}
+
+struct TestParticle {
+    char flag;
+    double pos[3];
+    int32_t id;
+};
+MEL_DATATYPE(TestParticle, flag, pos, id);
+
+TEST_CASE("MEL_DATATYPE", "[MEL_DATATYPE][Send][Recv][ProbeGetCount]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("The registered type covers the members and keeps the struct extent") {
+        const MEL::Datatype dt = MEL::TypeGet<TestParticle>();
+        REQUIRE(MEL::TypeSize(dt) == (int) (sizeof(char) + 3 * sizeof(double) + sizeof(int32_t)));
+        REQUIRE(MEL::TypeGetExtent(dt) == (MEL::Aint) sizeof(TestParticle));
+        REQUIRE(MEL::TypeGet<int32_t>() == MEL::Datatype::INT32_T);
+    }
+
+    SECTION("Send a registered struct") {
+        if (comm_rank == 0) {
+            std::vector<TestParticle> p(10);
+            for (int i = 0; i < 10; ++i) {
+                p[i].flag = 'a' + i;
+                p[i].pos[0] = i; p[i].pos[1] = i * 2; p[i].pos[2] = i * 3;
+                p[i].id = i * 100;
+            }
+            MEL::Send(&p[0], 10, 1, 0, comm);
+        }
+        else if (comm_rank == 1) {
+            REQUIRE(MEL::ProbeGetCount<TestParticle>(0, 0, comm) == 10);
+
+            std::vector<TestParticle> p(10);
+            MEL::Recv(&p[0], 10, 0, 0, comm);
+            for (int i = 0; i < 10; ++i) {
+                REQUIRE(p[i].flag == 'a' + i);
+                REQUIRE(p[i].pos[0] == i);
+                REQUIRE(p[i].pos[1] == i * 2);
+                REQUIRE(p[i].pos[2] == i * 3);
+                REQUIRE(p[i].id == i * 100);
+            }
+        }
+    }
+
+    SECTION("ProbeGetCount on a typed message") {
+        if (comm_rank == 0) {
+            std::vector<int> p(7, 42);
+            MEL::Send(&p[0], 7, 1, 1, comm);
+        }
+        else if (comm_rank == 1) {
+            const MEL::Status status = MEL::Probe(0, 1, comm);
+            REQUIRE(MEL::ProbeGetCount<int>(status) == 7);
+
+            std::vector<int> p(7);
+            MEL::Recv(&p[0], 7, 0, 1, comm);
+            for (int i = 0; i < 7; ++i) { REQUIRE(p[i] == 42); }
+        }
+    }
+
+    SECTION("Bcast a registered struct") {
+        TestParticle p;
+        if (comm_rank == 0) {
+            p.flag = 'z';
+            p.pos[0] = 1.; p.pos[1] = 2.; p.pos[2] = 3.;
+            p.id = 7;
+        }
+        MEL::Bcast(&p, 1, 0, comm);
+        REQUIRE(p.flag == 'z');
+        REQUIRE(p.pos[2] == 3.);
+        REQUIRE(p.id == 7);
+    }
+}
+
+TEST_CASE("RequestSet", "[RequestSet][Waitsome][Testsome]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Drain several receives through RequestSetWaitsome") {
+        const int num = 8;
+        std::vector<int> p(num, -1);
+
+        if (comm_rank == 0) {
+            for (int i = num - 1; i >= 0; --i) {
+                int v = i * 10;
+                MEL::Send(&v, 1, 1, i, comm);
+            }
+        }
+        else if (comm_rank == 1) {
+            MEL::RequestSet set;
+            for (int i = 0; i < num; ++i) {
+                MEL::Request rq = MEL::Irecv(&p[i], 1, 0, i, comm);
+                MEL::RequestSetAdd(set, rq, 100 + i);
+                REQUIRE((MPI_Request) rq == MPI_REQUEST_NULL);
+            }
+            REQUIRE(MEL::RequestSetSize(set) == num);
+
+            std::vector<int> seen;
+            while (MEL::RequestSetSize(set) > 0) {
+                const int onum = MEL::RequestSetWaitsome(set);
+                REQUIRE(onum > 0);
+                for (int i = 0; i < onum; ++i) {
+                    const int id = set.completed[i];
+                    REQUIRE(set.completedStatuses[i].MPI_TAG == id - 100);
+                    REQUIRE(p[id - 100] == (id - 100) * 10);
+                    seen.push_back(id);
+                }
+            }
+            std::sort(seen.begin(), seen.end());
+            REQUIRE(seen.size() == (size_t) num);
+            for (int i = 0; i < num; ++i) { REQUIRE(seen[i] == 100 + i); }
+
+            /// Every request is gone, so the set and the raw calls report nothing rather than MPI_UNDEFINED
+            REQUIRE(MEL::RequestSetWaitsome(set) == 0);
+            REQUIRE(MEL::RequestSetTestsome(set) == 0);
+        }
+    }
+
+    SECTION("Waitsome and Testsome over null requests return zero") {
+        std::vector<MEL::Request> rqs(4, MEL::Request(MPI_REQUEST_NULL));
+        std::vector<int> indices(4);
+        std::vector<MEL::Status> statuses(4);
+        REQUIRE(MEL::Waitsome(&rqs[0], 4, &indices[0], &statuses[0]) == 0);
+        REQUIRE(MEL::Testsome(&rqs[0], 4, &indices[0]) == 0);
+    }
+
+    SECTION("Waitall and Testall fill statuses") {
+        std::vector<int> p(4, -1);
+        std::vector<MEL::Request> rqs(4);
+        std::vector<MEL::Status> statuses(4);
+        const int other = 1 - comm_rank;
+
+        for (int i = 0; i < 4; ++i) rqs[i] = MEL::Irecv(&p[i], 1, other, 20 + i, comm);
+        for (int i = 0; i < 4; ++i) {
+            int v = comm_rank * 10 + i;
+            MEL::Send(&v, 1, other, 20 + i, comm);
+        }
+
+        if (comm_rank == 0) {
+            while (!MEL::Testall(&rqs[0], 4, &statuses[0])) {}
+        }
+        else {
+            MEL::Waitall(&rqs[0], 4, &statuses[0]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(p[i] == other * 10 + i);
+            REQUIRE(statuses[i].MPI_SOURCE == other);
+            REQUIRE(statuses[i].MPI_TAG == 20 + i);
+        }
+    }
+}
+
+TEST_CASE("Future", "[Future][WhenAll][WhenAny]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    REQUIRE(comm_size == 2);
+
+    SECTION("Chain continuations over FutureIrecv") {
+        if (comm_rank == 0) {
+            std::vector<int> p(4);
+            for (int i = 0; i < 4; ++i) p[i] = i + 1;
+            MEL::FutureIsend(p, 1, 0, comm).wait();
+
+            /// The reply is sent from a continuation returning a future, which then() flattens
+            std::vector<int> reply = MEL::FutureIrecv<int>(1, 1, 1, comm).get();
+            REQUIRE(reply[0] == 20);
+        }
+        else if (comm_rank == 1) {
+            int stages = 0;
+            MEL::Future<int> sum = MEL::FutureIrecv<int>(4, 0, 0, comm).then([&stages](std::vector<int> &p) {
+                ++stages;
+                int s = 0;
+                for (const int v : p) s += v;
+                return s;
+            }).then([&stages](int &s) {
+                ++stages;
+                return s * 2;
+            });
+            MEL::Future<std::vector<int>> sent = sum.then([&comm](int &s) {
+                return MEL::FutureIsend(std::vector<int>(1, s), 0, 1, comm);
+            });
+
+            REQUIRE(sum.get() == 20);
+            REQUIRE(stages == 2);
+            sent.wait();
+            REQUIRE(sent.get()[0] == 20);
+        }
+    }
+
+    SECTION("WhenAll and WhenAny on empty sets") {
+        std::vector<MEL::Future<int>> none;
+
+        MEL::Future<void> all = MEL::WhenAll(none);
+        REQUIRE(all.test());
+
+        MEL::Future<int> any = MEL::WhenAny(none);
+        REQUIRE(any.test());
+        REQUIRE(any.get() == -1);
+    }
+
+    SECTION("WhenAny reports the first future to become ready") {
+        const int other = 1 - comm_rank;
+        std::vector<MEL::Future<std::vector<int>>> futures;
+        futures.push_back(MEL::FutureIrecv<int>(1, other, 2, comm));
+        futures.push_back(MEL::FutureReady(std::vector<int>(1, 5)));
+
+        MEL::Future<int> any = MEL::WhenAny(futures);
+        REQUIRE(any.test());
+        REQUIRE(any.get() == 1);
+
+        MEL::Future<void> all = MEL::WhenAll(futures);
+        MEL::Barrier(comm);
+        REQUIRE(!futures[0].test());
+
+        MEL::FutureIsend(std::vector<int>(1, comm_rank), other, 2, comm).wait();
+        all.wait();
+        REQUIRE(futures[0].get()[0] == other);
+    }
+
+#ifdef MEL_3
+    SECTION("FutureIallreduce owns its send buffer") {
+        MEL::Future<std::vector<int>> sum = MEL::FutureIallreduce(std::vector<int>(1000, comm_rank + 1), MEL::Op::SUM, comm);
+        std::vector<int> &p = sum.get();
+        REQUIRE(p.size() == 1000);
+        for (int i = 0; i < 1000; ++i) { REQUIRE(p[i] == 3); }
+    }
+#endif
+}
+
+TEST_CASE("Progress Engine", "[Progress]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm);
+
+    SECTION("Poll Mode") {
+        MEL::ProgressEngine engine = MEL::ProgressEngineCreate(false);
+
+        int done = 0;
+        std::vector<int> buf(4, -1);
+        for (int i = 0; i < 4; ++i) {
+            MEL::Request rq = (comm_rank == 0) ? MEL::Isend(&i, 1, 1, i, comm) : MEL::Irecv(&buf[i], 1, 0, i, comm);
+            if (comm_rank == 0) MEL::Wait(rq);
+            else                MEL::ProgressAttach(engine, rq, [&done]() { ++done; });
+            REQUIRE((MPI_Request) rq == MPI_REQUEST_NULL);
+        }
+
+        /// A callback may attach a further request
+        int chained = -1;
+        if (comm_rank == 0) {
+            int value = 4;
+            MEL::Send(&value, 1, 1, 4, comm);
+            value = 42;
+            MEL::Send(&value, 1, 1, 10, comm);
+        }
+        else {
+            MEL::Request rq = MEL::Irecv(&buf[0], 1, 0, 4, comm);
+            MEL::ProgressAttach(engine, rq, [&]() {
+                MEL::Request next = MEL::Irecv(&chained, 1, 0, 10, comm);
+                MEL::ProgressAttach(engine, next, [&done]() { ++done; });
+            });
+            REQUIRE(MEL::ProgressOutstanding(engine) == 5);
+        }
+
+        MEL::ProgressWait(engine);
+        REQUIRE(MEL::ProgressOutstanding(engine) == 0);
+        REQUIRE(MEL::ProgressPoll(engine) == 0);
+        if (comm_rank == 1) {
+            REQUIRE(done == 5);
+            REQUIRE(chained == 42);
+            REQUIRE(buf[0] == 4);
+            for (int i = 1; i < 4; ++i) { REQUIRE(buf[i] == i); }
+        }
+        MEL::ProgressEngineFree(engine);
+        REQUIRE(engine.state == nullptr);
+    }
+
+    SECTION("Null Request") {
+        MEL::ProgressEngine engine = MEL::ProgressEngineCreate(false);
+
+        bool ran = false;
+        MEL::Request rq(MPI_REQUEST_NULL);
+        MEL::ProgressAttach(engine, rq, [&ran]() { ran = true; });
+        REQUIRE(ran);
+        REQUIRE(MEL::ProgressOutstanding(engine) == 0);
+
+        std::future<void> ready = MEL::ProgressAttach(engine, rq);
+        REQUIRE(ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        REQUIRE(MEL::ProgressOutstanding(engine) == 0);
+
+        MEL::ProgressWait(engine);
+        MEL::ProgressEngineFree(engine);
+    }
+
+    SECTION("Persistent Request") {
+        MEL::ProgressEngine engine = MEL::ProgressEngineCreate(false);
+
+        int value = comm_rank, done = 0;
+        MPI_Request raw;
+        if (comm_rank == 0) MPI_Send_init(&value, 1, MPI_INT, 1, 0, (MPI_Comm) comm, &raw);
+        else                MPI_Recv_init(&value, 1, MPI_INT, 0, 0, (MPI_Comm) comm, &raw);
+
+        /// The engine drops a completed persistent request without freeing it, so it can be restarted and re-attached
+        for (int round = 0; round < 3; ++round) {
+            if (comm_rank == 0) value = round;
+            MPI_Start(&raw);
+            MEL::Request rq(raw);
+            MEL::ProgressAttach(engine, rq, [&done]() { ++done; });
+            MEL::ProgressWait(engine);
+            REQUIRE(done == round + 1);
+            if (comm_rank == 1) { REQUIRE(value == round); }
+        }
+        MPI_Request_free(&raw);
+
+        /// Polling after the handle is freed must not touch it
+        REQUIRE(MEL::ProgressPoll(engine) == 0);
+        MEL::ProgressEngineFree(engine);
+    }
+
+    SECTION("Thread Mode") {
+        if (MEL::QueryThread() == MEL::ThreadLevel::MULTIPLE) {
+            MEL::ProgressEngine engine = MEL::ProgressEngineCreate(true, 0);
+
+            std::vector<int> buf(16, -1);
+            std::vector<std::future<void>> futures;
+            for (int i = 0; i < 16; ++i) {
+                buf[i] = (comm_rank == 0) ? i : -1;
+                MEL::Request rq = (comm_rank == 0) ? MEL::Isend(&buf[i], 1, 1, i, comm) : MEL::Irecv(&buf[i], 1, 0, i, comm);
+                futures.push_back(MEL::ProgressAttach(engine, rq));
+            }
+
+            /// The engine thread completes the requests without the caller polling
+            for (auto &f : futures) f.wait();
+            MEL::ProgressWait(engine);
+            REQUIRE(MEL::ProgressOutstanding(engine) == 0);
+            if (comm_rank == 1) {
+                for (int i = 0; i < 16; ++i) { REQUIRE(buf[i] == i); }
+            }
+            MEL::ProgressEngineFree(engine);
+        }
+    }
+
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("Allocator", "[Allocator][Bcast][Allreduce]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    typedef std::vector<int, MEL::Allocator<int>> AllocVector;
+
+    SECTION("Container") {
+        AllocVector vec;
+        for (int i = 0; i < 1000; ++i) vec.push_back(i);
+        REQUIRE(vec.size() == 1000);
+        for (int i = 0; i < 1000; ++i) { REQUIRE(vec[i] == i); }
+
+        AllocVector copy(vec);
+        REQUIRE(copy == vec);
+        REQUIRE(vec.get_allocator() == MEL::Allocator<char>());
+
+        std::basic_string<char, std::char_traits<char>, MEL::Allocator<char>> str("allocated from MPI_Alloc_mem");
+        REQUIRE(str.size() == 28);
+    }
+
+    SECTION("Bcast") {
+        AllocVector vec(1000, -1);
+        if (comm_rank == 0) {
+            for (int i = 0; i < 1000; ++i) vec[i] = i;
+        }
+        MEL::Bcast(vec.begin(), vec.end(), 0, comm);
+        for (int i = 0; i < 1000; ++i) { REQUIRE(vec[i] == i); }
+    }
+
+    SECTION("Allreduce") {
+        AllocVector src(1000), dst(1000, -1);
+        for (int i = 0; i < 1000; ++i) src[i] = i + comm_rank;
+
+        MEL::Allreduce(src.begin(), src.end(), dst.begin(), MEL::Op::SUM, comm);
+        const int rankSum = (comm_size * (comm_size - 1)) / 2;
+        for (int i = 0; i < 1000; ++i) { REQUIRE(dst[i] == (i * comm_size) + rankSum); }
+
+#ifdef MEL_3
+        AllocVector idst(1000, -1);
+        MEL::Request rq = MEL::Iallreduce(src.begin(), src.end(), idst.begin(), MEL::Op::SUM, comm);
+        MEL::Wait(rq);
+        REQUIRE(idst == dst);
+#endif
+    }
+
+    MEL::Barrier(comm);
+}
+
+std::vector<std::vector<std::string>> ReadCSV(const std::string &path) {
+    std::vector<std::vector<std::string>> rows;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        /// Quoted cells may contain commas, the quotes are dropped
+        std::vector<std::string> row(1);
+        bool quoted = false;
+        for (const char c : line) {
+            if (c == '"')                 quoted = !quoted;
+            else if (c == ',' && !quoted) row.push_back(std::string());
+            else                          row.back() += c;
+        }
+        rows.push_back(row);
+    }
+    return rows;
+};
+
+#ifdef MEL_COMM_MATRIX
+TEST_CASE("Comm Matrix", "[CommMatrix]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    /// Init starts the clock on the thread that initialized MPI
+    REQUIRE(MEL::Matrix_getState().main == std::this_thread::get_id());
+
+    MEL::CommMatrixReset();
+    if (comm_rank == 0) {
+        std::vector<int> src(100, 1);
+        for (int i = 0; i < 3; ++i) MEL::Send(&src[0], 100, 1, i, comm);
+        std::vector<double> dst(10);
+        MEL::Recv(&dst[0], 10, 1, 0, comm);
+    }
+    else if (comm_rank == 1) {
+        std::vector<int> dst(100);
+        for (int i = 0; i < 3; ++i) MEL::Recv(&dst[0], 100, 0, i, comm);
+        std::vector<double> src(10, 1.0);
+        MEL::Send(&src[0], 10, 0, 0, comm);
+    }
+
+    MEL::CommMatrixReport(comm, "CommMatrix_bytes.csv", "CommMatrix_messages.csv", "CommMatrix_imbalance.csv");
+
+    if (comm_rank == 0) {
+        /// Rows are senders and columns receivers, each offset by the row label
+        const auto bytes    = ReadCSV("CommMatrix_bytes.csv");
+        const auto messages = ReadCSV("CommMatrix_messages.csv");
+        REQUIRE(bytes.size() == (size_t) (comm_size + 1));
+        REQUIRE(messages.size() == (size_t) (comm_size + 1));
+        REQUIRE(std::stoll(bytes[1][2]) == 3 * 100 * (long long) sizeof(int));
+        REQUIRE(std::stoll(bytes[2][1]) == 10 * (long long) sizeof(double));
+        REQUIRE(std::stoll(bytes[1][1]) == 0);
+        REQUIRE(std::stoll(messages[1][2]) == 3);
+        REQUIRE(std::stoll(messages[2][1]) == 1);
+
+        const auto imbalance = ReadCSV("CommMatrix_imbalance.csv");
+        REQUIRE(imbalance.size() == (size_t) (comm_size + 1));
+        REQUIRE(imbalance[0][0] == "rank");
+        for (int i = 0; i < comm_size; ++i) {
+            const auto &row = imbalance[i + 1];
+            REQUIRE(row.size() == 9);
+            REQUIRE(std::stoi(row[0]) == i);
+            REQUIRE(std::stod(row[2]) >= 0.0);
+            REQUIRE(std::stod(row[3]) >= 0.0);
+            REQUIRE(std::stod(row[4]) <= 1.0);
+        }
+        REQUIRE(std::stoll(imbalance[1][5]) == 3 * 100 * (long long) sizeof(int));
+        REQUIRE(std::stoll(imbalance[2][7]) == 3 * 100 * (long long) sizeof(int));
+    }
+
+    MEL::Barrier(comm);
+}
+#endif
+
+TEST_CASE("TypeCache", "[TypeCache]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm);
+
+    static_assert(!std::is_copy_constructible<MEL::TypeCache>::value, "TypeCache must not be copyable");
+    static_assert(!std::is_copy_assignable<MEL::TypeCache>::value,    "TypeCache must not be copyable");
+    static_assert(std::is_move_constructible<MEL::TypeCache>::value,  "TypeCache must be movable");
+
+    MEL::TypeCache cache = MEL::TypeCacheCreate(2);
+
+    SECTION("Hit") {
+        MEL::Datatype a = MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        MEL::Datatype b = MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        REQUIRE(a == b);
+        REQUIRE(MEL::TypeCacheHits(cache)   == 1);
+        REQUIRE(MEL::TypeCacheMisses(cache) == 1);
+        REQUIRE(MEL::TypeSize(a) == 4 * (int) sizeof(int));
+
+        /// A different length is a different type
+        MEL::Datatype c = MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 5);
+        REQUIRE(MEL::TypeCacheMisses(cache) == 2);
+        REQUIRE(MEL::TypeSize(c) == 5 * (int) sizeof(int));
+
+        /// Cached types can be used for communication
+        std::vector<int> buf(4);
+        if (comm_rank == 0) {
+            for (int i = 0; i < 4; ++i) buf[i] = i;
+            MEL::Send(&buf[0], 1, a, 1, 0, comm);
+        }
+        else if (comm_rank == 1) {
+            MEL::Recv(&buf[0], 1, a, 0, 0, comm);
+            for (int i = 0; i < 4; ++i) { REQUIRE(buf[i] == i); }
+        }
+    }
+
+    SECTION("LRU Eviction") {
+        MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        MEL::TypeCreateVector(cache, MEL::Datatype::INT, 2, 1, 2);
+        /// Touch the contiguous type so the vector becomes least recently used
+        MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 8);
+        REQUIRE(MEL::TypeCacheHits(cache)   == 1);
+        REQUIRE(MEL::TypeCacheMisses(cache) == 3);
+
+        MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        REQUIRE(MEL::TypeCacheHits(cache)   == 2);
+        MEL::TypeCreateVector(cache, MEL::Datatype::INT, 2, 1, 2);
+        REQUIRE(MEL::TypeCacheMisses(cache) == 4);
+    }
+
+    SECTION("Move") {
+        MEL::Datatype a = MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+        MEL::TypeCache moved(std::move(cache));
+        REQUIRE(MEL::TypeCreateContiguous(moved, MEL::Datatype::INT, 4) == a);
+        REQUIRE(MEL::TypeCacheHits(moved) == 1);
+
+        cache = std::move(moved);
+        REQUIRE(MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4) == a);
+        REQUIRE(MEL::TypeCacheHits(cache) == 2);
+        MEL::TypeCacheFree(moved);
+    }
+
+    MEL::TypeCacheFree(cache);
+    REQUIRE(MEL::TypeCacheHits(cache)   == 0);
+    REQUIRE(MEL::TypeCacheMisses(cache) == 0);
+
+    /// The cache remains usable after it is freed
+    MEL::TypeCreateContiguous(cache, MEL::Datatype::INT, 4);
+    REQUIRE(MEL::TypeCacheMisses(cache) == 1);
+    MEL::TypeCacheFree(cache);
+
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("RMA Atomics", "[RMA][FetchAndOp][CompareAndSwap][GetAccumulate][Raccumulate]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    int64_t *slots = MEL::MemAlloc<int64_t>(4);
+    slots[0] = 0; slots[1] = -1; slots[2] = 0; slots[3] = 0;
+    MEL::Win win = MEL::WinCreate(slots, 4, comm);
+    MEL::Barrier(comm);
+
+    SECTION("FetchAndOp") {
+        /// Every fetch returns a distinct ticket
+        std::vector<int64_t> tickets(10);
+        MEL::WinLockAll(win);
+        for (int i = 0; i < 10; ++i) tickets[i] = MEL::FetchAndOp((int64_t) 1, MEL::Op::SUM, 0, 0, win);
+        MEL::WinUnlockAll(win);
+
+        std::vector<int64_t> all(10 * comm_size);
+        MEL::Allgather(&tickets[0], 10, &all[0], 10, comm);
+        std::sort(all.begin(), all.end());
+        for (int i = 0; i < 10 * comm_size; ++i) { REQUIRE(all[i] == i); }
+
+        MEL::Barrier(comm);
+        if (comm_rank == 0) {
+            MEL::WinLock(win, 0, MEL::LockType::SHARED);
+            REQUIRE(slots[0] == 10 * comm_size);
+            MEL::WinUnlock(win, 0);
+        }
+    }
+
+    SECTION("CompareAndSwap") {
+        /// Exactly one rank swaps its rank into the empty slot
+        MEL::WinLockAll(win);
+        const int64_t old = MEL::CompareAndSwap((int64_t) comm_rank, (int64_t) -1, 1, 0, win);
+        MEL::WinUnlockAll(win);
+
+        int won = (old == -1) ? 1 : 0, total = 0;
+        MEL::Allreduce(&won, &total, 1, MEL::Op::SUM, comm);
+        REQUIRE(total == 1);
+
+        MEL::Barrier(comm);
+        if (comm_rank == 0) {
+            MEL::WinLock(win, 0, MEL::LockType::SHARED);
+            REQUIRE(slots[1] >= 0);
+            REQUIRE(slots[1] < comm_size);
+            MEL::WinUnlock(win, 0);
+        }
+    }
+
+    SECTION("Accumulate") {
+        const int64_t values[2] = { comm_rank + 1, 2 * (comm_rank + 1) };
+        int64_t result[2] = { -1, -1 };
+
+        MEL::WinLockAll(win);
+        MEL::Request rq = MEL::Raccumulate(values, 2, 2, MEL::Op::SUM, 0, win);
+        MEL::Wait(rq);
+        MEL::WinFlush(win, 0);
+        MEL::WinUnlockAll(win);
+        MEL::Barrier(comm);
+
+        /// NO_OP reads the target atomically
+        MEL::WinLockAll(win);
+        MEL::GetAccumulate(values, result, 2, 2, MEL::Op::NO_OP, 0, win);
+        MEL::WinUnlockAll(win);
+
+        const int64_t sum = (comm_size * (comm_size + 1)) / 2;
+        REQUIRE(result[0] == sum);
+        REQUIRE(result[1] == 2 * sum);
+        MEL::Barrier(comm);
+
+        MEL::WinLockAll(win);
+        rq = MEL::RgetAccumulate(values, result, 2, 2, MEL::Op::REPLACE, 0, win);
+        MEL::Wait(rq);
+        MEL::WinUnlockAll(win);
+        MEL::Barrier(comm);
+        if (comm_rank == 0) {
+            /// REPLACE leaves one rank's pair intact
+            MEL::WinLock(win, 0, MEL::LockType::SHARED);
+            REQUIRE(slots[2] >= 1);
+            REQUIRE(slots[2] <= comm_size);
+            REQUIRE(slots[3] == 2 * slots[2]);
+            MEL::WinUnlock(win, 0);
+        }
+    }
+
+    MEL::Barrier(comm);
+    MEL::WinFree(win);
+    MEL::MemFree(slots);
+}
+
+TEST_CASE("Dynamic Windows", "[RMA][WinCreateDynamic][SharedVector]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+    const int next = (comm_rank + 1) % comm_size;
+
+    SECTION("WinAttach") {
+        MEL::Win win = MEL::WinCreateDynamic(comm);
+        int *local = MEL::MemAlloc<int>(16);
+        for (int i = 0; i < 16; ++i) local[i] = comm_rank * 100 + i;
+        MEL::WinAttach(win, local, 16);
+
+        /// Dynamic windows are addressed by absolute address rather than displacement
+        MEL::Aint addr = MEL::GetAddress(local);
+        std::vector<MEL::Aint> addrs(comm_size);
+        MEL::Allgather(&addr, 1, &addrs[0], 1, comm);
+
+        std::vector<int> remote(4, -1);
+        MEL::WinLockShared(win, next);
+        MEL::Get(&remote[0], 4, MEL::Datatype::INT, addrs[next] + 4 * sizeof(int), 4, MEL::Datatype::INT, next, win);
+        MEL::WinUnlock(win, next);
+        for (int i = 0; i < 4; ++i) { REQUIRE(remote[i] == next * 100 + 4 + i); }
+
+        MEL::Barrier(comm);
+        MEL::WinDetach(win, local);
+        MEL::WinFree(win);
+        MEL::MemFree(local);
+    }
+
+    SECTION("SharedVector") {
+        auto shared = MEL::SharedVectorCreate<double>(comm);
+        REQUIRE(shared.size() == 0);
+
+        /// Pushing past the capacity reallocates and reattaches the segment
+        const int len = 100 * (comm_rank + 1);
+        for (int i = 0; i < len; ++i) MEL::SharedVectorPushBack(shared, comm_rank * 1000.0 + i);
+        REQUIRE(shared.size() == len);
+        REQUIRE(shared[len - 1] == comm_rank * 1000.0 + len - 1);
+        MEL::Barrier(comm);
+
+        REQUIRE(MEL::SharedVectorSize(shared, next) == 100 * (next + 1));
+        std::vector<double> all = MEL::SharedVectorGet(shared, next);
+        REQUIRE(all.size() == (size_t) (100 * (next + 1)));
+        for (int i = 0; i < (int) all.size(); ++i) { REQUIRE(all[i] == next * 1000.0 + i); }
+
+        double range[3];
+        MEL::SharedVectorGet(shared, next, 10, 3, range);
+        for (int i = 0; i < 3; ++i) { REQUIRE(range[i] == next * 1000.0 + 10 + i); }
+        MEL::Barrier(comm);
+
+        const double marks[2] = { -1.0, -2.0 };
+        MEL::SharedVectorPut(shared, next, 0, 2, marks);
+        MEL::Barrier(comm);
+        MEL::SharedVectorGet(shared, comm_rank, 0, 3, range);
+        REQUIRE(range[0] == -1.0);
+        REQUIRE(range[1] == -2.0);
+        REQUIRE(range[2] == comm_rank * 1000.0 + 2);
+        MEL::Barrier(comm);
+
+        /// Growing keeps the contents and shrinking is visible remotely
+        MEL::SharedVectorReserve(shared, 4096);
+        MEL::SharedVectorResize(shared, 5);
+        REQUIRE(shared.size() == 5);
+        REQUIRE(shared[0] == -1.0);
+        MEL::Barrier(comm);
+        REQUIRE(MEL::SharedVectorSize(shared, next) == 5);
+        MEL::Barrier(comm);
+
+        MEL::SharedVectorFree(shared);
+    }
+
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("DistributedHashMap", "[RMA][DistributedHashMap]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    SECTION("Insert and Find") {
+        auto map = MEL::DistributedHashMapCreate<int, double>(256, comm);
+
+        /// Every rank inserts the same keys concurrently, which must not create duplicates
+        for (int i = 0; i < 100; ++i) { REQUIRE(MEL::DistributedHashMapInsert(map, i, i * 0.5)); }
+        for (int i = comm_rank; i < 150; i += comm_size) { REQUIRE(MEL::DistributedHashMapInsert(map, 1000 + i, (double) i)); }
+        MEL::Barrier(comm);
+        REQUIRE(MEL::DistributedHashMapSize(map) == 250);
+
+        std::vector<int> keys;
+        for (int i = 0; i < 1200; i += 3) keys.push_back(i);
+        std::vector<double> values;
+        std::vector<bool> found;
+        const int num = MEL::DistributedHashMapFind(map, keys, values, found);
+        REQUIRE(values.size() == keys.size());
+        REQUIRE(found.size() == keys.size());
+
+        int expected = 0;
+        for (size_t k = 0; k < keys.size(); ++k) {
+            const int key = keys[k];
+            const bool present = (key < 100) || (key >= 1000 && key < 1150);
+            if (present) ++expected;
+            REQUIRE(found[k] == present);
+            if (present) { REQUIRE(values[k] == ((key < 100) ? key * 0.5 : (double) (key - 1000))); }
+        }
+        REQUIRE(num == expected);
+
+        double value = 0.0;
+        REQUIRE(MEL::DistributedHashMapFind(map, 7, value));
+        REQUIRE(value == 3.5);
+        REQUIRE(!MEL::DistributedHashMapFind(map, -7, value));
+        MEL::Barrier(comm);
+
+        /// Updating a key keeps a single entry
+        if (comm_rank == 0) { REQUIRE(MEL::DistributedHashMapInsert(map, 7, 70.0)); }
+        MEL::Barrier(comm);
+        REQUIRE(MEL::DistributedHashMapFind(map, 7, value));
+        REQUIRE(value == 70.0);
+        REQUIRE(MEL::DistributedHashMapSize(map) == 250);
+
+        MEL::Barrier(comm);
+        MEL::DistributedHashMapFree(map);
+    }
+
+    SECTION("Full Table") {
+        auto map = MEL::DistributedHashMapCreate<int, int>(4, comm);
+
+        int inserted = 0;
+        if (comm_rank == 0) {
+            for (int i = 0; i < 8 * comm_size; ++i) {
+                if (MEL::DistributedHashMapInsert(map, i, i)) ++inserted;
+            }
+        }
+        MEL::Barrier(comm);
+        const int total = MEL::DistributedHashMapSize(map);
+        REQUIRE(total <= 4 * comm_size);
+        if (comm_rank == 0) {
+            REQUIRE(inserted == total);
+            REQUIRE(inserted < 8 * comm_size);
+        }
+
+        MEL::Barrier(comm);
+        MEL::DistributedHashMapFree(map);
+    }
+
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("Aggregator", "[Aggregator]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+    const int next = (comm_rank + 1) % comm_size;
+
+    SECTION("Sync") {
+        auto agg = MEL::AggregatorCreate(77, 1024, 1e-3, comm);
+
+        long long sum = 0;
+        int count = 0, hops = 0;
+        std::vector<std::string> strings;
+        const int hSum = MEL::AggregatorRegister<int>(agg, [&](const int, const int &v) { sum += v; ++count; });
+        const int hRaw = MEL::AggregatorRegister(agg, [&](const int src, const char *ptr, const int len) {
+            REQUIRE(src == (comm_rank + comm_size - 1) % comm_size);
+            strings.push_back(std::string(ptr, len));
+        });
+        /// Handlers may push further messages, which Sync delivers before returning
+        int hFwd = 0;
+        hFwd = MEL::AggregatorRegister<int>(agg, [&](const int, const int &v) {
+            ++hops;
+            if (v > 0) MEL::AggregatorPush(agg, next, hFwd, v - 1);
+        });
+
+        for (int i = 0; i < 10000; ++i) MEL::AggregatorPush(agg, i % comm_size, hSum, i);
+        const std::string words[3] = { "a", "bb", std::string(2000, 'c') };
+        for (const auto &w : words) MEL::AggregatorPush(agg, next, hRaw, w.data(), (int) w.size());
+        MEL::AggregatorPush(agg, next, hFwd, 2 * comm_size);
+        MEL::AggregatorSync(agg);
+
+        /// Each rank receives i for every i congruent to its rank, from every rank
+        long long expected = 0;
+        int expectedCount = 0;
+        for (int i = comm_rank; i < 10000; i += comm_size) { expected += i; ++expectedCount; }
+        REQUIRE(count == comm_size * expectedCount);
+        REQUIRE(sum == comm_size * expected);
+
+        REQUIRE(strings.size() == 3);
+        for (int i = 0; i < 3; ++i) { REQUIRE(strings[i] == words[i]); }
+
+        int allHops = 0;
+        MEL::Allreduce(&hops, &allHops, 1, MEL::Op::SUM, comm);
+        REQUIRE(allHops == comm_size * (2 * comm_size + 1));
+
+        MEL::AggregatorFree(agg);
+    }
+
+    SECTION("Flush and Progress") {
+        /// With no time threshold nothing is sent until the buffer fills or is flushed
+        auto agg = MEL::AggregatorCreate(78, 1 << 20, -1.0, comm);
+        int count = 0;
+        const int h = MEL::AggregatorRegister<int>(agg, [&](const int src, const int &v) {
+            REQUIRE(src == (comm_rank + comm_size - 1) % comm_size);
+            REQUIRE(v == count);
+            ++count;
+        });
+
+        for (int i = 0; i < 100; ++i) MEL::AggregatorPush(agg, next, h, i);
+        MEL::Barrier(comm);
+        REQUIRE(MEL::AggregatorProgress(agg) == 0);
+        MEL::Barrier(comm);
+
+        MEL::AggregatorFlush(agg);
+        while (count < 100) MEL::AggregatorProgress(agg);
+        REQUIRE(count == 100);
+
+        MEL::AggregatorSync(agg);
+        MEL::AggregatorFree(agg);
+    }
+
+    MEL::Barrier(comm);
+}
+
+struct RPCNode {
+    int n;
+    double *v;
+
+    template<typename MSG>
+    inline void DeepCopy(MSG &msg) {
+        msg.packPtr(v, n);
+    };
+};
+
+TEST_CASE("Active Messages", "[RPC]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+    const int next = (comm_rank + 1) % comm_size,
+              prev = (comm_rank + comm_size - 1) % comm_size;
+
+    auto engine = MEL::RPC::EngineCreate(55, comm);
+
+    double total = 0.0;
+    int pings = 0, elements = 0;
+    const int hNode = MEL::RPC::Register<RPCNode>(engine, [&](const int src, RPCNode &node) {
+        REQUIRE(src == prev);
+        for (int i = 0; i < node.n; ++i) total += node.v[i];
+        MEL::MemFree(node.v);
+    });
+    /// Handlers may invoke further handlers, which Quiesce runs before returning
+    int hPing = 0;
+    hPing = MEL::RPC::Register(engine, [&](const int src) {
+        ++pings;
+        if (pings < 5) MEL::RPC::Invoke(engine, src, hPing);
+    });
+    const int hVec = MEL::RPC::Register<std::vector<int>>(engine, [&](const int src, std::vector<int> &vec) {
+        REQUIRE(src == prev);
+        for (auto v : vec) { REQUIRE(v == src); }
+        elements += vec.size();
+    });
+
+    SECTION("Quiesce") {
+        RPCNode node;
+        node.n = 10;
+        node.v = MEL::MemAlloc<double>(10);
+        for (int i = 0; i < 10; ++i) node.v[i] = comm_rank + i;
+        MEL::RPC::Invoke(engine, next, hNode, node);
+        MEL::MemFree(node.v);
+
+        std::vector<int> vec(7, comm_rank);
+        MEL::RPC::Invoke(engine, next, hVec, vec);
+        MEL::RPC::Invoke(engine, next, hPing);
+        MEL::RPC::Quiesce(engine);
+
+        REQUIRE(total == 10 * prev + 45.0);
+        REQUIRE(elements == 7);
+        REQUIRE(pings == 5);
+    }
+
+    SECTION("Progress") {
+        std::vector<int> vec(3, comm_rank);
+        MEL::RPC::Invoke(engine, next, hVec, vec);
+
+        int run = 0;
+        while (elements < 3) run += MEL::RPC::Progress(engine);
+        REQUIRE(run == 1);
+        REQUIRE(elements == 3);
+        MEL::RPC::Quiesce(engine);
+        REQUIRE(MEL::RPC::Progress(engine) == 0);
+    }
+
+    MEL::RPC::EngineFree(engine);
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("Info", "[Info]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    SECTION("Keys") {
+        MEL::Info info = MEL::InfoCreate();
+        REQUIRE(info != MEL::Info::INFO_NULL);
+        MEL::InfoSet(info, "access_style", "read_once");
+        MEL::InfoSet(info, "cb_buffer_size", 1048576LL);
+
+        auto style = MEL::InfoGet(info, "access_style");
+        REQUIRE(style.first);
+        REQUIRE(style.second == "read_once");
+        auto size = MEL::InfoGet(info, "cb_buffer_size");
+        REQUIRE(size.first);
+        REQUIRE(size.second == "1048576");
+        REQUIRE(!MEL::InfoGet(info, "no_such_key").first);
+
+        /// A duplicate is independent of the original
+        MEL::Info copy = MEL::InfoDuplicate(info);
+        MEL::InfoDelete(info, "access_style");
+        REQUIRE(!MEL::InfoGet(info, "access_style").first);
+        REQUIRE(MEL::InfoGet(copy, "access_style").second == "read_once");
+
+        MEL::InfoFree(info, copy);
+        REQUIRE(info == MEL::Info::INFO_NULL);
+        REQUIRE(copy == MEL::Info::INFO_NULL);
+    }
+
+    SECTION("Presets") {
+        MEL::Info write = MEL::InfoCreateWriteHeavy(2, 1 << 20);
+        REQUIRE(MEL::InfoGet(write, "romio_cb_write").second == "enable");
+        REQUIRE(MEL::InfoGet(write, "cb_nodes").second == "2");
+        REQUIRE(MEL::InfoGet(write, "cb_buffer_size").second == "1048576");
+        REQUIRE(!MEL::InfoGet(write, "striping_factor").first);
+
+        MEL::Info read = MEL::InfoCreateReadMostly();
+        REQUIRE(MEL::InfoGet(read, "access_style").second == "read_mostly");
+        REQUIRE(MEL::InfoGet(read, "ind_rd_buffer_size").second == std::to_string(1 << 22));
+
+        std::vector<MEL::Info> infos = { write, read };
+        MEL::InfoFree(infos);
+        REQUIRE(infos[0] == MEL::Info::INFO_NULL);
+        REQUIRE(infos[1] == MEL::Info::INFO_NULL);
+    }
+
+    SECTION("Hinted Resources") {
+        MEL::Info info = MEL::InfoCreate({ { "access_style", "write_once" } });
+
+        int *ptr = MEL::MemAlloc<int>(16, info);
+        for (int i = 0; i < 16; ++i) ptr[i] = comm_rank * 16 + i;
+
+        MEL::File file = MEL::FileOpen(comm, "info.tmp", MEL::FileMode::CREATE | MEL::FileMode::RDWR, info);
+        MEL::FileWriteAtAll(file, comm_rank * 16 * sizeof(int), ptr, 16);
+        MEL::FileSync(file);
+        MEL::Barrier(comm);
+        MEL::FileSync(file);
+
+        std::vector<int> all(16 * comm_size);
+        MEL::FileReadAt(file, 0, &all[0], 16 * comm_size);
+        for (int i = 0; i < 16 * comm_size; ++i) { REQUIRE(all[i] == i); }
+        MEL::FileClose(file);
+
+        MEL::MemFree(ptr);
+        MEL::InfoFree(info);
+        MEL::Barrier(comm);
+        if (comm_rank == 0) MEL::FileDelete("info.tmp");
+    }
+
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("Non-Blocking File", "[FileIwriteAtAll][FileIreadAtAll][Split Collective File]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    std::vector<int> src(64), dst(64, -1);
+    for (int i = 0; i < 64; ++i) src[i] = comm_rank * 64 + i;
+    const MEL::Offset offset = comm_rank * 64 * sizeof(int);
+
+    MEL::File file = MEL::FileOpen(comm, "nonblocking.tmp", MEL::FileMode::CREATE | MEL::FileMode::RDWR | MEL::FileMode::DELETE_ON_CLOSE);
+
+    SECTION("Split Collective") {
+        MEL::FileWriteAtAllBegin(file, offset, &src[0], 64);
+        MEL::FileWriteAtAllEnd(file, &src[0]);
+        MEL::FileSync(file);
+        MEL::Barrier(comm);
+        MEL::FileSync(file);
+
+        MEL::FileReadAtAllBegin(file, offset, &dst[0], 64);
+        MEL::FileReadAtAllEnd(file, &dst[0]);
+        REQUIRE(dst == src);
+
+        /// Individual file pointers
+        std::fill(dst.begin(), dst.end(), -1);
+        MEL::FileSeek(file, offset);
+        MEL::FileReadAllBegin(file, &dst[0], 64);
+        MEL::FileReadAllEnd(file, &dst[0]);
+        REQUIRE(dst == src);
+    }
+
+    SECTION("Ordered") {
+        /// Each rank appends rank + 1 values in rank order through the shared file pointer
+        std::vector<int> mine(comm_rank + 1, comm_rank);
+        MEL::FileWriteOrderedBegin(file, &mine[0], comm_rank + 1);
+        MEL::FileWriteOrderedEnd(file, &mine[0]);
+        MEL::FileSync(file);
+        MEL::Barrier(comm);
+        MEL::FileSync(file);
+
+        MEL::FileSeekShared(file, 0);
+        std::vector<int> back(comm_rank + 1, -1);
+        MEL::FileReadOrderedBegin(file, &back[0], comm_rank + 1);
+        MEL::FileReadOrderedEnd(file, &back[0]);
+        REQUIRE(back == mine);
+    }
+
+#ifdef MEL_3_1
+    SECTION("Non-Blocking Collective") {
+        MEL::Request rq = MEL::FileIwriteAtAll(file, offset, &src[0], 64);
+        MEL::Wait(rq);
+        MEL::FileSync(file);
+        MEL::Barrier(comm);
+        MEL::FileSync(file);
+
+        rq = MEL::FileIreadAtAll(file, offset, &dst[0], 64);
+        MEL::Wait(rq);
+        REQUIRE(dst == src);
+
+        std::fill(dst.begin(), dst.end(), -1);
+        MEL::FileSeek(file, offset);
+        rq = MEL::FileIreadAll(file, &dst[0], 64);
+        MEL::Wait(rq);
+        REQUIRE(dst == src);
+
+        /// Read the other ranks' data to check the writes landed in the shared file
+        std::vector<int> all(64 * comm_size, -1);
+        rq = MEL::FileIreadAtAll(file, 0, &all[0], 64 * comm_size);
+        MEL::Wait(rq);
+        for (int i = 0; i < 64 * comm_size; ++i) { REQUIRE(all[i] == i); }
+    }
+#endif
+
+    MEL::FileClose(file);
+    MEL::Barrier(comm);
+}
+
+TEST_CASE("Checkpointer", "[Checkpointer]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    for (const auto policy : { MEL::CheckpointPolicy::WAIT, MEL::CheckpointPolicy::SKIP }) {
+        /// A per rank array of varying length, and the row block of a distributed 2D array
+        const int len = 10 * (comm_rank + 1);
+        std::vector<int> local(len);
+        std::vector<double> block(2 * 6);
+        auto fill = [&](const int step) {
+            for (int i = 0; i < len; ++i) local[i] = step * 1000 + comm_rank * 100 + i;
+            for (int i = 0; i < 12; ++i) block[i] = step * 1000.0 + (comm_rank * 2 + i / 6) * 6 + (i % 6);
+        };
+
+        MEL::Checkpointer cp = MEL::CheckpointerCreate("checkpoint.tmp", comm, policy);
+        MEL::CheckpointerRegister(cp, &local[0], len);
+        MEL::CheckpointerRegister(cp, &block[0], { MEL::TypeSubArray_Dim(comm_rank * 2, 2, comm_size * 2), MEL::TypeSubArray_Dim(0, 6, 6) });
+
+        fill(1);
+        REQUIRE(MEL::CheckpointerWrite(cp));
+        /// Arrays may change as soon as the write has started
+        fill(2);
+        MEL::CheckpointerWait(cp);
+        REQUIRE(MEL::CheckpointerTest(cp));
+
+        MEL::CheckpointerRestore(cp);
+        for (int i = 0; i < len; ++i) { REQUIRE(local[i] == 1000 + comm_rank * 100 + i); }
+        for (int i = 0; i < 12; ++i) { REQUIRE(block[i] == 1000.0 + (comm_rank * 2 + i / 6) * 6 + (i % 6)); }
+
+        /// A later checkpoint replaces the earlier one
+        fill(3);
+        REQUIRE(MEL::CheckpointerWrite(cp));
+        fill(4);
+        MEL::CheckpointerRestore(cp);
+        REQUIRE(local[0] == 3000 + comm_rank * 100);
+        REQUIRE(block[0] == 3000.0 + comm_rank * 12);
+        MEL::CheckpointerFree(cp);
+
+        /// The file holds each rank's array in rank order, followed by the global 2D array in row major order
+        MEL::Barrier(comm);
+        if (comm_rank == 0) {
+            int ints = 0;
+            for (int r = 0; r < comm_size; ++r) ints += 10 * (r + 1);
+            std::vector<int> arrays(ints);
+            std::vector<double> global(comm_size * 2 * 6);
+
+            MEL::File file = MEL::FileOpenIndividual("checkpoint.tmp", MEL::FileMode::RDONLY);
+            MEL::FileReadAt(file, 0, &arrays[0], ints);
+            MEL::FileReadAt(file, ints * sizeof(int), &global[0], (int) global.size());
+            MEL::FileClose(file);
+
+            int k = 0;
+            for (int r = 0; r < comm_size; ++r) {
+                for (int i = 0; i < 10 * (r + 1); ++i, ++k) { REQUIRE(arrays[k] == 3000 + r * 100 + i); }
+            }
+            for (int i = 0; i < (int) global.size(); ++i) { REQUIRE(global[i] == 3000.0 + i); }
+            MEL::FileDelete("checkpoint.tmp");
+        }
+        MEL::Barrier(comm);
+    }
+}
+
+#ifdef MEL_MEM_POOL
+TEST_CASE("Memory Pool", "[MemPool][MemAlloc]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm);
+
+    SECTION("Reuse") {
+        const MEL::MemPoolStats before = MEL::MemPoolGetStats();
+
+        /// A freed block is handed back to the next request of the same size class
+        int *a = MEL::MemAlloc<int>(10);
+        REQUIRE(((uintptr_t) a) % 16 == 0);
+        const int *freed = a;
+        MEL::MemFree(a);
+        REQUIRE(a == nullptr);
+        int *b = MEL::MemAlloc<int>(12);
+        REQUIRE(b == freed);
+        MEL::MemFree(b);
+
+        const MEL::MemPoolStats after = MEL::MemPoolGetStats();
+        REQUIRE(after.hits + after.misses == before.hits + before.misses + 2);
+        REQUIRE(after.hits >= before.hits + 1);
+        REQUIRE(after.large == before.large);
+        REQUIRE(after.slabs >= 1);
+        REQUIRE(after.hitRate() > 0.0);
+        REQUIRE(after.hitRate() <= 1.0);
+    }
+
+    SECTION("Large") {
+        const MEL::MemPoolStats before = MEL::MemPoolGetStats();
+        char *big = MEL::MemAlloc<char>(1 << 20);
+        const MEL::MemPoolStats during = MEL::MemPoolGetStats();
+        REQUIRE(during.large == before.large + 1);
+        REQUIRE(during.pinned >= before.pinned + (1 << 20));
+        MEL::MemFree(big);
+        REQUIRE(MEL::MemPoolGetStats().pinned == before.pinned);
+    }
+
+    SECTION("Communication") {
+        double *buf = MEL::MemAlloc<double>(100);
+        if (comm_rank == 0) {
+            for (int i = 0; i < 100; ++i) buf[i] = i * 0.25;
+            MEL::Send(buf, 100, 1, 0, comm);
+        }
+        else if (comm_rank == 1) {
+            MEL::Recv(buf, 100, 0, 0, comm);
+            for (int i = 0; i < 100; ++i) { REQUIRE(buf[i] == i * 0.25); }
+        }
+        MEL::MemFree(buf);
+    }
+
+    SECTION("Threads") {
+        /// Blocks allocated on one thread may be freed on another
+        std::vector<int*> blocks(1000);
+        std::thread producer([&blocks]() {
+            for (int i = 0; i < 1000; ++i) {
+                blocks[i] = MEL::MemAlloc<int>(1 + (i % 64));
+                blocks[i][0] = i;
+            }
+        });
+        producer.join();
+
+        bool intact = true;
+        std::vector<std::thread> consumers;
+        for (int t = 0; t < 4; ++t) {
+            consumers.push_back(std::thread([&blocks, &intact, t]() {
+                for (int i = t; i < 1000; i += 4) {
+                    if (blocks[i][0] != i) intact = false;
+                    MEL::MemFree(blocks[i]);
+                }
+                std::vector<int*> mine;
+                for (int i = 0; i < 200; ++i) mine.push_back(MEL::MemAlloc<int>(8));
+                for (auto p : mine) MEL::MemFree(p);
+            }));
+        }
+        for (auto &c : consumers) c.join();
+        REQUIRE(intact);
+    }
+
+    SECTION("Release") {
+        /// Nothing allocated by the earlier sections is still live
+        MEL::MemPoolRelease();
+        const MEL::MemPoolStats released = MEL::MemPoolGetStats();
+        REQUIRE(released.slabs == 0);
+
+        int *p = MEL::MemAlloc<int>(4);
+        p[3] = 7;
+        REQUIRE(MEL::MemPoolGetStats().slabs == 1);
+        MEL::MemFree(p);
+    }
+
+    MEL::Barrier(comm);
+}
+#endif
+
+#ifdef MEL_CORO
+MEL::Coro::Task CoroExchange(const int i, long long &acc) {
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+    const int next = (comm_rank + 1) % comm_size,
+              prev = (comm_rank + comm_size - 1) % comm_size;
+
+    int out = comm_rank * 10000 + i, in = -1;
+    MEL::Request send = MEL::Isend(&out, 1, next, i, comm);
+    MEL::Status status = co_await MEL::Irecv(&in, 1, prev, i, comm);
+    if (status.MPI_SOURCE != prev || status.MPI_TAG != i) throw std::runtime_error("CoroExchange unexpected status");
+
+    /// Awaiting a named request resets it, as MEL::Wait does
+    co_await send;
+    if ((MPI_Request) send != MPI_REQUEST_NULL) throw std::runtime_error("CoroExchange request not reset");
+    co_await send;
+    acc += in;
+};
+
+MEL::Coro::Task CoroChild(int &x) {
+    int v = x;
+    co_await MEL::Iallreduce(&v, &x, 1, MEL::Op::SUM, MEL::Comm::WORLD);
+};
+
+MEL::Coro::Task CoroParent(int &result) {
+    int x = MEL::CommRank(MEL::Comm::WORLD);
+    co_await CoroChild(x);
+    auto future = MEL::FutureIallreduce(std::vector<int>(1, x), MEL::Op::MAX, MEL::Comm::WORLD);
+    std::vector<int> &v = co_await future;
+    result = v[0];
+};
+
+MEL::Coro::Task CoroThrow() {
+    co_await MEL::Ibarrier(MEL::Comm::WORLD);
+    throw std::runtime_error("CoroThrow");
+};
+
+TEST_CASE("Coroutines", "[Coro]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+    const int prev = (comm_rank + comm_size - 1) % comm_size;
+
+    MEL::Coro::Scheduler sched;
+
+    SECTION("Requests") {
+        /// Many coroutines in flight, each suspended on its own receive
+        long long acc = 0;
+        const int N = 500;
+        for (int i = 0; i < N; ++i) MEL::Coro::Spawn(sched, CoroExchange(i, acc));
+        MEL::Coro::Run(sched);
+        REQUIRE(acc == (long long) N * prev * 10000 + (long long) N * (N - 1) / 2);
+        REQUIRE(MEL::RequestSetSize(sched.requests) == 0);
+    }
+
+    SECTION("Tasks and Futures") {
+        int result = -1;
+        MEL::Coro::Spawn(sched, CoroParent(result));
+        MEL::Coro::Run(sched);
+        REQUIRE(result == (comm_size * (comm_size - 1)) / 2);
+    }
+
+    SECTION("Exceptions") {
+        MEL::Coro::Spawn(sched, CoroThrow());
+        REQUIRE_THROWS_AS(MEL::Coro::Run(sched), std::runtime_error);
+    }
+
+    MEL::Barrier(comm);
+}
+#endif
+
+#ifdef MEL_PROFILE
+TEST_CASE("Profile", "[Profile]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    MEL::ProfileReset();
+    std::vector<int> buf(100, 1);
+    for (int i = 0; i < 3; ++i) {
+        if (comm_rank == 0)      MEL::Send(&buf[0], 100, 1, i, comm);
+        else if (comm_rank == 1) MEL::Recv(&buf[0], 100, 0, i, comm);
+    }
+    {
+        MEL_PROFILE_SCOPE("Test::Scope", 64);
+    }
+
+    MEL::ProfileReport(comm, "Profile.csv");
+
+    if (comm_rank == 0) {
+        const auto rows = ReadCSV("Profile.csv");
+        REQUIRE(rows.size() >= 4);
+        REQUIRE(rows[0].size() == 7 + MEL::PROFILE_BINS);
+        REQUIRE(rows[0][0] == "function");
+
+        /// Typed overloads append the element type to the function name
+        auto find = [&rows](const std::string &prefix) {
+            for (size_t i = 1; i < rows.size(); ++i) {
+                if (rows[i][0].compare(0, prefix.size(), prefix) == 0) return rows[i];
+            }
+            return std::vector<std::string>();
+        };
+
+        /// 400 byte messages fall in the [256, 512) bin
+        const auto send = find("Comm::Send");
+        REQUIRE(send.size() == rows[0].size());
+        REQUIRE(send[1] == "1");
+        REQUIRE(send[2] == "3");
+        REQUIRE(std::stoll(send[3]) == 3 * 100 * (long long) sizeof(int));
+        REQUIRE(std::stoll(send[7 + 9]) == 3);
+
+        const auto recv = find("Comm::Recv");
+        REQUIRE(recv.size() == rows[0].size());
+        REQUIRE(recv[2] == "3");
+
+        const auto scope = find("Test::Scope");
+        REQUIRE(scope.size() == rows[0].size());
+        REQUIRE(std::stoi(scope[1]) == comm_size);
+        REQUIRE(std::stoll(scope[2]) == comm_size);
+        REQUIRE(std::stoll(scope[3]) == 64LL * comm_size);
+
+        /// Minimum, average and maximum times are ordered
+        for (size_t i = 1; i < rows.size(); ++i) {
+            REQUIRE(std::stod(rows[i][4]) <= std::stod(rows[i][5]) + 1e-9);
+            REQUIRE(std::stod(rows[i][5]) <= std::stod(rows[i][6]) + 1e-9);
+        }
+    }
+
+    MEL::Barrier(comm);
+}
+#endif
+
+#ifdef MEL_TRACE
+std::vector<std::string> TraceEvents(const std::string &path, const std::string &match) {
+    std::vector<std::string> events;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.find(match) != std::string::npos) events.push_back(line);
+    }
+    return events;
+};
+
+TEST_CASE("Trace", "[Trace]") {
+
+    MEL::Comm comm = MEL::Comm::WORLD;
+    const int comm_rank = MEL::CommRank(comm),
+              comm_size = MEL::CommSize(comm);
+
+    SECTION("Events") {
+        MEL::TraceReset();
+        std::vector<int> buf(100, 1);
+        for (int i = 0; i < 3; ++i) {
+            if (comm_rank == 0)      MEL::Send(&buf[0], 100, 1, i, comm);
+            else if (comm_rank == 1) MEL::Recv(&buf[0], 100, 0, i, comm);
+        }
+        {
+            MEL_PROFILE_SCOPE("Test::Scope", 64);
+        }
+        /// Each thread that records events gets its own track
+        std::thread worker([]() {
+            MEL_PROFILE_SCOPE("Test::Worker", -1);
+        });
+        worker.join();
+
+        MEL::TraceReport(comm, "Trace.json");
+
+        if (comm_rank == 0) {
+            const auto names = TraceEvents("Trace.json", "\"process_name\"");
+            REQUIRE(names.size() == (size_t) comm_size);
+
+            const auto sends = TraceEvents("Trace.json", "\"name\":\"Comm::Send");
+            REQUIRE(sends.size() == 3);
+            for (const auto &e : sends) {
+                REQUIRE(e.find("\"cat\":\"Comm\"") != std::string::npos);
+                REQUIRE(e.find("\"ph\":\"X\",\"pid\":0,") != std::string::npos);
+                REQUIRE(e.find("\"args\":{\"bytes\":400}") != std::string::npos);
+                REQUIRE(e.find("\"ts\":-") == std::string::npos);
+            }
+            const auto recvs = TraceEvents("Trace.json", "\"name\":\"Comm::Recv");
+            REQUIRE(recvs.size() == 3);
+            for (const auto &e : recvs) { REQUIRE(e.find("\"pid\":1,") != std::string::npos); }
+
+            const auto scopes = TraceEvents("Trace.json", "\"name\":\"Test::Scope\"");
+            REQUIRE(scopes.size() == (size_t) comm_size);
+            const auto workers = TraceEvents("Trace.json", "\"name\":\"Test::Worker\"");
+            REQUIRE(workers.size() == (size_t) comm_size);
+            for (const auto &e : workers) {
+                REQUIRE(e.find("\"tid\":0,") == std::string::npos);
+                REQUIRE(e.find("\"args\"") == std::string::npos);
+            }
+
+            REQUIRE(TraceEvents("Trace.json", "\"otherData\":{\"processes\":" + std::to_string(comm_size) + ",\"dropped\":0}").size() == 1);
+        }
+    }
+
+    SECTION("Ring") {
+        /// Once the ring is full the oldest events are overwritten and counted as dropped
+        MEL::TraceReset();
+        for (int i = 0; i < MEL_TRACE_EVENTS + 10; ++i) {
+            MEL_PROFILE_SCOPE("Test::Ring", i);
+        }
+        MEL::TraceReport(comm, "Trace.json");
+
+        if (comm_rank == 0) {
+            REQUIRE(TraceEvents("Trace.json", "\"name\":\"Test::Ring\"").size() == (size_t) MEL_TRACE_EVENTS * comm_size);
+            REQUIRE(TraceEvents("Trace.json", "\"args\":{\"bytes\":9}}").empty());
+            REQUIRE(TraceEvents("Trace.json", "\"args\":{\"bytes\":10}}").size() == (size_t) comm_size);
+            REQUIRE(TraceEvents("Trace.json", "\"dropped\":" + std::to_string(10 * comm_size) + "}").size() == 1);
+        }
+        MEL::TraceReset();
+    }
+
+    MEL::Barrier(comm);
+}
+#endif
+
 std::ofstream localOut, localErr;
 
 std::ostream& Catch::cout() {
@@ -955,7 +3239,11 @@ std::ostream& Catch::cerr() {
 };
 
 int main(int argc, char *argv[]) {
+#ifdef MEL_TEST_THREAD_MULTIPLE
+    MEL::InitThread(argc, argv, MEL::ThreadLevel::MULTIPLE);
+#else
     MEL::Init(argc, argv);
+#endif
 
     MEL::Comm comm = MEL::Comm::WORLD;
     const int comm_rank = MEL::CommRank(comm),